@@ -70,6 +70,90 @@
 #define CMD_SPINDLE_OVR_STOP 0x9E
 #define CMD_COOLANT_FLOOD_OVR_TOGGLE 0xA0
 #define CMD_COOLANT_MIST_OVR_TOGGLE 0xA1
+#define CMD_MOTION_FRAME 0xA8 // 二进制运动帧起始字节，格式见 frame.h。
+#define CMD_STATUS_FRAME 0xA9 // 请求完整的二进制状态帧，格式见 report.h。
+#define CMD_STATUS_FRAME_DELTA 0xAA // 请求相对上一帧的增量二进制状态帧。
+
+// 启用二进制运动帧。上位机可以用紧凑的定点目标位置代替 ASCII 直线运动，帧绕过行过滤和
+// G 代码解析直接进入 mc_line()，在短线段加工时提高每秒可处理的块数。格式见 frame.h。
+// #define ENABLE_MOTION_FRAME // 默认禁用。取消注释以启用。启用后 0xA8 不再作为普通扩展字符丢弃。
+
+// 启用窗口应答。上位机发送 $W=<行数> 后，以 N 字开头的行不再逐行回复 "ok"：控制器每累计 <行数> 行
+// 回复一次 "ok:<N>"，表示序号 N 及之前的行都已处理；出错的行立即回复 "error:<代码>:<N>"。不带 N 字的行
+// （包括空行和 '$' 命令）仍逐行应答，并先应答窗口内剩余的行，因此上位机在需要等待应答时（如程序结束或
+// 接收缓冲区已满）可以发送一个空行来同步。$W=0 或复位后恢复逐行应答。
+// #define ENABLE_WINDOWED_ACK // 默认禁用。取消注释以启用。
+
+// 启用 '%' 程序模式。只含 '%' 的行（其后的内容忽略）开始或结束一个程序，应答 "ok"。程序中每执行一行
+// 运动就自动开始循环，不必等待接收缓冲区为空或规划器已满；带运动的行改变主轴转速时，新转速随规划块
+// 在该运动开始时生效，不再清空规划器。复位会结束程序模式。
+// #define ENABLE_PROGRAM_MODE // 默认禁用。取消注释以启用。
+
+// 启用存储在 EEPROM 中的宏程序，用于换刀、对刀、预热等固定流程。$M 列出全部宏，$M<n>=<块>|<块>|...
+// 存储宏 n，各行以 '|' 分隔，等号后为空则清除该宏。G 代码 M98 P<n> 在控制器上依次执行宏 n 的各行，
+// 不需要与上位机往返；任一行出错时停止执行，回显该行并返回其错误。宏中不能再调用宏。
+// #define ENABLE_MACRO // 默认禁用。取消注释以启用。
+#define N_MACRO 8 // 宏的数量（0 至 N_MACRO-1），每个宏最多 MACRO_SIZE-1 个字符。
+
+// 启用固定钻孔循环 G81（钻孔）、G82（孔底暂停）、G83（深孔啄钻）和 G73（断屑啄钻），以及返回模式 G98
+// （返回起始高度）和 G99（返回 R 平面）。循环在控制器上展开为直线移动，R、Z、Q、P 为模态参数，L 为
+// 重复次数（G91 下每次按 X/Y 增量移动到下一个孔）。不支持 G93 逆时间进给。
+#define ENABLE_CANNED_CYCLES // 默认启用。注释以禁用。
+#define CANNED_CYCLE_PECK_CLEARANCE 0.254 // 啄钻时快速回到上次深度之上的距离（mm），G73 也以此距离回退断屑。
+
+// 启用 G17 平面内的样条插补。G5 为三次贝塞尔曲线：I/J 为第一个控制点相对起点的偏移，P/Q 为第二个
+// 控制点相对终点的偏移；紧接在 G5 之后的 G5 可以省略 I/J，沿用上一段终点的切线方向。G5.1 为二次
+// 曲线：I/J 为控制点相对起点的偏移。与圆弧一样在控制器上按 $12 圆弧公差细分为直线段，其他轴随之
+// 线性移动。
+#define ENABLE_SPLINES // 默认启用。注释以禁用。
+
+// 启用路径控制模式 G61（精确路径，默认）、G61.1（精确停止）和 G64 P<值>（连续）。规划器按向心加速度
+// 求拐角速度时使用的连接偏差在 G61 下为 $11，在 G64 P 下为 P（mm），但不超过 PATH_CONTROL_MAX_DEVIATION
+// 倍的 $11。G64 P 只改变拐角处允许的速度，不圆滑拐角：路径仍经过每个顶点，P 越大，拐角处各轴速度的
+// 突变越大，因此上限按 $11 的倍数限制，避免超出轴的加速能力而丢步。不带 P 的 G64 与 G61 相同。G61.1 在
+// 每个程序段结束时停止。圆弧和样条内部各段之间总是按 $11 计算。
+#define ENABLE_PATH_CONTROL_MODES // 默认启用。注释以禁用。
+#define PATH_CONTROL_MAX_DEVIATION 4.0 // G64 P 的上限，为 $11 的倍数。拐角速度约与其平方根成正比。
+
+// 启用规划器合并近似共线的短线段。新的直线运动与缓冲区中最新的块方向接近时，不再占用新块，而是从该块
+// 的起点重新规划为一条直线，使 CAM 输出的 0.01-0.05mm 短线段不再把前瞻距离限制在几毫米内。被合并的
+// 各个顶点到合并后直线的距离不超过 SEGMENT_MERGE_TOLERANCE。只合并进给（或快速）、主轴、冷却和路径
+// 控制模式都相同的块，不合并逆时间进给、G61.1 以及正在执行的块和其后一块。合并块报告第一行的行号。
+#define ENABLE_SEGMENT_MERGING // 默认启用。注释以禁用。
+#define SEGMENT_MERGE_TOLERANCE 0.002 // 合并引入的最大路径偏差（mm），与默认的 $12 圆弧公差相同。
+
+// 启用规划器原生圆弧块。G2/G3 不再由 mc_arc() 按 $12 展开为许多直线段，而是作为一个规划块进入缓冲区，
+// 由步进段准备在每个段内沿圆弧插补（段端点在圆弧上，段内为弦）。一个大圆弧只占一个块，前瞻距离不再
+// 被圆弧占满。圆弧块的速度还受向心加速度限制：v^2/r 不超过平面两轴中较小的加速度。与相邻块的连接
+// 速度按圆弧两端的切向计算。COREXY 下不可用。
+#define ENABLE_NATIVE_ARCS // 默认启用。注释以禁用。
+
+// 启用第二级前瞻。块缓冲区已满、主程序等待空位时，把等待入队的运动以及接收缓冲区中已收完的后续 G0/G1
+// 行预先解析为摘要。每个摘要只有长度（以 2·加速度·长度 表示）和最大入口速度，共 8 字节，反向计算把最后
+// 一个块的退出速度从零提高到能在这些摘要内停下的速度，短线段程序的减速距离不再只限于块缓冲区。只预读
+// 快速路径能执行的行（只含 G0/G1、轴字、F、S、N），遇到其他行、改变转速的行、运动帧或 '$' 命令即停止。
+// 摘要对应的行已经收完，假设主程序在步进执行完整个块缓冲区之前就能把它们送入规划器。
+#define ENABLE_LOOKAHEAD_SUMMARY // 默认启用。注释以禁用。
+
+// 启用二进制状态帧。上位机发送 CMD_STATUS_FRAME 或 CMD_STATUS_FRAME_DELTA 后，控制器在同一串口上回复
+// 定长的二进制状态帧，包含以步数表示的机器位置、状态、倍率和缓冲区计数，不做浮点格式化。增量帧只
+// 包含与该串口上一帧相比变化的字段，机器静止时仅 5 字节。格式见 report.h。
+// #define ENABLE_STATUS_FRAME // 默认禁用。取消注释以启用。
+
+// 启用定时自动推送状态报告。$14 设置推送间隔（毫秒，最大 4000），0 为不推送。控制器由定时器 5 定时，
+// 在主串口上推送与 '?' 相同的状态报告，上位机无需再高频发送 '?'。报告内容与上一次推送相同时跳过；
+// 发送缓冲区可用空间少于 STATUS_PUSH_MIN_TX_FREE 字节时推送延后，不会阻塞主程序等待发送。
+// #define ENABLE_STATUS_PUSH // 默认禁用。取消注释以启用。
+#define STATUS_PUSH_MIN_TX_FREE 160 // 字节，约为一条完整状态报告的长度
+
+// 启用副串口。Mega2560 的 USART1（TX1 数字引脚 18，RX1 数字引脚 19）作为独立缓冲的第二个通道，供手轮、
+// HMI 等设备使用。副串口只接受实时命令（状态查询、暂停、恢复、复位和倍率），其他字节丢弃；在副串口上
+// 发送的 '?' 只在副串口上回复状态报告。HMI 高频轮询时，状态报告不再占用主串口的发送带宽，
+// 也不会插在 G 代码应答之间。
+// 注意：本机的继电器输出接在 PD2（数字引脚 19），即 RX1，由 main.c 的 ws2812b_init_once() 设为输出。启用副串口
+// 后 USART1 接管该引脚并打开上拉，继电器不再受控，所以只能在不使用该继电器的板上启用。
+// #define ENABLE_AUX_SERIAL // 默认禁用。取消注释以启用。
+#define AUX_BAUD_RATE 115200
 
 // 如果启用了归位，归位初始化锁会在开机时将Grbl置于报警状态。这迫使用户在执行其他任何操作之前进行归位循环（或覆盖锁）。
 // 这主要是一个安全特性，用于提醒用户进行归位，因为Grbl的位置信息是未知的。
@@ -319,9 +403,8 @@
 #define MINIMUM_FEED_RATE 1.0 // (mm/min)
 
 // 小角度近似的弧生成迭代次数，然后进行精确的弧轨迹
-// 修正，使用耗费的sin()和cos()计算。
-// 如果弧生成的精确度存在问题，可以减少此参数，
-// 或者如果弧执行因过多三角函数计算而变得缓慢，则增加此参数。
+// 修正。修正使用每段圆弧开始时只计算一次的精确旋转，不再逐次调用sin()和cos()。
+// 如果弧生成的精确度存在问题，可以减少此参数。
 #define N_ARC_CORRECTION 12 // 整数（1-255）
 
 // G2/3的弧G代码标准本质上是有问题的。
@@ -360,7 +443,15 @@
 // 如果由于缺少可用 RAM 而导致 Arduino 开始崩溃，
 // 或者 CPU 在执行时难以跟上新的输入运动的规划，
 // 则减少此值。
-// #define BLOCK_BUFFER_SIZE 36  // 取消注释以覆盖 planner.h 中的默认值。
+// 每个块在 ATmega2560 上约 56 字节。圆弧块的几何数据另存于 ARC_BUFFER_SIZE 个各 12 字节的圆弧缓冲区，
+// 它同时限制了缓冲区中圆弧块的数量。
+// 默认 40 块时，默认配置的静态变量和常量字符串约占 5.9 KB，8 KB 中约 2.3 KB 留给栈；主程序最深的调用链
+// （G 代码行 -> 圆弧 -> 规划器已满时预读接收缓冲区）加上嵌套的中断约需 1.8 KB。增加块数或启用副串口、
+// 宏等功能前，先用 avr-size 确认 .data 与 .bss 之和不超过约 6 KB。
+// #define BLOCK_BUFFER_SIZE 40  // 取消注释以覆盖 planner.h 中的默认值。
+// #define ARC_BUFFER_SIZE 16    // 取消注释以覆盖 planner.h 中的默认值。
+// 第二级前瞻的摘要每个 8 字节，数量受接收缓冲区中能容纳的行数限制，见 ENABLE_LOOKAHEAD_SUMMARY。
+// #define LOOKAHEAD_BUFFER_SIZE 24 // 取消注释以覆盖 planner.h 中的默认值。
 
 // 管理步进执行算法和规划块之间的中介步进段缓冲区的大小。
 // 每个段是一组在固定时间内以恒定速度执行的步进，
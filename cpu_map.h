@@ -26,6 +26,10 @@
 // 串口中断
 #define SERIAL_RX USART0_RX_vect
 #define SERIAL_UDRE USART0_UDRE_vect
+#define SERIAL_AUX_RX USART1_RX_vect
+#define SERIAL_AUX_UDRE USART1_UDRE_vect
+#define SERIAL_AUX_RX_PORT PORTD
+#define SERIAL_AUX_RX_BIT 2 // MEGA2560 Digital Pin 19。与继电器输出共用，见 config.h 中的 ENABLE_AUX_SERIAL。
 
 // 定义步进脉冲输出引脚。注意：所有步进位引脚必须在同一端口上。
 #define STEP_DDR DDRA
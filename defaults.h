@@ -42,6 +42,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK 4
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 2      // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0    // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.01   // mm
 #define DEFAULT_ARC_TOLERANCE 0.002       // mm
 #define DEFAULT_REPORT_INCHES 0           // false
@@ -84,6 +85,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK ((1 << Y_AXIS) | (1 << Z_AXIS))
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1      // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0    // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.01   // mm
 #define DEFAULT_ARC_TOLERANCE 0.002       // mm
 #define DEFAULT_REPORT_INCHES 0           // true
@@ -128,6 +130,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK ((1 << Y_AXIS) | (1 << Z_AXIS))
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1       // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0     // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.02    // mm
 #define DEFAULT_ARC_TOLERANCE 0.002        // mm
 #define DEFAULT_REPORT_INCHES 0            // false
@@ -172,6 +175,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK ((1 << X_AXIS) | (1 << Z_AXIS))
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1       // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0     // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.02    // mm
 #define DEFAULT_ARC_TOLERANCE 0.002        // mm
 #define DEFAULT_REPORT_INCHES 0            // false
@@ -216,6 +220,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK ((1 << X_AXIS) | (1 << Z_AXIS))
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1       // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0     // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.02    // mm
 #define DEFAULT_ARC_TOLERANCE 0.01         // mm
 #define DEFAULT_REPORT_INCHES 0            // false
@@ -260,6 +265,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK ((1 << X_AXIS) | (1 << Y_AXIS))
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1       // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0     // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.02    // mm
 #define DEFAULT_ARC_TOLERANCE 0.002        // mm
 #define DEFAULT_REPORT_INCHES 0            // false
@@ -304,6 +310,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK ((1 << X_AXIS) | (1 << Y_AXIS))
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1       // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0     // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.02    // mm
 #define DEFAULT_ARC_TOLERANCE 0.002        // mm
 #define DEFAULT_REPORT_INCHES 0            // false
@@ -347,6 +354,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK ((1 << Y_AXIS))
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1      // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0    // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.02   // mm
 #define DEFAULT_ARC_TOLERANCE 0.002       // mm
 #define DEFAULT_REPORT_INCHES 0           // false
@@ -386,6 +394,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK 0
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1      // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0    // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.02   // mm
 #define DEFAULT_ARC_TOLERANCE 0.002       // mm
 #define DEFAULT_REPORT_INCHES 0           // false
@@ -425,6 +434,7 @@
 #define DEFAULT_DIRECTION_INVERT_MASK 0
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_STATUS_REPORT_MASK 1      // MPos enabled
+#define DEFAULT_STATUS_PUSH_INTERVAL 0    // 毫秒，0 为不自动推送
 #define DEFAULT_JUNCTION_DEVIATION 0.01   // mm
 #define DEFAULT_ARC_TOLERANCE 0.002       // mm
 #define DEFAULT_REPORT_INCHES 0           // false
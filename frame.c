@@ -0,0 +1,154 @@
+/*
+  frame.c - 二进制运动帧协议
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+#include "grbl.h"
+
+#ifdef ENABLE_MOTION_FRAME
+
+static uint8_t frame_buffer[FRAME_MAX_LENGTH + 2];
+static uint8_t frame_count; // 已收到的字节数，0 表示空闲
+static int32_t frame_line_number = -1;
+
+
+uint8_t frame_collect(uint8_t data)
+{
+  frame_buffer[frame_count++] = data;
+  if (frame_count < 2) { return (false); }
+  // 长度非法时接收中断不再按原始字节接收，这里同样只收到长度字节为止。
+  uint8_t length = frame_buffer[1];
+  if (length > FRAME_MAX_LENGTH) { return (true); }
+  return (frame_count >= length + 2);
+}
+
+
+uint8_t frame_collecting() { return (frame_count != 0); }
+
+
+void frame_reset() { frame_count = 0; }
+
+
+int32_t frame_sequence() { return (frame_line_number); }
+
+
+// 从帧中按小端读取整数。
+static uint16_t frame_read_uint16(uint8_t **ptr)
+{
+  uint16_t value = (*ptr)[0] | ((uint16_t)(*ptr)[1] << 8);
+  *ptr += 2;
+  return (value);
+}
+
+
+static int32_t frame_read_int32(uint8_t **ptr)
+{
+  uint32_t value = frame_read_uint16(ptr);
+  value |= (uint32_t)frame_read_uint16(ptr) << 16;
+  return ((int32_t)value);
+}
+
+
+uint8_t frame_execute()
+{
+  uint8_t length = frame_buffer[1];
+  uint8_t *ptr = &frame_buffer[2];
+  uint8_t checksum = 0;
+  uint8_t idx;
+  frame_count = 0;
+  frame_line_number = -1;
+
+  if ((length < 3) || (length > FRAME_MAX_LENGTH)) { return (STATUS_FRAME_INVALID); }
+  for (idx = 0; idx < length - 1; idx++) { checksum += ptr[idx]; }
+  if (checksum != ptr[length - 1]) { return (STATUS_FRAME_INVALID); }
+
+  uint8_t axis_mask = *ptr++;
+  uint8_t flags = *ptr++;
+  uint8_t expected = 3;
+  for (idx = 0; idx < N_AXIS; idx++) {
+    if (bit_istrue(axis_mask, bit(idx))) { expected += (flags & FRAME_FLAG_DELTA) ? 2 : 4; }
+  }
+  if (flags & FRAME_FLAG_FEED) { expected += 2; }
+  if (flags & FRAME_FLAG_SPINDLE) { expected += 2; }
+  if (flags & FRAME_FLAG_LINE_NUMBER) { expected += 4; }
+  if ((length != expected) || (axis_mask & ~((1 << N_AXIS) - 1))) { return (STATUS_FRAME_INVALID); }
+  if (flags & FRAME_FLAG_LINE_NUMBER) {
+    uint8_t *line_ptr = &frame_buffer[length - 3];
+    frame_line_number = frame_read_int32(&line_ptr);
+  }
+
+  // 与 G 代码行一样，在报警和点动状态下锁定。
+  if (sys.state & (STATE_ALARM | STATE_JOG)) { return (STATUS_SYSTEM_GC_LOCK); }
+
+  float target[N_AXIS];
+  memcpy(target, gc_state.position, sizeof(target));
+  for (idx = 0; idx < N_AXIS; idx++) {
+    if (bit_isfalse(axis_mask, bit(idx))) { continue; }
+    if (flags & FRAME_FLAG_DELTA) {
+      target[idx] += (int16_t)frame_read_uint16(&ptr) / FRAME_UNITS_PER_MM;
+    } else {
+      // 与 G90 相同的坐标变换：WPos + WCS + G92 + TLO
+      target[idx] = frame_read_int32(&ptr) / FRAME_UNITS_PER_MM + gc_state.coord_system[idx] + gc_state.coord_offset[idx];
+      if (idx == TOOL_LENGTH_OFFSET_AXIS) { target[idx] += gc_state.tool_length_offset; }
+    }
+  }
+
+  float feed_rate = gc_state.feed_rate;
+  float spindle_speed = gc_state.spindle_speed;
+  if (flags & FRAME_FLAG_FEED) { feed_rate = frame_read_uint16(&ptr); }
+  if (flags & FRAME_FLAG_SPINDLE) { spindle_speed = frame_read_uint16(&ptr); }
+  int32_t line_number = (flags & FRAME_FLAG_LINE_NUMBER) ? frame_read_int32(&ptr) : 0;
+  if (!(flags & FRAME_FLAG_RAPID) && (feed_rate == 0.0)) { return (STATUS_GCODE_UNDEFINED_FEED_RATE); }
+
+  // 校验完毕，以下与 gc_execute_line() 执行直线运动的顺序相同。
+  plan_line_data_t plan_data;
+  plan_line_data_t *pl_data = &plan_data;
+  memset(pl_data, 0, sizeof(plan_line_data_t));
+  gc_state.line_number = line_number;
+  pl_data->line_number = line_number;
+  gc_state.feed_rate = feed_rate;
+  pl_data->feed_rate = feed_rate;
+  if (gc_state.spindle_speed != spindle_speed) {
+    // 激光模式和程序模式下转速随运动块生效，否则先同步再更新主轴。
+    uint8_t sync = bit_isfalse(settings.flags, BITFLAG_LASER_MODE);
+    #ifdef ENABLE_PROGRAM_MODE
+      if (sys.program_mode) { sync = false; }
+    #endif
+    if ((gc_state.modal.spindle != SPINDLE_DISABLE) && sync) {
+      spindle_sync(gc_state.modal.spindle, spindle_speed);
+    }
+    gc_state.spindle_speed = spindle_speed;
+  }
+  if (flags & FRAME_FLAG_RAPID) {
+    pl_data->condition |= PL_COND_FLAG_RAPID_MOTION;
+    gc_state.modal.motion = MOTION_MODE_SEEK;
+  } else {
+    gc_state.modal.motion = MOTION_MODE_LINEAR;
+  }
+  // 激光模式下快速移动不开激光。
+  if (!(flags & FRAME_FLAG_RAPID) || bit_isfalse(settings.flags, BITFLAG_LASER_MODE)) {
+    pl_data->spindle_speed = gc_state.spindle_speed;
+  }
+  pl_data->condition |= gc_state.modal.spindle;
+  pl_data->condition |= gc_state.modal.coolant;
+  #ifdef ENABLE_PATH_CONTROL_MODES
+    pl_data->path_tolerance = gc_state.path_tolerance;
+  #endif
+
+  mc_line(target, pl_data);
+  memcpy(gc_state.position, target, sizeof(gc_state.position));
+  return (STATUS_OK);
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+  frame.h - 二进制运动帧协议
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  运动帧与 ASCII G 代码共用串口和接收缓冲区，每帧像一行 G 代码一样应答 "ok" 或 "error:"，
+  上位机仍可按字符计数协议发送。所有多字节值为小端。
+
+    字节 0      CMD_MOTION_FRAME
+    字节 1      长度：其后的字节数（含校验和），不超过 FRAME_MAX_LENGTH
+    字节 2      轴掩码，位 n 为轴 n（X=0 ... D=6）
+    字节 3      标志，见 FRAME_FLAG_*
+    轴值        按轴号顺序，每个出现的轴一个值，单位 0.001 mm（旋转轴 0.001 度）。
+                默认为 int32 工作坐标（与 G90 相同，应用 G54-G59、G92 和刀长补偿）；
+                FRAME_FLAG_DELTA 时为相对上一目标的 int16 增量。
+    [uint16]    进给速度 mm/min（FRAME_FLAG_FEED）
+    [uint16]    主轴转速 RPM（FRAME_FLAG_SPINDLE）
+    [int32]     行号（FRAME_FLAG_LINE_NUMBER）
+    校验和      字节 2 至校验和之前全部字节的 8 位累加和
+
+  帧等同于 G0/G1 直线运动，并更新解析器的位置、运动模式、进给和主轴转速，之后的 G 代码行
+  从帧的终点继续。单位总是毫米，忽略 G20 和 G93。
+  接收中断见到 CMD_MOTION_FRAME 后把整帧按原始字节放入接收缓冲区，其间不识别实时命令，
+  因此复位等实时命令应在帧之间发送。
+*/
+
+#ifndef frame_h
+#define frame_h
+
+#define FRAME_FLAG_RAPID        bit(0) // G0，否则为 G1
+#define FRAME_FLAG_DELTA        bit(1) // 轴值为 int16 增量
+#define FRAME_FLAG_FEED         bit(2)
+#define FRAME_FLAG_SPINDLE      bit(3)
+#define FRAME_FLAG_LINE_NUMBER  bit(4)
+
+#define FRAME_UNITS_PER_MM 1000.0
+#define FRAME_MAX_LENGTH (2 + 4 * N_AXIS + 2 + 2 + 4 + 1)
+
+// 收集一个字节。整帧收齐时返回 true，之后由 frame_execute() 执行。
+uint8_t frame_collect(uint8_t data);
+
+// 正在收集一帧。此时接收到的字节都属于该帧。
+uint8_t frame_collecting();
+
+// 丢弃未收完的帧。
+void frame_reset();
+
+// 校验并执行收齐的帧，返回状态码。
+uint8_t frame_execute();
+
+// 最近执行的帧所带的行号，帧未通过校验或不带行号时为 -1。用作窗口应答的序号。
+int32_t frame_sequence();
+
+#endif
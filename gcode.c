@@ -53,10 +53,685 @@ void gc_sync_position()
   system_convert_array_steps_to_mpos(gc_state.position, sys_position);
 }
 
+// 流式分词。主循环每收到一个过滤后的字符就调用 gc_tokenize_char()，字母和数值在接收时
+// 即组成字，行尾到达时不必再扫描一遍行缓冲区。规则与 gc_execute_line() 逐字读取时相同：
+// 遇到第一个错误后停止分词，已完成的字照常执行，然后报告该错误。
+#define GC_TOKEN_EXPECT_LETTER 0 // 等待字母
+#define GC_TOKEN_EXPECT_SIGN 1   // 刚读到字母，数值可以带符号
+#define GC_TOKEN_NUMBER 2        // 读取数值中
+
+// 数值按定点数保存，坐标字只在交给解析器时转换一次浮点数，G/M 命令字完全不需要浮点运算。
+// 超出定点范围的数值（如很大的行号）仍按浮点数保存。
+typedef struct
+{
+  char letter;
+  bool isfixed;
+  union
+  {
+    int32_t fixed; // isfixed 时有效，见 FIXED_POINT_SCALE
+    float value;
+  };
+} gc_word_t;
+
+typedef struct
+{
+  uint8_t state;
+  uint8_t status;     // 第一个分词错误，之后的字符被忽略
+  uint8_t count;      // 已完成的字数
+  uint8_t size;       // word[] 的容量
+  bool isnegative;
+  float_reader_t reader;
+  gc_word_t *word;
+} gc_tokenizer_t;
+
+static gc_word_t gc_words[GC_MAX_WORDS];
+static gc_tokenizer_t gc_tokens;
+
+static void gc_tokenizer_init(gc_tokenizer_t *tokens, gc_word_t *word, uint8_t size)
+{
+  tokens->state = GC_TOKEN_EXPECT_LETTER;
+  tokens->status = STATUS_OK;
+  tokens->count = 0;
+  tokens->size = size;
+  tokens->word = word;
+}
+
+void gc_tokenize_reset() { gc_tokenizer_init(&gc_tokens, gc_words, GC_MAX_WORDS); }
+
+// 由读入的数值和符号设置字的值。
+static void gc_word_set_value(gc_word_t *word, float_reader_t *reader, bool isnegative)
+{
+  word->isfixed = float_reader_fixed(reader, &word->fixed);
+  if (word->isfixed)
+  {
+    if (isnegative)
+    {
+      word->fixed = -word->fixed;
+    }
+  }
+  else
+  {
+    word->value = float_reader_value(reader);
+    if (isnegative)
+    {
+      word->value = -word->value;
+    }
+  }
+}
+
+// 从行缓冲区读取带符号的数值，与 read_float() 的规则相同。
+static uint8_t gc_read_word_value(char *line, uint8_t *char_counter, gc_word_t *word)
+{
+  char *ptr = line + *char_counter;
+  bool isnegative = false;
+  if (*ptr == '-')
+  {
+    isnegative = true;
+    ptr++;
+  }
+  else if (*ptr == '+')
+  {
+    ptr++;
+  }
+  float_reader_t reader;
+  float_reader_init(&reader);
+  while (float_reader_char(&reader, *ptr))
+  {
+    ptr++;
+  }
+  if (!reader.ndigit)
+  {
+    return (false);
+  }
+  gc_word_set_value(word, &reader, isnegative);
+  *char_counter = ptr - line;
+  return (true);
+}
+
+// 结束当前字的数值。
+static void gc_tokenizer_end_word(gc_tokenizer_t *tokens)
+{
+  if (!tokens->reader.ndigit)
+  {
+    tokens->status = STATUS_BAD_NUMBER_FORMAT;
+    return;
+  }
+  gc_word_set_value(&tokens->word[tokens->count++], &tokens->reader, tokens->isnegative);
+  tokens->state = GC_TOKEN_EXPECT_LETTER;
+}
+
+static void gc_tokenizer_char(gc_tokenizer_t *tokens, char c)
+{
+  if (tokens->status)
+  {
+    return;
+  }
+  switch (tokens->state)
+  {
+  case GC_TOKEN_EXPECT_SIGN:
+    tokens->state = GC_TOKEN_NUMBER;
+    if (c == '-')
+    {
+      tokens->isnegative = true;
+      return;
+    }
+    if (c == '+')
+    {
+      return;
+    }
+    // 没有 break。按数值字符处理。
+  case GC_TOKEN_NUMBER:
+    if (float_reader_char(&tokens->reader, c))
+    {
+      return;
+    }
+    gc_tokenizer_end_word(tokens);
+    if (tokens->status)
+    {
+      return;
+    }
+    // 没有 break。c 是下一个字的字母。
+  default:
+    if ((c < 'A') || (c > 'Z'))
+    {
+      tokens->status = STATUS_EXPECTED_COMMAND_LETTER;
+      return;
+    }
+    if (tokens->count == tokens->size)
+    {
+      tokens->status = STATUS_OVERFLOW; // 由 gc_execute_tokens() 改为按行缓冲区解析
+      return;
+    }
+    tokens->word[tokens->count].letter = c;
+    tokens->isnegative = false;
+    float_reader_init(&tokens->reader);
+    tokens->state = GC_TOKEN_EXPECT_SIGN;
+  }
+}
+
+// 行尾结束最后一个字。
+static void gc_tokenizer_end_line(gc_tokenizer_t *tokens)
+{
+  if (!tokens->status && (tokens->state != GC_TOKEN_EXPECT_LETTER))
+  {
+    gc_tokenizer_end_word(tokens);
+  }
+}
+
+void gc_tokenize_char(char c) { gc_tokenizer_char(&gc_tokens, c); }
+
+static uint8_t gc_execute_block(char *line, uint8_t tokenized);
+
+// 字的浮点数值。
+static float gc_word_value(gc_word_t *word)
+{
+  return (word->isfixed ? fixed_to_float(word->fixed) : word->value);
+}
+
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+// 接收缓冲区的预读状态，见 gc_preview_lines()。
+static struct
+{
+  float *pending;         // 快速路径正在送入 mc_line() 的目标，为 NULL 时其后的行不能预读
+  uint8_t active;         // 继续预读
+  uint8_t rx_index;       // 下一个预读行在接收缓冲区中的起点
+  uint8_t motion;         // 已预读的最后一行执行后的模态值和位置
+  float feed_rate;
+  float spindle_speed;
+  float position[N_AXIS];
+} gc_preview;
+#endif
+
+// 快速路径能执行的一行：目标（机床坐标）和执行后的模态值。
+typedef struct
+{
+  float target[N_AXIS];
+  float feed_rate;
+  float spindle_speed;
+  int32_t line_number;
+  uint8_t motion;
+} gc_fast_line_t;
+
+// 快速路径：G94 模式下只含轴字、F、S、N 和可选的一个 G0/G1 的 G0/G1 运动行（流式加工中的绝大
+// 多数行）不需要 gc_execute_block() 的完整流程。这里只做这类行可能用到的检查和转换，结果与完整
+// 流程相同。任何不符合条件或可能出错的行返回 false，交给完整流程执行并报告错误，因此错误报告不变。
+// 调用时 line 中的 motion、feed_rate 和 spindle_speed 为执行前的模态值，position 为起点。其余模态取自
+// gc_state，快速路径的行不改变它们。
+static uint8_t gc_parse_motion_fast(gc_tokenizer_t *tokens, float *position, gc_fast_line_t *line)
+{
+  if (tokens->status || (gc_state.modal.feed_rate != FEED_RATE_MODE_UNITS_PER_MIN))
+  {
+    return (false);
+  }
+
+  float *target = line->target;
+  uint8_t motion_word = false;
+  uint8_t axis_words = 0;
+  uint8_t value_words = 0; // 已出现的 F、S、N，位 0-2
+  uint8_t idx;
+  line->line_number = 0;
+
+  for (idx = 0; idx < tokens->count; idx++)
+  {
+    gc_word_t *word = &tokens->word[idx];
+    uint8_t axis;
+    switch (word->letter)
+    {
+    case 'X':
+      axis = X_AXIS;
+      break;
+    case 'Y':
+      axis = Y_AXIS;
+      break;
+    case 'Z':
+      axis = Z_AXIS;
+      break;
+#ifdef A_AXIS
+    case 'A':
+      axis = A_AXIS;
+      break;
+#endif
+#ifdef B_AXIS
+    case 'B':
+      axis = B_AXIS;
+      break;
+#endif
+#ifdef C_AXIS
+    case 'C':
+      axis = C_AXIS;
+      break;
+#endif
+#ifdef D_AXIS
+    case 'D':
+      axis = D_AXIS;
+      break;
+#endif
+    case 'F':
+    case 'S':
+    case 'N':
+      axis = N_AXIS;
+      break;
+    case 'G':
+      // 只接受一个 G0 或 G1，G0.x 等交给完整流程。
+      if (motion_word || !word->isfixed || ((word->fixed != 0) && (word->fixed != FIXED_POINT_SCALE)))
+      {
+        return (false);
+      }
+      motion_word = true;
+      line->motion = word->fixed ? MOTION_MODE_LINEAR : MOTION_MODE_SEEK;
+      continue;
+    default:
+      return (false); // 其他命令字和数值字
+    }
+
+    float value = gc_word_value(word);
+    if (axis < N_AXIS)
+    {
+      if (bit_istrue(axis_words, bit(axis)))
+      {
+        return (false);
+      } // [字母重复]
+      axis_words |= bit(axis);
+      target[axis] = value;
+      if (gc_state.modal.units == UNITS_MODE_INCHES)
+      {
+        target[axis] *= MM_PER_INCH;
+      }
+      continue;
+    }
+    // F、S、N 不能为负。
+    uint8_t word_bit = (word->letter == 'F') ? bit(0) : ((word->letter == 'S') ? bit(1) : bit(2));
+    if (bit_istrue(value_words, word_bit) || (value < 0.0))
+    {
+      return (false);
+    } // [字母重复] [字母值不能为负]
+    value_words |= word_bit;
+    if (word->letter == 'F')
+    {
+      line->feed_rate = value;
+      if (gc_state.modal.units == UNITS_MODE_INCHES)
+      {
+        line->feed_rate *= MM_PER_INCH;
+      }
+    }
+    else if (word->letter == 'S')
+    {
+      line->spindle_speed = value;
+    }
+    else
+    {
+      if (trunc(value) > MAX_LINE_NUMBER)
+      {
+        return (false);
+      } // [超出最大行号]
+      line->line_number = trunc(value);
+    }
+  }
+  if (!axis_words || ((line->motion != MOTION_MODE_SEEK) && (line->motion != MOTION_MODE_LINEAR)))
+  {
+    return (false);
+  } // 没有运动的行或其他运动模式
+  if ((line->motion == MOTION_MODE_LINEAR) && (line->feed_rate == 0.0))
+  {
+    return (false);
+  } // [进给率未定义]
+
+  // 与完整流程相同地计算目标：WPos + WCS + G92 + TLO，或增量模式下加当前位置。
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    if (bit_isfalse(axis_words, bit(idx)))
+    {
+      target[idx] = position[idx];
+    }
+    else if (gc_state.modal.distance == DISTANCE_MODE_ABSOLUTE)
+    {
+      target[idx] += gc_state.coord_system[idx] + gc_state.coord_offset[idx];
+      if (idx == TOOL_LENGTH_OFFSET_AXIS)
+      {
+        target[idx] += gc_state.tool_length_offset;
+      }
+    }
+    else
+    {
+      target[idx] += position[idx];
+    }
+  }
+  return (true);
+}
+
+static uint8_t gc_execute_motion_fast(uint8_t *status)
+{
+  gc_fast_line_t line;
+  line.motion = gc_state.modal.motion;
+  line.feed_rate = gc_state.feed_rate;
+  line.spindle_speed = gc_state.spindle_speed;
+  if (!gc_parse_motion_fast(&gc_tokens, gc_state.position, &line))
+  {
+    return (false);
+  }
+  float *target = line.target;
+  uint8_t motion = line.motion;
+
+  // 以下与 gc_execute_block() 第 4 步对这类行的执行相同。
+  plan_line_data_t plan_data;
+  plan_line_data_t *pl_data = &plan_data;
+  memset(pl_data, 0, sizeof(plan_line_data_t));
+  uint8_t laser_disable = false;
+  uint8_t spindle_is_motion = false; // 转速随规划块生效，见第 4 步的 GC_PARSER_LASER_ISMOTION
+  if (bit_istrue(settings.flags, BITFLAG_LASER_MODE))
+  {
+    laser_disable = (motion == MOTION_MODE_SEEK);
+    spindle_is_motion = true;
+  }
+#ifdef ENABLE_PROGRAM_MODE
+  else if (sys.program_mode)
+  {
+    spindle_is_motion = true;
+  }
+#endif
+
+  gc_state.line_number = line.line_number;
+  pl_data->line_number = line.line_number;
+  gc_state.feed_rate = line.feed_rate;
+  pl_data->feed_rate = line.feed_rate;
+  if (gc_state.spindle_speed != line.spindle_speed)
+  {
+    if ((gc_state.modal.spindle != SPINDLE_DISABLE) && !spindle_is_motion)
+    {
+      spindle_sync(gc_state.modal.spindle, line.spindle_speed);
+    }
+    gc_state.spindle_speed = line.spindle_speed;
+  }
+  if (!laser_disable)
+  {
+    pl_data->spindle_speed = gc_state.spindle_speed;
+  }
+  gc_state.tool = settings.tool;
+  pl_data->condition |= gc_state.modal.spindle;
+  pl_data->condition |= gc_state.modal.coolant;
+  gc_state.modal.motion = motion;
+  if (motion == MOTION_MODE_SEEK)
+  {
+    pl_data->condition |= PL_COND_FLAG_RAPID_MOTION;
+  }
+#ifdef ENABLE_PATH_CONTROL_MODES
+  pl_data->path_tolerance = gc_state.path_tolerance;
+#endif
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  gc_preview.pending = target;
+  mc_line(target, pl_data);
+  gc_preview.pending = NULL;
+#else
+  mc_line(target, pl_data);
+#endif
+  memcpy(gc_state.position, target, sizeof(gc_state.position));
+  *status = STATUS_OK;
+  return (true);
+}
+
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+// 块缓冲区已满、快速路径的一行在 mc_line() 中等待时，预读接收缓冲区中其后已收完的快速路径行，作为规划器
+// 第二级前瞻的摘要。预读按主循环的规则过滤字符，按快速路径的规则解析，遇到快速路径不能执行的行即停止，
+// 所以摘要与这些行之后实际送入规划器的运动相同。之前的行都是快速路径的行，除位置、运动模式、进给和转速
+// 外的模态与解析器相同。
+#define GC_PREVIEW_COMMENT_PARENTHESES bit(0)
+#define GC_PREVIEW_COMMENT_SEMICOLON bit(1)
+
+void gc_preview_begin(uint8_t summary, float *target)
+{
+  if ((summary == PLAN_SUMMARY_NONE) || (target != gc_preview.pending))
+  {
+    gc_preview.active = false; // 不是快速路径的行，不知道其后的行从哪里开始
+    return;
+  }
+  if (summary == PLAN_SUMMARY_NEW)
+  {
+    // 主循环已读完等待中的这一行，下一行从接收缓冲区的读取位置开始。
+    gc_preview.active = true;
+    gc_preview.rx_index = serial_get_rx_read_index();
+    gc_preview.motion = gc_state.modal.motion;
+    gc_preview.feed_rate = gc_state.feed_rate;
+    gc_preview.spindle_speed = gc_state.spindle_speed;
+    memcpy(gc_preview.position, target, sizeof(gc_preview.position));
+  }
+  // PLAN_SUMMARY_CONTINUE：等待中的行已在之前预读，从上次停止的位置继续。
+}
+
+void gc_preview_lines()
+{
+  if (!gc_preview.active || !gc_preview.pending || !plan_summary_available())
+  {
+    return;
+  }
+  gc_word_t word[N_AXIS + 4]; // 轴字和 G、F、S、N 各一个
+  gc_tokenizer_t tokens;
+  gc_tokenizer_init(&tokens, word, N_AXIS + 4);
+  uint8_t rx_index = gc_preview.rx_index;
+  uint8_t comment = 0;
+  uint8_t char_counter = 0;
+  uint8_t c;
+  for (;;)
+  {
+    if (!serial_peek(&rx_index, &c))
+    {
+      return; // 这一行尚未收完，下次从行首再看
+    }
+#ifdef ENABLE_MOTION_FRAME
+    if (c == CMD_MOTION_FRAME)
+    {
+      gc_preview.active = false;
+      return;
+    }
+#endif
+    if ((c == '\n') || (c == '\r'))
+    {
+      break;
+    }
+    if (comment)
+    {
+      if (c == ')')
+      {
+        comment &= ~GC_PREVIEW_COMMENT_PARENTHESES;
+      }
+    }
+    else if ((c <= ' ') || (c == '/'))
+    {
+      // 与主循环相同地丢弃空白、控制字符和删除块字符。
+    }
+    else if (c == '(')
+    {
+      comment |= GC_PREVIEW_COMMENT_PARENTHESES;
+    }
+    else if (c == ';')
+    {
+      comment |= GC_PREVIEW_COMMENT_SEMICOLON;
+    }
+    else if (((char_counter == 0) && ((c == '$') || (c == '%'))) || (char_counter >= (LINE_BUFFER_SIZE - 1)))
+    {
+      gc_preview.active = false; // '$' 命令、程序起止和溢出的行
+      return;
+    }
+    else
+    {
+      if (c >= 'a' && c <= 'z')
+      {
+        c -= 'a' - 'A';
+      }
+      char_counter++;
+      gc_tokenizer_char(&tokens, c);
+    }
+  }
+  gc_preview.rx_index = rx_index;
+  if (char_counter == 0)
+  {
+    return; // 空行或注释行
+  }
+
+  gc_tokenizer_end_line(&tokens);
+  gc_fast_line_t line;
+  line.motion = gc_preview.motion;
+  line.feed_rate = gc_preview.feed_rate;
+  line.spindle_speed = gc_preview.spindle_speed;
+  // 改变转速的行可能先同步，缓冲区中的运动要在此停下，不能预读。
+  if (!gc_parse_motion_fast(&tokens, gc_preview.position, &line) || (line.spindle_speed != gc_preview.spindle_speed))
+  {
+    gc_preview.active = false;
+    return;
+  }
+  plan_line_data_t plan_data;
+  memset(&plan_data, 0, sizeof(plan_line_data_t));
+  plan_data.feed_rate = line.feed_rate;
+  plan_data.condition = gc_state.modal.spindle | gc_state.modal.coolant;
+  if (line.motion == MOTION_MODE_SEEK)
+  {
+    plan_data.condition |= PL_COND_FLAG_RAPID_MOTION;
+  }
+#ifdef ENABLE_PATH_CONTROL_MODES
+  plan_data.path_tolerance = gc_state.path_tolerance;
+#endif
+  if (!plan_summary_append(line.target, &plan_data))
+  {
+    gc_preview.active = false;
+    return;
+  }
+  gc_preview.motion = line.motion;
+  gc_preview.feed_rate = line.feed_rate;
+  memcpy(gc_preview.position, line.target, sizeof(gc_preview.position));
+}
+#endif
+
+// 激光模式下开激光的运动模式：G1/2/3 和样条。
+static uint8_t gc_is_laser_motion(uint8_t motion)
+{
+#ifdef ENABLE_SPLINES
+  if ((motion == MOTION_MODE_CUBIC_SPLINE) || (motion == MOTION_MODE_QUADRATIC_SPLINE))
+  {
+    return (true);
+  }
+#endif
+  return ((motion == MOTION_MODE_LINEAR) || (motion == MOTION_MODE_CW_ARC) || (motion == MOTION_MODE_CCW_ARC));
+}
+
+#ifdef ENABLE_CANNED_CYCLES
+static uint8_t gc_is_canned_cycle(uint8_t motion)
+{
+  return ((motion == MOTION_MODE_DRILL_CHIP_BREAK) || ((motion >= MOTION_MODE_DRILL) && (motion <= MOTION_MODE_DRILL_PECK)));
+}
+
+// 固定循环中沿一个轴的直线移动。rapid 为 false 时按块的进给速度移动。
+static void gc_cycle_move(float *position, uint8_t axis, float value, plan_line_data_t *pl_data, uint8_t rapid)
+{
+  position[axis] = value;
+  if (rapid)
+  {
+    pl_data->condition |= PL_COND_FLAG_RAPID_MOTION;
+  }
+  else
+  {
+    pl_data->condition &= ~PL_COND_FLAG_RAPID_MOTION;
+  }
+  mc_line(position, pl_data);
+}
+
+// 把固定循环展开为直线移动。hole 为第一个孔的位置（机床坐标），r 和 z 为 R 平面和孔底的机床坐标，
+// 之后的孔依次加上 step_0/step_1。返回时 hole 为最后一个孔上方的返回点，即解析器的新位置。
+static void gc_execute_canned_cycle(float *hole, float r, float z, float step_0, float step_1, uint8_t repeat,
+                                    uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear, plan_line_data_t *pl_data)
+{
+  float position[N_AXIS];
+  memcpy(position, gc_state.position, sizeof(position));
+  uint8_t motion = gc_state.modal.motion;
+  // G98 返回循环开始时的高度（低于 R 平面时为 R 平面），G99 返回 R 平面。
+  float clear = r;
+  if (gc_state.modal.retract == RETRACT_MODE_INITIAL)
+  {
+    clear = max(position[axis_linear], r);
+  }
+  if (position[axis_linear] < r)
+  {
+    gc_cycle_move(position, axis_linear, r, pl_data, true);
+  }
+
+  for (;;)
+  {
+    // 在当前高度快速移动到孔位，再快速下降到 R 平面。
+    position[axis_0] = hole[axis_0];
+    gc_cycle_move(position, axis_1, hole[axis_1], pl_data, true);
+    gc_cycle_move(position, axis_linear, r, pl_data, true);
+    if ((motion == MOTION_MODE_DRILL_PECK) || (motion == MOTION_MODE_DRILL_CHIP_BREAK))
+    {
+      // 每次进给 Q。G83 每次退回 R 平面排屑，G73 只回退一小段断屑；之后快速回到上次深度之上再进给。
+      float depth = r;
+      while (depth > z)
+      {
+        if (depth < r)
+        {
+          if (motion == MOTION_MODE_DRILL_PECK)
+          {
+            gc_cycle_move(position, axis_linear, r, pl_data, true);
+          }
+          gc_cycle_move(position, axis_linear, min(depth + CANNED_CYCLE_PECK_CLEARANCE, r), pl_data, true);
+        }
+        depth = max(depth - gc_state.cycle.q, z);
+        gc_cycle_move(position, axis_linear, depth, pl_data, false);
+        if (sys.abort)
+        {
+          return;
+        }
+      }
+    }
+    else
+    {
+      gc_cycle_move(position, axis_linear, z, pl_data, false);
+      if (motion == MOTION_MODE_DRILL_DWELL)
+      {
+        mc_dwell(gc_state.cycle.p);
+      }
+    }
+    gc_cycle_move(position, axis_linear, clear, pl_data, true);
+    if ((--repeat == 0) || sys.abort)
+    {
+      break;
+    }
+    hole[axis_0] += step_0;
+    hole[axis_1] += step_1;
+  }
+  memcpy(hole, position, sizeof(position));
+}
+#endif
+
+uint8_t gc_execute_tokens(char *line)
+{
+  gc_tokenizer_end_line(&gc_tokens);
+  if (gc_tokens.status == STATUS_OVERFLOW)
+  {
+    return (gc_execute_block(line, false));
+  }
+  uint8_t status;
+  if (gc_execute_motion_fast(&status))
+  {
+    return (status);
+  }
+  return (gc_execute_block(line, true));
+}
+
 // 执行一行以 0 结尾的 G 代码。假设该行只包含大写字符和带符号的浮点值
 // （无空格）。注释和块删除字符已被删除。在此函数中，所有单位和位置
 // 都被转换并以（毫米，毫米/分钟）和绝对机床坐标的形式导出到 grbl 的内部功能。
 uint8_t gc_execute_line(char *line)
+{
+  // 宏、启动行、换刀和点动不经过主循环，执行下一行之前同样要把上一行未送完的圆弧段全部送入规划器。
+  mc_arc_finish();
+  if (sys.abort)
+  {
+    return (STATUS_OK);
+  }
+  return (gc_execute_block(line, false));
+}
+
+// 执行一行 G 代码。tokenized 为 true 时从流式分词得到的字读取，否则逐字扫描 line。
+// 注意：换刀等过程会递归调用 gc_execute_line()，因此递归调用不使用分词结果。
+static uint8_t gc_execute_block(char *line, uint8_t tokenized)
 {
   /* -------------------------------------------------------------------------------------
      第 1 步：初始化解析器块结构体并复制当前 g-code 状态模式。解析器
@@ -78,11 +753,17 @@ uint8_t gc_execute_line(char *line)
 
   // 初始化命令和数值字以及解析器标志变量。
   uint16_t command_words = 0; // 跟踪 G 和 M 命令字。还用于检测模式组冲突。
-  uint16_t value_words = 0;   // 跟踪数值字。
+  uint32_t value_words = 0;   // 跟踪数值字。用 word_mask() 取各字的掩码。
   uint8_t gc_parser_flags = GC_PARSER_NONE;
+#ifdef ENABLE_SPLINES
+  uint8_t negative_pq = false; // P 或 Q 为负，只有 G5 允许
+#endif
+#ifdef ENABLE_MACRO
+  uint8_t macro_call = false; // M98
+#endif
 
   // 确定该行是快速移动还是普通的 g-code 块。
-  if (line[0] == '$')
+  if (!tokenized && (line[0] == '$'))
   { // 注意：`$J=` 在传递到此函数时已解析。
     // 设置 G1 和 G94 强制模式以确保准确的错误检查。
     gc_parser_flags |= GC_PARSER_JOG_MOTION;
@@ -98,8 +779,11 @@ uint8_t gc_execute_line(char *line)
 
   uint8_t word_bit; // 用于分配跟踪变量的位值
   uint8_t char_counter;
+  uint8_t word_index = 0;
+  gc_word_t *word;
+  gc_word_t line_word; // 不使用分词结果时从行缓冲区读出的字
   char letter;
-  float value;
+  float value = 0; // 数值字的值，命令字不计算
   uint8_t int_value = 0;
   uint16_t mantissa = 0;
   if (gc_parser_flags & GC_PARSER_JOG_MOTION)
@@ -111,28 +795,68 @@ uint8_t gc_execute_line(char *line)
     char_counter = 0;
   }
 
-  while (line[char_counter] != 0)
+  for (;;)
   { // 循环直到行中没有更多的 g-code 字。
 
-    // 导入下一个 g-code 字，期望是字母后跟数值，否则返回错误。
-    letter = line[char_counter];
-    if ((letter < 'A') || (letter > 'Z'))
+    if (tokenized)
     {
-      FAIL(STATUS_EXPECTED_COMMAND_LETTER);
-    } // [预期字母]
-    char_counter++;
-    if (!read_float(line, &char_counter, &value))
+      // 字已在接收时读出。全部执行完后报告分词时遇到的错误。
+      if (word_index == gc_tokens.count)
+      {
+        if (gc_tokens.status)
+        {
+          FAIL(gc_tokens.status);
+        }
+        break;
+      }
+      word = &gc_tokens.word[word_index++];
+    }
+    else
     {
-      FAIL(STATUS_BAD_NUMBER_FORMAT);
-    } // [预期数值]
+      if (line[char_counter] == 0)
+      {
+        break;
+      }
+      // 导入下一个 g-code 字，期望是字母后跟数值，否则返回错误。
+      letter = line[char_counter];
+      if ((letter < 'A') || (letter > 'Z'))
+      {
+        FAIL(STATUS_EXPECTED_COMMAND_LETTER);
+      } // [预期字母]
+      char_counter++;
+      word = &line_word;
+      word->letter = letter;
+      if (!gc_read_word_value(line, &char_counter, word))
+      {
+        FAIL(STATUS_BAD_NUMBER_FORMAT);
+      } // [预期数值]
+    }
+    letter = word->letter;
 
-    // 将数值转换为较小的 uint8 有效数和尾数值，以解析该字。
-    // 注意：尾数乘以 100 以捕捉非整数命令值。比 NIST gcode 对命令要求的 x10 更精确，
-    // 但对要求精确到 0.0001 的数值字不够精确。这是一个良好的折中方案，能捕捉到大多数非整数错误。
-    // 为完全符合标准，只需将尾数改为 int16，但这会增加编译后所占的闪存空间。未来可能会更新。
-    int_value = trunc(value);
-    mantissa = round(100 * (value - int_value)); // 计算 Gxx.x 命令的尾数。
-    // 注意：必须使用四舍五入以捕捉小的浮点错误。
+    if ((letter == 'G') || (letter == 'M'))
+    {
+      // 将命令值转换为较小的 uint8 有效数和尾数值，以解析该字。
+      // 注意：尾数乘以 100 以捕捉非整数命令值。比 NIST gcode 对命令要求的 x10 更精确，
+      // 但对要求精确到 0.0001 的数值字不够精确。这是一个良好的折中方案，能捕捉到大多数非整数错误。
+      // 为完全符合标准，只需将尾数改为 int16，但这会增加编译后所占的闪存空间。未来可能会更新。
+      if (word->isfixed)
+      {
+        int32_t fraction = word->fixed % FIXED_POINT_SCALE;
+        int_value = word->fixed / FIXED_POINT_SCALE;
+        mantissa = (fraction + ((fraction < 0) ? -50 : 50)) / (FIXED_POINT_SCALE / 100); // 四舍五入到两位小数
+      }
+      else
+      {
+        int_value = trunc(word->value);
+        mantissa = round(100 * (word->value - int_value)); // 计算 Gxx.x 命令的尾数。
+        // 注意：必须使用四舍五入以捕捉小的浮点错误。
+      }
+    }
+    else
+    {
+      // 数值字只需要数值本身。定点数在这里转换为解析器使用的浮点数，只需一次乘法。
+      value = gc_word_value(word);
+    }
 
     // 检查 g-code 字是否受支持、是否因模式组冲突错误或在 g-code 块中被重复。如果有效，则更新命令或记录其值。
     switch (letter)
@@ -179,6 +903,15 @@ uint8_t gc_execute_line(char *line)
       case 2:
       case 3:
       case 38:
+#ifdef ENABLE_SPLINES
+      case 5:
+#endif
+#ifdef ENABLE_CANNED_CYCLES
+      case 73:
+      case 81:
+      case 82:
+      case 83:
+#endif
         // 检查在同一块中调用 G10/28/30/92 时是否调用了 G0/1/2/3/38。
         // * G43.1 也是一个轴命令，但未显式定义为此。
         if (axis_command)
@@ -199,6 +932,13 @@ uint8_t gc_execute_line(char *line)
           gc_block.modal.motion += (mantissa / 10) + 100;
           mantissa = 0; // 设置为零以指示有效的非整数 G 命令。
         }
+#ifdef ENABLE_SPLINES
+        if ((int_value == 5) && (mantissa == 10))
+        { // G5.1
+          gc_block.modal.motion = MOTION_MODE_QUADRATIC_SPLINE;
+          mantissa = 0; // 设置为零以指示有效的非整数 G 命令。
+        }
+#endif
         break;
       case 17:
       case 18:
@@ -274,6 +1014,32 @@ uint8_t gc_execute_line(char *line)
         word_bit = MODAL_GROUP_G12;
         gc_block.modal.coord_select = int_value - 54; // 转换为数组索引。
         break;
+#ifdef ENABLE_CANNED_CYCLES
+      case 98:
+      case 99:
+        word_bit = MODAL_GROUP_G10;
+        gc_block.modal.retract = int_value - 98;
+        break;
+#endif
+#ifdef ENABLE_PATH_CONTROL_MODES
+      case 61:
+      case 64:
+        word_bit = MODAL_GROUP_G13;
+        if ((int_value == 61) && (mantissa == 10))
+        {
+          gc_block.modal.control = CONTROL_MODE_EXACT_STOP; // G61.1
+          mantissa = 0;                                     // 设置为零以指示有效的非整数 G 命令。
+        }
+        else if (int_value == 61)
+        {
+          gc_block.modal.control = CONTROL_MODE_EXACT_PATH;
+        }
+        else
+        {
+          gc_block.modal.control = CONTROL_MODE_CONTINUOUS;
+        }
+        break;
+#else
       case 61:
         word_bit = MODAL_GROUP_G13;
         if (mantissa != 0)
@@ -282,6 +1048,7 @@ uint8_t gc_execute_line(char *line)
         } // [不支持 G61.1]
         // gc_block.modal.control = CONTROL_MODE_EXACT_PATH; // G61
         break;
+#endif
       default:
         FAIL(STATUS_GCODE_UNSUPPORTED_COMMAND); // [不支持的 G 命令]
       }
@@ -323,6 +1090,12 @@ uint8_t gc_execute_line(char *line)
           gc_block.modal.program_flow = int_value; // 程序结束并复位
         }
         break;
+#ifdef ENABLE_MACRO
+      case 98:
+        word_bit = MODAL_GROUP_M4; // 与程序流程同组，不能与 M0/M2/M30 同行。
+        macro_call = true;
+        break;
+#endif
       case 3:
       case 4:
       case 5:
@@ -434,7 +1207,7 @@ uint8_t gc_execute_line(char *line)
         break;
       case 'L':
         word_bit = WORD_L;
-        gc_block.values.l = int_value;
+        gc_block.values.l = trunc(value);
         break;
       case 'N':
         word_bit = WORD_N;
@@ -445,7 +1218,12 @@ uint8_t gc_execute_line(char *line)
         gc_block.values.p = value;
         break;
       // 注意：对于某些命令，P 值必须为整数，但这些命令均不支持。
-      // case 'Q': // 不支持
+#if defined(ENABLE_CANNED_CYCLES) || defined(ENABLE_SPLINES)
+      case 'Q':
+        word_bit = WORD_Q;
+        gc_block.values.q = value;
+        break;
+#endif
       case 'R':
         word_bit = WORD_R;
         gc_block.values.r = value;
@@ -460,6 +1238,7 @@ uint8_t gc_execute_line(char *line)
         {
           FAIL(STATUS_GCODE_MAX_VALUE_EXCEEDED);
         }
+        int_value = trunc(value);
         // 如果刀号一样跳过换刀
         if (int_value == settings.tool)
         {
@@ -487,20 +1266,30 @@ uint8_t gc_execute_line(char *line)
       }
 
       // 注意：如果非命令字母有效，则始终会分配变量 'word_bit'。
-      if (bit_istrue(value_words, bit(word_bit)))
+      if (bit_istrue(value_words, word_mask(word_bit)))
       {
         FAIL(STATUS_GCODE_WORD_REPEATED);
       } // [字母重复]
-      // 检查字母 F、N、P、T 和 S 的负值无效
+      // 检查字母 F、L、N、P、Q、T 和 S 的负值无效
       // 注意：为提高代码效率，负值检查在此进行。
-      if (bit(word_bit) & (bit(WORD_F) | bit(WORD_N) | bit(WORD_P) | bit(WORD_T) | bit(WORD_S)))
+      if (word_mask(word_bit) & (bit(WORD_F) | bit(WORD_L) | bit(WORD_N) | bit(WORD_P) | word_mask(WORD_Q) | bit(WORD_T) | bit(WORD_S)))
       {
         if (value < 0.0)
         {
-          FAIL(STATUS_NEGATIVE_VALUE);
-        } // [字母值不能为负]
+#ifdef ENABLE_SPLINES
+          // G5 的 P、Q 是控制点偏移，可以为负。运动模式可能在行中更后面给出，解析完后再检查。
+          if (word_mask(word_bit) & (bit(WORD_P) | word_mask(WORD_Q)))
+          {
+            negative_pq = true;
+          }
+          else
+#endif
+          {
+            FAIL(STATUS_NEGATIVE_VALUE);
+          } // [字母值不能为负]
+        }
       }
-      value_words |= bit(word_bit); // 标记分配的参数。
+      value_words |= word_mask(word_bit); // 标记分配的参数。
     }
   }
   // 解析完成！
@@ -525,6 +1314,13 @@ uint8_t gc_execute_line(char *line)
 
   // [0. 非特定/常见错误检查及其他设置]：
 
+#ifdef ENABLE_SPLINES
+  if (negative_pq && (gc_block.modal.motion != MOTION_MODE_CUBIC_SPLINE))
+  {
+    FAIL(STATUS_NEGATIVE_VALUE);
+  } // [P/Q 不能为负]
+#endif
+
   // 确定隐式轴命令条件。传递了轴字，但未发送显式轴命令。如果是，则将轴命令设置为当前运动模式。
   if (axis_words)
   {
@@ -660,6 +1456,14 @@ uint8_t gc_execute_line(char *line)
       }
     }
   }
+#ifdef ENABLE_CANNED_CYCLES
+  // [固定循环]：记下平面内两轴和直线轴的程序值。下面换算目标位置后，G91 的孔距和 Z 仍需要它们。
+  float cycle_word_0 = gc_block.values.xyz[axis_0];
+  float cycle_word_1 = gc_block.values.xyz[axis_1];
+  float cycle_word_linear = gc_block.values.xyz[axis_linear];
+  float cycle_r = 0, cycle_z = 0;
+  gc_cycle_t cycle;
+#endif
 
   // [刀具半径补偿]：G41/42 不支持。若 G53 激活则报错
   // [G40 错误]：G40 后执行 G2/3 圆弧或在禁用后移动距离小于刀具直径
@@ -697,7 +1501,33 @@ uint8_t gc_execute_line(char *line)
     }
   }
 
-  // [路径控制模式设定]：仅支持 G61，不支持 G61.1 和 G64
+  // [路径控制模式设定]：
+#ifdef ENABLE_PATH_CONTROL_MODES
+  // [G64 错误]：P 为负。
+  // 注意：P 只随 G64 给出，不带 P 的 G64 与 G61 相同。
+  float path_tolerance = gc_state.path_tolerance;
+  if (bit_istrue(command_words, bit(MODAL_GROUP_G13)))
+  {
+    path_tolerance = 0.0;
+    if (gc_block.modal.control == CONTROL_MODE_EXACT_STOP)
+    {
+      path_tolerance = PL_PATH_EXACT_STOP;
+    }
+    else if ((gc_block.modal.control == CONTROL_MODE_CONTINUOUS) && (value_words & bit(WORD_P)))
+    {
+      if (gc_block.values.p < 0.0)
+      {
+        FAIL(STATUS_NEGATIVE_VALUE);
+      } // [P 不能为负]
+      path_tolerance = gc_block.values.p;
+      if (gc_block.modal.units == UNITS_MODE_INCHES)
+      {
+        path_tolerance *= MM_PER_INCH;
+      }
+      bit_false(value_words, bit(WORD_P));
+    }
+  }
+#endif
   // [距离模式设定]：仅支持 G91.1，不支持 G90.1
   // [缩回模式设定]：不支持
 
@@ -901,6 +1731,9 @@ uint8_t gc_execute_line(char *line)
   }
 
   // [20. 运动模式]：
+#ifdef ENABLE_SPLINES
+  float spline_control[4]; // G5/G5.1 两个控制点在 XY 平面内的机床坐标
+#endif
   if (gc_block.modal.motion == MOTION_MODE_NONE)
   {
     // [G80 错误]：在 G80 激活时，编程了轴字。
@@ -1134,11 +1967,192 @@ uint8_t gc_execute_line(char *line)
           FAIL(STATUS_GCODE_INVALID_TARGET);
         } // [Invalid target]
         break;
+#ifdef ENABLE_CANNED_CYCLES
+      case MOTION_MODE_DRILL_CHIP_BREAK:
+      case MOTION_MODE_DRILL_PECK:
+      case MOTION_MODE_DRILL_DWELL:
+      case MOTION_MODE_DRILL:
+        // [G73/G81/G82/G83 错误]：逆时间进给。无轴字或有平面外的轴字。R 或 Z 从未给定。R 平面低于孔底。
+        // G73/G83 的 Q 从未给定或为零。L 为零。
+        // 注意：R、Z、Q、P 是模态参数，从其他运动模式进入循环时清除。G91 下 R 相对循环开始时的高度，
+        // Z 相对 R 平面。
+        if (gc_block.modal.feed_rate == FEED_RATE_MODE_INVERSE_TIME)
+        {
+          FAIL(STATUS_GCODE_UNSUPPORTED_COMMAND);
+        } // [不支持 G93 固定循环]
+        if (!axis_words)
+        {
+          FAIL(STATUS_GCODE_NO_AXIS_WORDS);
+        } // [无轴字]
+        if (axis_words & ~(bit(axis_0) | bit(axis_1) | bit(axis_linear)))
+        {
+          FAIL(STATUS_GCODE_AXIS_WORDS_EXIST);
+        } // [平面外的轴字]
+        if (gc_is_canned_cycle(gc_state.modal.motion))
+        {
+          memcpy(&cycle, &gc_state.cycle, sizeof(gc_cycle_t));
+        }
+        else
+        {
+          memset(&cycle, 0, sizeof(gc_cycle_t));
+        }
+        if (gc_block.modal.units == UNITS_MODE_INCHES)
+        {
+          gc_block.values.r *= MM_PER_INCH;
+          gc_block.values.q *= MM_PER_INCH;
+        }
+        if (value_words & bit(WORD_R))
+        {
+          cycle.r = gc_block.values.r;
+          cycle.words |= CYCLE_WORD_R;
+        }
+        if (axis_words & bit(axis_linear))
+        {
+          cycle.z = cycle_word_linear;
+          cycle.words |= CYCLE_WORD_Z;
+        }
+        if ((cycle.words & (CYCLE_WORD_R | CYCLE_WORD_Z)) != (CYCLE_WORD_R | CYCLE_WORD_Z))
+        {
+          FAIL(STATUS_GCODE_VALUE_WORD_MISSING);
+        } // [R/Z 缺失]
+        bit_false(value_words, bit(WORD_R));
+        if ((gc_block.modal.motion == MOTION_MODE_DRILL_PECK) || (gc_block.modal.motion == MOTION_MODE_DRILL_CHIP_BREAK))
+        {
+          if (value_words & word_mask(WORD_Q))
+          {
+            cycle.q = gc_block.values.q;
+            cycle.words |= CYCLE_WORD_Q;
+          }
+          if (bit_isfalse(cycle.words, CYCLE_WORD_Q) || (cycle.q == 0.0))
+          {
+            FAIL(STATUS_GCODE_VALUE_WORD_MISSING);
+          } // [Q 缺失或为零]
+          bit_false(value_words, word_mask(WORD_Q));
+        }
+        if (gc_block.modal.motion == MOTION_MODE_DRILL_DWELL)
+        {
+          if (value_words & bit(WORD_P))
+          {
+            cycle.p = gc_block.values.p;
+          }
+          bit_false(value_words, bit(WORD_P));
+        }
+        if (value_words & bit(WORD_L))
+        {
+          if (gc_block.values.l == 0)
+          {
+            FAIL(STATUS_GCODE_UNSUPPORTED_COMMAND);
+          } // [不支持 L0]
+          bit_false(value_words, bit(WORD_L));
+        }
+        else
+        {
+          gc_block.values.l = 1;
+        }
+
+        // 把 R 平面和孔底换算为机床坐标。孔位已与其他运动一样换算在 gc_block.values.xyz 中。
+        if (gc_block.modal.distance == DISTANCE_MODE_ABSOLUTE)
+        {
+          cycle_r = block_coord_system[axis_linear] + gc_state.coord_offset[axis_linear];
+          if (axis_linear == TOOL_LENGTH_OFFSET_AXIS)
+          {
+            cycle_r += gc_state.tool_length_offset;
+          }
+          cycle_z = cycle_r + cycle.z;
+          cycle_r += cycle.r;
+          cycle_word_0 = 0; // 绝对模式下重复钻孔都在同一孔位
+          cycle_word_1 = 0;
+        }
+        else
+        {
+          cycle_r = gc_state.position[axis_linear] + cycle.r;
+          cycle_z = cycle_r + cycle.z;
+        }
+        if (cycle_r < cycle_z)
+        {
+          FAIL(STATUS_GCODE_INVALID_TARGET);
+        } // [R 平面低于孔底]
+        break;
+#endif
+#ifdef ENABLE_SPLINES
+      case MOTION_MODE_CUBIC_SPLINE:
+      case MOTION_MODE_QUADRATIC_SPLINE:
+        // [G5/G5.1 错误]：未选择 G17 平面。无轴字。G5 缺少 P 或 Q，或省略 I/J 但上一运动不是 G5。
+        // G5.1 缺少 I/J。
+        // 注意：缺少 I 或 J 之一时按零处理，与圆弧偏移相同。
+        if (gc_block.modal.plane_select != PLANE_SELECT_XY)
+        {
+          FAIL(STATUS_GCODE_UNSUPPORTED_COMMAND);
+        } // [样条只支持 G17]
+        if (!axis_words)
+        {
+          FAIL(STATUS_GCODE_NO_AXIS_WORDS);
+        } // [无轴字]
+        if (gc_block.modal.units == UNITS_MODE_INCHES)
+        {
+          gc_block.values.ijk[X_AXIS] *= MM_PER_INCH;
+          gc_block.values.ijk[Y_AXIS] *= MM_PER_INCH;
+          gc_block.values.p *= MM_PER_INCH;
+          gc_block.values.q *= MM_PER_INCH;
+        }
+        if (gc_block.modal.motion == MOTION_MODE_CUBIC_SPLINE)
+        {
+          if ((value_words & (bit(WORD_P) | word_mask(WORD_Q))) != (bit(WORD_P) | word_mask(WORD_Q)))
+          {
+            FAIL(STATUS_GCODE_VALUE_WORD_MISSING);
+          } // [P/Q 缺失]
+          bit_false(value_words, (bit(WORD_P) | word_mask(WORD_Q)));
+          if (!(ijk_words & (bit(X_AXIS) | bit(Y_AXIS))))
+          {
+            if (gc_state.modal.motion != MOTION_MODE_CUBIC_SPLINE)
+            {
+              FAIL(STATUS_GCODE_VALUE_WORD_MISSING);
+            } // [I/J 缺失]
+            gc_block.values.ijk[X_AXIS] = -gc_state.spline_offset[0];
+            gc_block.values.ijk[Y_AXIS] = -gc_state.spline_offset[1];
+          }
+          spline_control[0] = gc_state.position[X_AXIS] + gc_block.values.ijk[X_AXIS];
+          spline_control[1] = gc_state.position[Y_AXIS] + gc_block.values.ijk[Y_AXIS];
+          spline_control[2] = gc_block.values.xyz[X_AXIS] + gc_block.values.p;
+          spline_control[3] = gc_block.values.xyz[Y_AXIS] + gc_block.values.q;
+        }
+        else
+        {
+          if (!(ijk_words & (bit(X_AXIS) | bit(Y_AXIS))))
+          {
+            FAIL(STATUS_GCODE_VALUE_WORD_MISSING);
+          } // [I/J 缺失]
+          // 二次曲线升阶为三次：两个控制点分别在起点和终点到二次控制点的 2/3 处。
+          float control_x = gc_state.position[X_AXIS] + gc_block.values.ijk[X_AXIS];
+          float control_y = gc_state.position[Y_AXIS] + gc_block.values.ijk[Y_AXIS];
+          spline_control[0] = gc_state.position[X_AXIS] + (2.0 / 3.0) * gc_block.values.ijk[X_AXIS];
+          spline_control[1] = gc_state.position[Y_AXIS] + (2.0 / 3.0) * gc_block.values.ijk[Y_AXIS];
+          spline_control[2] = gc_block.values.xyz[X_AXIS] + (2.0 / 3.0) * (control_x - gc_block.values.xyz[X_AXIS]);
+          spline_control[3] = gc_block.values.xyz[Y_AXIS] + (2.0 / 3.0) * (control_y - gc_block.values.xyz[Y_AXIS]);
+        }
+        bit_false(value_words, (bit(WORD_I) | bit(WORD_J)));
+        break;
+#endif
       }
     }
   }
 
   // [21. 程序流程]: 不需要错误检查。
+#ifdef ENABLE_MACRO
+  // [宏调用]：P 字缺失、不是整数或超出宏编号时返回错误。
+  if (macro_call)
+  {
+    if (bit_isfalse(value_words, bit(WORD_P)))
+    {
+      FAIL(STATUS_GCODE_VALUE_WORD_MISSING);
+    } // P 字缺失
+    if ((gc_block.values.p < 0) || (gc_block.values.p >= N_MACRO) || (gc_block.values.p != trunc(gc_block.values.p)))
+    {
+      FAIL(STATUS_GCODE_MAX_VALUE_EXCEEDED);
+    }
+    bit_false(value_words, bit(WORD_P));
+  }
+#endif
 
   // [0. 非特定错误检查]: 完成未使用值字的检查，即在弧半径模式下使用 IJK，或在区块中未使用的轴字。
   if (gc_parser_flags & GC_PARSER_JOG_MOTION)
@@ -1152,7 +2166,7 @@ uint8_t gc_execute_line(char *line)
   }
   if (axis_command)
   {
-    bit_false(value_words, (bit(WORD_X) | bit(WORD_Y) | bit(WORD_Z) | bit(WORD_A) | bit(WORD_B) | bit(WORD_C) | bit(WORD_D)));
+    bit_false(value_words, (bit(WORD_X) | bit(WORD_Y) | bit(WORD_Z) | bit(WORD_A) | word_mask(WORD_B) | word_mask(WORD_C) | word_mask(WORD_D)));
   } // 移除轴字。
   if (value_words)
   {
@@ -1199,7 +2213,7 @@ uint8_t gc_execute_line(char *line)
   // 如果处于激光模式，根据当前和过去的解析器条件设置激光功率。
   if (bit_istrue(settings.flags, BITFLAG_LASER_MODE))
   {
-    if (!((gc_block.modal.motion == MOTION_MODE_LINEAR) || (gc_block.modal.motion == MOTION_MODE_CW_ARC) || (gc_block.modal.motion == MOTION_MODE_CCW_ARC)))
+    if (!gc_is_laser_motion(gc_block.modal.motion))
     {
       gc_parser_flags |= GC_PARSER_LASER_DISABLE;
     }
@@ -1216,7 +2230,7 @@ uint8_t gc_execute_line(char *line)
       // M3 恒定功率激光要求在没有运动的行中在 G1/2/3 运动模式状态和反之之间更新激光时进行计划同步。
       if (gc_state.modal.spindle == SPINDLE_ENABLE_CW)
       {
-        if ((gc_state.modal.motion == MOTION_MODE_LINEAR) || (gc_state.modal.motion == MOTION_MODE_CW_ARC) || (gc_state.modal.motion == MOTION_MODE_CCW_ARC))
+        if (gc_is_laser_motion(gc_state.modal.motion))
         {
           if (bit_istrue(gc_parser_flags, GC_PARSER_LASER_DISABLE))
           {
@@ -1234,6 +2248,17 @@ uint8_t gc_execute_line(char *line)
       }
     }
   }
+#ifdef ENABLE_PROGRAM_MODE
+  else if (sys.program_mode)
+  {
+    // 程序模式下，运动行上的主轴转速变化与激光模式一样随规划块传递，由步进模块在该运动开始时
+    // 更新 PWM，不必清空规划器。主轴方向变化（M3/M4/M5）仍然同步。
+    if (axis_words && (axis_command == AXIS_COMMAND_MOTION_MODE))
+    {
+      gc_parser_flags |= GC_PARSER_LASER_ISMOTION;
+    }
+  }
+#endif
 
   // [0. 非特定/通用错误检查和杂项设置]:
   // 注意：如果没有行号，值为零。
@@ -1295,7 +2320,9 @@ uint8_t gc_execute_line(char *line)
   pl_data->condition |= gc_state.modal.spindle; // 设置供计划使用的条件标志。
 
   // [8. 冷却液控制 ]:
-  if (gc_state.modal.coolant != gc_block.modal.coolant)
+  // 已开启的冷却液再次开启（如 M7 和 M8 都开启时的 M8）不改变状态，不必同步。
+  if ((gc_state.modal.coolant != gc_block.modal.coolant) &&
+      ((gc_block.modal.coolant == COOLANT_DISABLE) || ((gc_state.modal.coolant & gc_block.modal.coolant) != gc_block.modal.coolant)))
   {
     // 注意：冷却液 M 代码是模态的。每行仅允许一个命令。但是，可以同时存在多个状态，而冷却液禁用将清除所有状态。
     coolant_sync(gc_block.modal.coolant);
@@ -1354,13 +2381,22 @@ uint8_t gc_execute_line(char *line)
     system_flag_wco_change();
   }
 
-  // [16. 设置路径控制模式 ]: G61.1/G64 不支持
+  // [16. 设置路径控制模式 ]:
+#ifdef ENABLE_PATH_CONTROL_MODES
+  gc_state.modal.control = gc_block.modal.control;
+  gc_state.path_tolerance = path_tolerance;
+  pl_data->path_tolerance = path_tolerance;
+#else
   // gc_state.modal.control = gc_block.modal.control; // 注意：始终默认。
+#endif
 
   // [17. 设置距离模式 ]:
   gc_state.modal.distance = gc_block.modal.distance;
 
-  // [18. 设置回缩模式 ]: 不支持
+  // [18. 设置回缩模式 ]:
+#ifdef ENABLE_CANNED_CYCLES
+  gc_state.modal.retract = gc_block.modal.retract;
+#endif
 
   // [19. 前往预定义位置、设置 G10 或设置轴偏移 ]:
   switch (gc_block.non_modal_command)
@@ -1425,6 +2461,25 @@ uint8_t gc_execute_line(char *line)
         mc_arc(gc_block.values.xyz, pl_data, gc_state.position, gc_block.values.ijk, gc_block.values.r,
                axis_0, axis_1, axis_linear, bit_istrue(gc_parser_flags, GC_PARSER_ARC_IS_CLOCKWISE));
       }
+#ifdef ENABLE_SPLINES
+      else if ((gc_state.modal.motion == MOTION_MODE_CUBIC_SPLINE) || (gc_state.modal.motion == MOTION_MODE_QUADRATIC_SPLINE))
+      {
+        if (gc_state.modal.motion == MOTION_MODE_CUBIC_SPLINE)
+        {
+          gc_state.spline_offset[0] = gc_block.values.p;
+          gc_state.spline_offset[1] = gc_block.values.q;
+        }
+        mc_spline(gc_block.values.xyz, pl_data, gc_state.position, &spline_control[0], &spline_control[2], X_AXIS, Y_AXIS);
+      }
+#endif
+#ifdef ENABLE_CANNED_CYCLES
+      else if (gc_is_canned_cycle(gc_state.modal.motion))
+      {
+        memcpy(&gc_state.cycle, &cycle, sizeof(gc_cycle_t));
+        gc_execute_canned_cycle(gc_block.values.xyz, cycle_r, cycle_z, cycle_word_0, cycle_word_1, gc_block.values.l,
+                                axis_0, axis_1, axis_linear, pl_data);
+      }
+#endif
       else
       {
         // 注意：gc_block.values.xyz 是从 mc_probe_cycle 返回的，包含更新后的位置信息。
@@ -1503,13 +2558,21 @@ uint8_t gc_execute_line(char *line)
 
   // TODO: 使用 % 来表示程序开始。
 
+#ifdef ENABLE_MACRO
+  // [宏调用]：在本块的其余操作之后执行宏的各行。宏中的行会覆盖 gc_block，因此放在最后。
+  if (macro_call)
+  {
+    return (system_execute_macro(trunc(gc_block.values.p)));
+  }
+#endif
+
   return (STATUS_OK);
 }
 
 /*
   不支持的功能：
 
-  - 罐装循环
+  - 罐装循环（G73、G81-G83 及 G98/G99 为可选功能 *）
   - 刀具半径补偿
   - A,B,C 轴
   - 表达式求值
@@ -1520,12 +2583,12 @@ uint8_t gc_execute_line(char *line)
 
    (*) 表示可选参数，通过 config.h 启用并重新编译
    组 0 = {G92.2, G92.3}（非模态：取消和重新启用 G92 偏移）
-   组 1 = {G81 - G89}（运动模式：罐装循环）
+   组 1 = {G84 - G89}（运动模式：罐装循环，支持 G73、G81-G83 *）
    组 4 = {M1}（可选停止，忽略）
    组 6 = {M6}（刀具更换）
    组 7 = {G41, G42} 刀具半径补偿（支持 G40）
    组 8 = {G43} 刀具长度偏移（支持 G43.1/G49）
    组 9 = {M48, M49} 启用/禁用进给和速度覆盖开关
-   组 10 = {G98, G99} 返回模式罐装循环
-   组 13 = {G61.1, G64} 路径控制模式（支持 G61）
+   组 10 = {G98, G99} 返回模式罐装循环（*）
+   组 13 = {G61.1, G64} 路径控制模式（支持 G61，G61.1 和 G64 P 为可选功能 *）
 */
\ No newline at end of file
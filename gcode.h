@@ -27,7 +27,7 @@
 // 并且类似于其他制造商（Haas、Fanuc、Mazak 等）的 G 代码解析器。
 // 注意：模态组的定义值必须从零开始并按顺序排列。
 #define MODAL_GROUP_G0 0   // [G4, G10, G28, G28.1, G30, G30.1, G53, G92, G92.1] 非模态
-#define MODAL_GROUP_G1 1   // [G0, G1, G2, G3, G38.2, G38.3, G38.4, G38.5, G80] 运动
+#define MODAL_GROUP_G1 1   // [G0, G1, G2, G3, G5, G5.1, G38.2, G38.3, G38.4, G38.5, G73, G80, G81, G82, G83] 运动
 #define MODAL_GROUP_G2 2   // [G17, G18, G19] 平面选择
 #define MODAL_GROUP_G3 3   // [G90, G91] 距离模式
 #define MODAL_GROUP_G4 4   // [G91.1] 弧 IJK 距离模式
@@ -36,11 +36,12 @@
 #define MODAL_GROUP_G7 7   // [G40] 刀具半径补偿模式。G41/42 不支持。
 #define MODAL_GROUP_G8 8   // [G43.1, G49] 刀具长度补偿
 #define MODAL_GROUP_G12 9  // [G54, G55, G56, G57, G58, G59] 坐标系选择
-#define MODAL_GROUP_G13 10 // [G61] 控制模式
+#define MODAL_GROUP_G13 10 // [G61, G61.1, G64] 控制模式
 
 #define MODAL_GROUP_M4 11 // [M0, M1, M2, M30] 停止
 #define MODAL_GROUP_M7 12 // [M3, M4, M5] 主轴旋转
 #define MODAL_GROUP_M8 13 // [M7, M8, M9] 冷却控制
+#define MODAL_GROUP_G10 14 // [G98, G99] 固定循环返回模式
 
 // #define OTHER_INPUT_F 14
 // #define OTHER_INPUT_S 15
@@ -69,11 +70,17 @@
 #define MOTION_MODE_LINEAR 1                  // G1（不可更改值）
 #define MOTION_MODE_CW_ARC 2                  // G2（不可更改值）
 #define MOTION_MODE_CCW_ARC 3                 // G3（不可更改值）
+#define MOTION_MODE_CUBIC_SPLINE 5            // G5（不可更改值）
+#define MOTION_MODE_QUADRATIC_SPLINE 51       // G5.1
 #define MOTION_MODE_PROBE_TOWARD 140          // G38.2（不可更改值）
 #define MOTION_MODE_PROBE_TOWARD_NO_ERROR 141 // G38.3（不可更改值）
 #define MOTION_MODE_PROBE_AWAY 142            // G38.4（不可更改值）
 #define MOTION_MODE_PROBE_AWAY_NO_ERROR 143   // G38.5（不可更改值）
 #define MOTION_MODE_NONE 80                   // G80（不可更改值）
+#define MOTION_MODE_DRILL 81                  // G81（不可更改值）
+#define MOTION_MODE_DRILL_DWELL 82            // G82（不可更改值）
+#define MOTION_MODE_DRILL_PECK 83             // G83（不可更改值）
+#define MOTION_MODE_DRILL_CHIP_BREAK 73       // G73（不可更改值）
 
 // 模态组 G2：平面选择
 #define PLANE_SELECT_XY 0 // G17（默认：必须为零）
@@ -105,8 +112,14 @@
 // 模态组 G7：刀具半径补偿模式
 #define CUTTER_COMP_DISABLE 0 // G40（默认：必须为零）
 
+// 模态组 G10：固定循环返回模式
+#define RETRACT_MODE_INITIAL 0 // G98（默认：必须为零）
+#define RETRACT_MODE_R 1       // G99
+
 // 模态组 G13：控制模式
 #define CONTROL_MODE_EXACT_PATH 0 // G61（默认：必须为零）
+#define CONTROL_MODE_EXACT_STOP 1 // G61.1
+#define CONTROL_MODE_CONTINUOUS 2 // G64
 
 // 模态组 M7：主轴控制
 #define SPINDLE_DISABLE 0                           // M5（默认：必须为零）
@@ -144,6 +157,11 @@
 #define WORD_B 14
 #define WORD_C 15
 #define WORD_D 16
+#define WORD_Q 17
+
+// 数值字超过 16 个，value_words 为 32 位。编号大于 14 的字用 word_mask() 而不是 bit() 取掩码，
+// 因为 AVR 上 bit() 的结果是 16 位 int。
+#define word_mask(n) ((uint32_t)1 << (n))
 
 // 定义 G 代码解析器位置更新标志
 #define GC_UPDATE_POS_TARGET 0 // 必须为 0
@@ -184,10 +202,17 @@ typedef struct
   // uint8_t cutter_comp;  // {G40} 注意：不跟踪，仅支持默认值
   uint8_t tool_length;  // {G43.1,G49}
   uint8_t coord_select; // {G54,G55,G56,G57,G58,G59}
+#ifdef ENABLE_PATH_CONTROL_MODES
+  uint8_t control;      // {G61,G61.1,G64}
+#else
   // uint8_t control;      // {G61} 注意：不跟踪，仅支持默认值
+#endif
   uint8_t program_flow; // {M0,M1,M2,M30}
   uint8_t coolant;      // {M7,M8,M9}
   uint8_t spindle;      // {M3,M4,M5}
+#ifdef ENABLE_CANNED_CYCLES
+  uint8_t retract;      // {G98,G99}
+#endif
 } gc_modal_t;
 
 typedef struct
@@ -197,13 +222,28 @@ typedef struct
   uint8_t l;         // G10 或循环参数
   int32_t n;         // 行号
   float p;           // G10 或延时参数
-  // float q;      // G82 挖槽钻孔
+  float q;           // G83/G73 每次啄钻深度，G5 第二控制点偏移
   float r;           // 弧半径
   float s;           // 主轴转速
   uint8_t t;         // 工具选择
   float xyz[N_AXIS]; // X、Y、Z 平移轴
 } gc_values_t;
 
+#ifdef ENABLE_CANNED_CYCLES
+// 固定循环的模态参数。R 和 Z 为程序值（已换算为 mm），由每个循环块按当前坐标系和距离模式换算。
+#define CYCLE_WORD_R bit(0)
+#define CYCLE_WORD_Z bit(1)
+#define CYCLE_WORD_Q bit(2)
+typedef struct
+{
+  float r;       // R 平面
+  float z;       // 孔底
+  float q;       // 每次啄钻深度
+  float p;       // 孔底暂停秒数
+  uint8_t words; // 已给定的参数，CYCLE_WORD_*。从其他运动模式进入循环时清除。
+} gc_cycle_t;
+#endif
+
 typedef struct
 {
   gc_modal_t modal;
@@ -218,6 +258,15 @@ typedef struct
   float coord_system[N_AXIS]; // 当前工作坐标系 (G54+)。存储相对于绝对机床位置的偏移量（以 mm 为单位），在调用时从 EEPROM 加载。
   float coord_offset[N_AXIS]; // 保留 G92 坐标偏移（工作坐标）相对于机床零点的偏移量（以 mm 为单位），非持久性。在复位和启动时清除。
   float tool_length_offset;   // 跟踪启用时的工具长度偏移值。
+#ifdef ENABLE_CANNED_CYCLES
+  gc_cycle_t cycle; // 固定循环的模态参数
+#endif
+#ifdef ENABLE_PATH_CONTROL_MODES
+  float path_tolerance; // 运动传给规划器的 path_tolerance，由 G61/G61.1/G64 P 决定
+#endif
+#ifdef ENABLE_SPLINES
+  float spline_offset[2]; // 上一个 G5 块的 P、Q（mm），省略 I/J 的 G5 取其反向
+#endif
 } parser_state_t;
 extern parser_state_t gc_state;
 
@@ -234,7 +283,27 @@ void gc_init();
 // 执行一行 rs275/ngc/g-code
 uint8_t gc_execute_line(char *line);
 
+// 流式分词时每行最多缓存的字数。超过时改为按行缓冲区解析。
+#define GC_MAX_WORDS 32
+
+// 开始对新的一行分词。
+void gc_tokenize_reset();
+
+// 加入一个已过滤（大写、无空白和注释）的字符。主循环在字符到达时调用。
+void gc_tokenize_char(char c);
+
+// 执行已分词的一行。line 为同一行的行缓冲区，分词缓冲区溢出时按它解析。
+uint8_t gc_execute_tokens(char *line);
+
 // 设置 G 代码解析器位置，输入为步进。
 void gc_sync_position();
 
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  // 由 mc_line() 在块缓冲区已满时调用，summary 为 plan_summary_begin() 对等待中的运动 target 的结果。
+  void gc_preview_begin(uint8_t summary, float *target);
+
+  // 等待期间反复调用，每次把接收缓冲区中的一行预读为规划器第二级前瞻的摘要。
+  void gc_preview_lines();
+#endif
+
 #endif
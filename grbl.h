@@ -58,7 +58,9 @@
 #include "spindle_control.h"
 #include "stepper.h"
 #include "jog.h"
+#include "frame.h"
 #include "sleep.h"
+#include "status_push.h"
 
 // ---------------------------------------------------------------------------------------
 // 编译时对定义值进行错误检查：
@@ -73,6 +75,10 @@
   #endif
 #endif
 
+#if defined(ENABLE_NATIVE_ARCS) && defined(COREXY)
+  #error "ENABLE_NATIVE_ARCS 不支持 COREXY。"
+#endif
+
 #if defined(SPINDLE_PWM_MIN_VALUE)
   #if !(SPINDLE_PWM_MIN_VALUE > 0)
     #error "SPINDLE_PWM_MIN_VALUE 必须大于零。"
@@ -126,11 +126,13 @@ int main(void)
     sys_rt_exec_state = 0;
     sys_rt_exec_alarm = 0;
     sys_rt_exec_motion_override = 0;
+    sys_rt_feed_ovr_delta = 0;
     sys_rt_exec_accessory_override = 0;
 
     // 重置 Grbl 主要系统。
     serial_reset_read_buffer(); // 清除串行读取缓冲区
     gc_init();                  // 将 G-code 解析器设置为默认状态
+    mc_arc_reset();             // 丢弃未展开完的圆弧
     spindle_init();
     coolant_init();
     limits_init();
@@ -139,6 +141,9 @@ int main(void)
     tool_control_init();
     probe_init();
     sleep_init();
+#ifdef ENABLE_STATUS_PUSH
+    status_push_init();
+#endif
     plan_reset(); // 清除块缓冲区和规划器变量
     st_reset();   // 清除步进电机子系统变量。
 
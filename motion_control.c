@@ -18,6 +18,66 @@
 
 #include "grbl.h"
 
+// 步数超过 PLAN_BLOCK_MAX_STEPS 的运动不能存为一个规划块（每毫米 320 步时长约 52 米）。直线从规划器位置
+// 等分为几段，圆弧按 mc_arc_begin() 展开为直线段，各段再经 mc_line() 送入规划器。
+static void mc_line_split(float *target, plan_line_data_t *pl_data)
+{
+  float position[N_AXIS], point[N_AXIS];
+  plan_line_data_t piece_data;
+  uint16_t pieces = 1, n;
+  uint8_t idx;
+  plan_get_planner_mpos(position);
+  memcpy(&piece_data, pl_data, sizeof(plan_line_data_t));
+#ifdef ENABLE_NATIVE_ARCS
+  if (pl_data->arc_travel != 0.0)
+  {
+    float offset[N_AXIS] = {0.0};
+    offset[pl_data->arc_axis_0] = pl_data->arc_offset[0];
+    offset[pl_data->arc_axis_1] = pl_data->arc_offset[1];
+    pieces = mc_arc_begin(target, position, offset, hypot(pl_data->arc_offset[0], pl_data->arc_offset[1]),
+                          pl_data->arc_travel, pl_data->arc_axis_0, pl_data->arc_axis_1);
+    piece_data.arc_travel = 0.0;
+  }
+  else
+#endif
+  {
+    // 每段的步数留有余量，单精度的位置舍入不会使其超出。
+    for (idx = 0; idx < N_AXIS; idx++)
+    {
+      pieces = max(pieces, ceil(fabs(target[idx] - position[idx]) * settings.steps_per_mm[idx] / (0.5 * PLAN_BLOCK_MAX_STEPS)));
+    }
+  }
+  if (piece_data.condition & PL_COND_FLAG_INVERSE_TIME)
+  {
+    piece_data.feed_rate *= pieces; // 各段时间为总时间的 1/pieces。
+  }
+  for (n = 1; n <= pieces; n++)
+  {
+#ifdef ENABLE_NATIVE_ARCS
+    if (pl_data->arc_travel != 0.0)
+    {
+      mc_arc_next(point);
+    }
+    else
+#endif
+    {
+      for (idx = 0; idx < N_AXIS; idx++)
+      {
+        point[idx] = (n == pieces) ? target[idx] : position[idx] + (target[idx] - position[idx]) * n / pieces;
+      }
+    }
+    mc_line(point, &piece_data);
+    if (sys.abort)
+    {
+      return;
+    }
+#ifdef ENABLE_PATH_CONTROL_MODES
+    piece_data.path_tolerance = 0.0; // 只有与上一程序段的连接按路径控制模式。
+#endif
+  }
+}
+
+
 // 执行绝对毫米坐标的线性运动。给出的进给速率以毫米/秒为单位，
 // 除非 invert_feed_rate 为真。然后，feed_rate 意味着运动应该在
 // (1 分钟)/feed_rate 的时间内完成。
@@ -59,6 +119,9 @@ void mc_line(float *target, plan_line_data_t *pl_data)
 
   // 如果缓冲区已满：很好！这意味着我们在机器人前面。
   // 在此循环中保持，直到缓冲区中有空间。
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  uint8_t summary_begun = false;
+#endif
   do
   {
     protocol_execute_realtime(); // 检查任何运行时命令
@@ -69,6 +132,15 @@ void mc_line(float *target, plan_line_data_t *pl_data)
     if (plan_check_full_buffer())
     {
       protocol_auto_cycle_start();
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+      // 等待期间把这一运动和接收缓冲区中其后的行作为第二级前瞻，延长反向计算的减速距离。
+      if (!summary_begun)
+      {
+        gc_preview_begin(plan_summary_begin(target, pl_data), target);
+        summary_begun = true;
+      }
+      gc_preview_lines();
+#endif
     } // 当缓冲区满时自动循环开始。
     else
     {
@@ -77,8 +149,136 @@ void mc_line(float *target, plan_line_data_t *pl_data)
   } while (1);
 
   // 将运动计划并排入规划器缓冲区
-  // uint8_t plan_status; // 在正常操作中未使用。
-  plan_buffer_line(target, pl_data);
+  if (plan_buffer_line(target, pl_data) == PLAN_LONG_LINE)
+  {
+    mc_line_split(target, pl_data);
+  }
+}
+
+// 圆弧插补器状态。mc_arc() 展开的圆弧可跨多次调用送入规划器，因此状态保存在这里。
+static struct
+{
+  float center[2];
+  float r[2];              // 从圆心到当前段终点的半径向量
+  float anchor[2];         // 每 N_ARC_CORRECTION 段精确旋转一次的半径向量，用于消除漂移
+  float cos_T, sin_T;      // 每段的旋转
+  float cos_N, sin_N;      // 每 N_ARC_CORRECTION 段的旋转
+  float position[N_AXIS];  // 当前段终点
+  float increment[N_AXIS]; // 平面外各轴每段的增量
+  float target[N_AXIS];
+  uint16_t segments; // 剩余段数（含终点段），0 表示没有待展开的圆弧
+  uint8_t count;
+  uint8_t axis_0, axis_1;
+  uint8_t linear_axes; // 平面外需要移动的轴
+  plan_line_data_t pl_data;
+} arc;
+
+uint16_t mc_arc_begin(float *target, float *position, float *offset, float radius, float angular_travel,
+                      uint8_t axis_0, uint8_t axis_1)
+{
+  uint16_t segments = floor(fabs(0.5 * angular_travel * radius) /
+                            sqrt(settings.arc_tolerance * (2 * radius - settings.arc_tolerance)));
+  if (segments == 0)
+  {
+    segments = 1; // 只有终点段
+  }
+  float theta_per_segment = angular_travel / segments;
+
+  /* 通过变换矩阵进行向量旋转：r 是原始向量，r_T 是旋转后的向量，
+     phi 是旋转角度。解决方案来自 Jens Geisler。
+         r_T = [cos(phi) -sin(phi);
+                sin(phi)  cos(phi)] * r ;
+
+     对于弧生成，圆心是旋转轴，半径向量是从圆心到初始位置的定义。每个线段通过连续的
+     向量旋转形成，每段只需 4 次乘法。单精度的舍入和下面小角度近似的误差会随段数累积，
+     因此另有一个锚点向量每 N_ARC_CORRECTION 段按 N_ARC_CORRECTION * theta_per_segment
+     精确旋转一次，并替换当前半径向量。锚点的旋转矩阵只在圆弧开始时计算一次 sin() 和 cos()，
+     之后的修正与普通旋转一样只需 4 次乘法，不再每次修正都计算三角函数（每次约 375 微秒）。
+     锚点本身的漂移比逐段旋转慢 N_ARC_CORRECTION 倍，最后一段总是精确到达目标。
+
+     小角度近似的三阶近似（二阶 sin() 的误差太大）适用于大多数，甚至所有 CNC 应用。只有非常大
+     的弧公差设置，对于 CNC 应用来说是不现实的，才会使 theta_per_segment 大到在两次修正之间累积
+     可见的误差。
+  */
+  // 计算：cos_T = 1 - theta_per_segment^2 / 2，sin_T = theta_per_segment - theta_per_segment^3 / 6，在约 52 微秒内
+  arc.cos_T = 2.0 - theta_per_segment * theta_per_segment;
+  arc.sin_T = theta_per_segment * 0.16666667 * (arc.cos_T + 4.0);
+  arc.cos_T *= 0.5;
+  if (segments > N_ARC_CORRECTION)
+  {
+    arc.cos_N = cos(N_ARC_CORRECTION * theta_per_segment);
+    arc.sin_N = sin(N_ARC_CORRECTION * theta_per_segment);
+  }
+
+  arc.center[0] = position[axis_0] + offset[axis_0];
+  arc.center[1] = position[axis_1] + offset[axis_1];
+  arc.r[0] = arc.anchor[0] = -offset[axis_0];
+  arc.r[1] = arc.anchor[1] = -offset[axis_1];
+  arc.axis_0 = axis_0;
+  arc.axis_1 = axis_1;
+  arc.linear_axes = 0;
+  uint8_t idx;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    // 所有平面外的轴（包括 A-D 旋转轴）与螺旋轴一样随圆弧线性移动。
+    arc.increment[idx] = (target[idx] - position[idx]) / segments;
+    if ((idx != axis_0) && (idx != axis_1) && (arc.increment[idx] != 0.0))
+    {
+      arc.linear_axes |= bit(idx);
+    }
+  }
+  memcpy(arc.position, position, sizeof(arc.position));
+  memcpy(arc.target, target, sizeof(arc.target));
+  arc.count = 0;
+  arc.segments = segments;
+  return (segments);
+}
+
+uint8_t mc_arc_next(float *point)
+{
+  if (arc.segments == 0)
+  {
+    return (false);
+  }
+  if (--arc.segments == 0)
+  {
+    // 确保最后一段到达目标位置。
+    memcpy(point, arc.target, sizeof(arc.target));
+    return (true);
+  }
+
+  float r_axisi;
+  if (++arc.count < N_ARC_CORRECTION)
+  {
+    // 应用向量旋转矩阵。约 40 微秒
+    r_axisi = arc.r[0] * arc.sin_T + arc.r[1] * arc.cos_T;
+    arc.r[0] = arc.r[0] * arc.cos_T - arc.r[1] * arc.sin_T;
+    arc.r[1] = r_axisi;
+  }
+  else
+  {
+    // 对半径向量进行弧修正：锚点精确旋转 N_ARC_CORRECTION 段并替换当前半径向量。约 40 微秒
+    r_axisi = arc.anchor[0] * arc.sin_N + arc.anchor[1] * arc.cos_N;
+    arc.anchor[0] = arc.anchor[0] * arc.cos_N - arc.anchor[1] * arc.sin_N;
+    arc.anchor[1] = r_axisi;
+    arc.r[0] = arc.anchor[0];
+    arc.r[1] = arc.anchor[1];
+    arc.count = 0;
+  }
+
+  // 更新弧目标位置
+  arc.position[arc.axis_0] = arc.center[0] + arc.r[0];
+  arc.position[arc.axis_1] = arc.center[1] + arc.r[1];
+  uint8_t idx;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    if (bit_istrue(arc.linear_axes, bit(idx)))
+    {
+      arc.position[idx] += arc.increment[idx];
+    }
+  }
+  memcpy(point, arc.position, sizeof(arc.position));
+  return (true);
 }
 
 // 执行偏移模式格式的弧线。position == 当前 xyz，target == 目标 xyz，
@@ -115,99 +315,175 @@ void mc_arc(float *target, plan_line_data_t *pl_data, float *position, float *of
     }
   }
 
+#ifdef ENABLE_NATIVE_ARCS
+  // 圆弧作为一个规划块，由步进段准备沿圆弧插补。中间点不经过 mc_line()，软限位还需检查圆弧经过的
+  // 象限点（平面轴的极值点），其他轴线性移动，极值在两端。
+  if (bit_istrue(settings.flags, BITFLAG_SOFT_LIMIT_ENABLE) && (sys.state != STATE_JOG))
+  {
+    float start_angle = atan2(-offset[axis_1], -offset[axis_0]);
+    float point[N_AXIS];
+    memcpy(point, target, sizeof(point));
+    uint8_t quadrant;
+    for (quadrant = 0; quadrant < 4; quadrant++)
+    {
+      // 从起点沿运动方向到该象限点的角度，归一化到 [0, 2pi)。
+      float angle = quadrant * (0.5 * M_PI) - start_angle;
+      if (is_clockwise_arc)
+      {
+        angle = -angle;
+      }
+      angle = fmod(angle, 2 * M_PI);
+      if (angle < 0.0)
+      {
+        angle += 2 * M_PI;
+      }
+      if (angle < fabs(angular_travel))
+      {
+        point[axis_0] = center_axis0 + ((quadrant == 0) ? radius : ((quadrant == 2) ? -radius : 0.0));
+        point[axis_1] = center_axis1 + ((quadrant == 1) ? radius : ((quadrant == 3) ? -radius : 0.0));
+        limits_soft_check(point);
+        if (sys.abort)
+        {
+          return;
+        }
+      }
+    }
+  }
+  pl_data->arc_travel = angular_travel;
+  pl_data->arc_offset[0] = offset[axis_0];
+  pl_data->arc_offset[1] = offset[axis_1];
+  pl_data->arc_axis_0 = axis_0;
+  pl_data->arc_axis_1 = axis_1;
+  mc_line(target, pl_data);
+  pl_data->arc_travel = 0.0;
+#else
   // 注意：段的端点位于弧上，这可能导致弧的直径减小，最多可达到
   // (2x) settings.arc_tolerance。对于 99% 的用户，这完全可以。如果需要不同的弧段拟合
   // ，即最小二乘，弧中的中点，只需更改 mm_per_arc_segment 的计算。
   // 对于 Grbl 的预期用途，此值在最严格的情况下不应超过 2000。
-  uint16_t segments = floor(fabs(0.5 * angular_travel * radius) /
-                            sqrt(settings.arc_tolerance * (2 * radius - settings.arc_tolerance)));
+  uint16_t segments = mc_arc_begin(target, position, offset, radius, angular_travel, axis_0, axis_1);
+
+  // 乘以逆进给速率以补偿此运动由多个离散段近似的事实。各段等长，每段时间为总时间的
+  // 1/segments，逆时间模式保持不变。
+  memcpy(&arc.pl_data, pl_data, sizeof(plan_line_data_t));
+  if (arc.pl_data.condition & PL_COND_FLAG_INVERSE_TIME)
+  {
+    arc.pl_data.feed_rate *= segments;
+  }
+  // 规划器有空间时立即送入各段，其余由主循环在接收下一行的同时继续展开。
+  mc_arc_continue();
+#endif
+}
 
-  if (segments)
+void mc_arc_continue()
+{
+  float point[N_AXIS];
+  while (arc.segments && !plan_check_full_buffer())
   {
-    // 乘以逆进给速率以补偿此运动由多个离散段近似的事实。逆进给速率应该对所有段的总和是正确的。
+    mc_arc_next(point);
+    mc_line(point, &arc.pl_data);
+    if (sys.abort)
+    {
+      return;
+    }
+#ifdef ENABLE_PATH_CONTROL_MODES
+    arc.pl_data.path_tolerance = 0.0; // 只有与上一程序段的连接按路径控制模式，圆弧内部各段按 $11。
+#endif
+  }
+}
+
+void mc_arc_finish()
+{
+  while (arc.segments)
+  {
+    mc_arc_continue();
+    if (sys.abort)
+    {
+      return;
+    }
+    if (arc.segments)
+    {
+      // 规划器已满：与 mc_line() 相同，启动循环并等待空间，期间处理运行时命令。
+      protocol_auto_cycle_start();
+      protocol_execute_realtime();
+      if (sys.abort)
+      {
+        return;
+      }
+    }
+  }
+}
+
+void mc_arc_reset()
+{
+  arc.segments = 0;
+}
+
+#ifdef ENABLE_SPLINES
+// 执行三次贝塞尔曲线 B(t)，起点为 position，终点为 target，控制点为 control_0 和 control_1。
+// 参数步长为 h 的弦与曲线的最大距离不超过 h^2/8 * max|B''|，而 B'' 沿 t 线性变化，最大值在两端，
+// 因此按 settings.arc_tolerance 可直接求出段数。各段端点用 Horner 法按多项式求值，不累积误差。
+void mc_spline(float *target, plan_line_data_t *pl_data, float *position, float *control_0, float *control_1,
+               uint8_t axis_0, uint8_t axis_1)
+{
+  // B(t) = P0 + a*t + b*t^2 + c*t^3
+  float a_0 = 3.0 * (control_0[0] - position[axis_0]);
+  float a_1 = 3.0 * (control_0[1] - position[axis_1]);
+  float b_0 = 3.0 * (control_1[0] - 2.0 * control_0[0] + position[axis_0]);
+  float b_1 = 3.0 * (control_1[1] - 2.0 * control_0[1] + position[axis_1]);
+  float c_0 = target[axis_0] - position[axis_0] - a_0 - b_0;
+  float c_1 = target[axis_1] - position[axis_1] - a_1 - b_1;
+
+  // |B''(0)| = 2|b|，|B''(1)| = 2|b + 3c|
+  float curvature = 2.0 * max(hypot_f(b_0, b_1), hypot_f(b_0 + 3.0 * c_0, b_1 + 3.0 * c_1));
+  float n = ceil(sqrt(curvature / (8.0 * settings.arc_tolerance)));
+  uint16_t segments = (n < 65535.0) ? n : 65535;
+
+  if (segments > 1)
+  {
+    // 与圆弧相同：逆时间进给按段数放大并保持逆时间模式，每段时间为总时间的 1/segments。
     if (pl_data->condition & PL_COND_FLAG_INVERSE_TIME)
     {
       pl_data->feed_rate *= segments;
-      bit_false(pl_data->condition, PL_COND_FLAG_INVERSE_TIME); // 强制为绝对进给模式，适用于弧段。
     }
 
-    float theta_per_segment = angular_travel / segments;
-    float linear_per_segment = (target[axis_linear] - position[axis_linear]) / segments;
-
-    /* 通过变换矩阵进行向量旋转：r 是原始向量，r_T 是旋转后的向量，
-       phi 是旋转角度。解决方案来自 Jens Geisler。
-           r_T = [cos(phi) -sin(phi);
-                  sin(phi)  cos(phi)] * r ;
-
-       对于弧生成，圆心是旋转轴，半径向量是
-       从圆心到初始位置的定义。每个线段通过连续的
-       向量旋转形成。在极少数情况下，单精度值可能会累积大于工具精度的误差。
-       因此，实现了精确的弧路径修正。该方法避免了过多非常
-       计算昂贵的三角函数操作 [sin()、cos()、tan()]，每次计算可能需要 100-200 微秒。
-
-       小角度近似可以进一步减少计算开销。三阶近似
-       （二阶 sin() 的误差太大）适用于大多数，甚至所有 CNC 应用。注意，当 theta_per_segment 大于
-       ~0.25 弧度（14 度）且该近似在没有修正的情况下连续使用几十次时，
-       该近似将开始累积数值漂移误差。这种情况极不可能发生，因为段长度和 theta_per_segment 是自动生成
-       并由弧公差设置缩放的。只有非常大的弧公差设置，对于 CNC
-       应用来说是不现实的，才会导致这种数值漂移误差。然而，最好将 N_ARC_CORRECTION 设置在
-       低约 4 到高约 20 之间，以避免三角函数操作，同时保持弧生成的准确性。
-
-       该近似还允许 mc_arc 立即将线段插入到规划器中
-       而无需计算 cos() 或 sin() 的初始开销。到弧需要应用
-       修正时，规划器应该已赶上因初始 mc_arc 开销造成的滞后。
-       当存在连续的弧运动时，这一点很重要。
-    */
-    // 计算：cos_T = 1 - theta_per_segment^2 / 2，sin_T = theta_per_segment - theta_per_segment^3 / 6，在约 52 微秒内
-    float cos_T = 2.0 - theta_per_segment * theta_per_segment;
-    float sin_T = theta_per_segment * 0.16666667 * (cos_T + 4.0);
-    cos_T *= 0.5;
-
-    float sin_Ti;
-    float cos_Ti;
-    float r_axisi;
-    uint16_t i;
-    uint8_t count = 0;
+    float start_0 = position[axis_0];
+    float start_1 = position[axis_1];
+    float linear_per_segment[N_AXIS];
+    uint8_t idx;
+    for (idx = 0; idx < N_AXIS; idx++)
+    {
+      linear_per_segment[idx] = (target[idx] - position[idx]) / segments;
+    }
 
+    float t_per_segment = 1.0 / segments;
+    uint16_t i;
     for (i = 1; i < segments; i++)
-    { // 增量（segments - 1）。
-
-      if (count < N_ARC_CORRECTION)
-      {
-        // 应用向量旋转矩阵。约 40 微秒
-        r_axisi = r_axis0 * sin_T + r_axis1 * cos_T;
-        r_axis0 = r_axis0 * cos_T - r_axis1 * sin_T;
-        r_axis1 = r_axisi;
-        count++;
-      }
-      else
+    {
+      float t = i * t_per_segment;
+      for (idx = 0; idx < N_AXIS; idx++)
       {
-        // 对半径向量进行弧修正。仅每 N_ARC_CORRECTION 次增量计算一次。约 375 微秒
-        // 通过将变换矩阵应用于初始半径向量（=-offset）来计算确切位置。
-        cos_Ti = cos(i * theta_per_segment);
-        sin_Ti = sin(i * theta_per_segment);
-        r_axis0 = -offset[axis_0] * cos_Ti + offset[axis_1] * sin_Ti;
-        r_axis1 = -offset[axis_0] * sin_Ti - offset[axis_1] * cos_Ti;
-        count = 0;
+        position[idx] += linear_per_segment[idx];
       }
-
-      // 更新弧目标位置
-      position[axis_0] = center_axis0 + r_axis0;
-      position[axis_1] = center_axis1 + r_axis1;
-      position[axis_linear] += linear_per_segment;
+      position[axis_0] = start_0 + ((c_0 * t + b_0) * t + a_0) * t;
+      position[axis_1] = start_1 + ((c_1 * t + b_1) * t + a_1) * t;
 
       mc_line(position, pl_data);
 
-      // 在系统中止时中断圆弧。运行时命令检查已由 mc_line 执行。
+      // 在系统中止时中断曲线。运行时命令检查已由 mc_line 执行。
       if (sys.abort)
       {
         return;
       }
+#ifdef ENABLE_PATH_CONTROL_MODES
+      pl_data->path_tolerance = 0.0; // 与圆弧相同，曲线内部各段按 $11。
+#endif
     }
   }
   // 确保最后一段到达目标位置。
   mc_line(target, pl_data);
 }
+#endif
 
 // 执行秒数的停留。
 void mc_dwell(float seconds)
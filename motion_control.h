@@ -36,6 +36,27 @@ void mc_line(float *target, plan_line_data_t *pl_data);
 void mc_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset, float radius,
   uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear, uint8_t is_clockwise_arc);
 
+// 展开为直线段的圆弧在规划器已满时不阻塞，mc_arc() 送入能放下的段后即返回。mc_arc_continue()
+// 在规划器有空间时继续送入，不阻塞；mc_arc_finish() 阻塞直到所有段都已送入。执行下一行或同步
+// 缓冲区之前必须调用 mc_arc_finish()。mc_arc_reset() 在系统复位时丢弃未送完的段。
+void mc_arc_continue();
+void mc_arc_finish();
+void mc_arc_reset();
+
+// 圆弧插补器。mc_arc_begin() 按 settings.arc_tolerance 把 axis_0/axis_1 平面内逆时针转过
+// angular_travel 的圆弧分段，返回段数；其他所有轴随之线性移动。之后每次调用 mc_arc_next()
+// 得到下一段的终点，最后一段为 target，全部给出后返回 false。
+uint16_t mc_arc_begin(float *target, float *position, float *offset, float radius, float angular_travel,
+  uint8_t axis_0, uint8_t axis_1);
+uint8_t mc_arc_next(float *point);
+
+#ifdef ENABLE_SPLINES
+// 执行三次贝塞尔曲线。position == 当前位置，target == 目标位置，control_0 和 control_1 为两个控制点
+// 在 axis_0/axis_1 平面内的坐标。曲线按 settings.arc_tolerance 细分为直线段，其他轴随之线性移动。
+void mc_spline(float *target, plan_line_data_t *pl_data, float *position, float *control_0, float *control_1,
+  uint8_t axis_0, uint8_t axis_1);
+#endif
+
 // 停留特定的秒数
 void mc_dwell(float seconds);
 
@@ -19,8 +19,6 @@
 
 #include "grbl.h"
 
-#define MAX_INT_DIGITS 8 // int32（和 float）中的最大数字位数
-
 // 从字符串中提取浮点值。以下代码大致基于
 // avr-libc strtod() 函数，由 Michael Stumpf 和 Dmitry Xmelkov 编写，以及许多可自由获取的
 // 转换方法示例，但已针对 Grbl 进行了高度优化。对于已知的
@@ -46,34 +44,60 @@ uint8_t read_float(char *line, uint8_t *char_counter, float *float_ptr)
   }
 
   // 将数字提取到快速整数中。跟踪小数的指数值。
-  uint32_t intval = 0;
-  int8_t exp = 0;
-  uint8_t ndigit = 0;
-  bool isdecimal = false;
-  while(1) {
-    c -= '0';
-    if (c <= 9) {
-      ndigit++;
-      if (ndigit <= MAX_INT_DIGITS) {
-        if (isdecimal) { exp--; }
-        intval = (((intval << 2) + intval) << 1) + c; // intval*10 + c
-      } else {
-        if (!(isdecimal)) { exp++; }  // 丢弃溢出位
-      }
-    } else if (c == (('.'-'0') & 0xff)  &&  !(isdecimal)) {
-      isdecimal = true;
+  float_reader_t reader;
+  float_reader_init(&reader);
+  while (float_reader_char(&reader, c)) { c = *ptr++; }
+
+  // 如果没有读取到数字，则返回。
+  if (!reader.ndigit) { return(false); };
+
+  // 用正确的符号分配浮点值。
+  if (isnegative) {
+    *float_ptr = -float_reader_value(&reader);
+  } else {
+    *float_ptr = float_reader_value(&reader);
+  }
+
+  *char_counter = ptr - line - 1; // 将 char_counter 设置为下一个语句
+
+  return(true);
+}
+
+
+void float_reader_init(float_reader_t *reader)
+{
+  reader->intval = 0;
+  reader->exp = 0;
+  reader->ndigit = 0;
+  reader->isdecimal = false;
+}
+
+
+uint8_t float_reader_char(float_reader_t *reader, uint8_t c)
+{
+  c -= '0';
+  if (c <= 9) {
+    reader->ndigit++;
+    if (reader->ndigit <= MAX_INT_DIGITS) {
+      if (reader->isdecimal) { reader->exp--; }
+      reader->intval = (((reader->intval << 2) + reader->intval) << 1) + c; // intval*10 + c
     } else {
-      break;
+      if (!(reader->isdecimal)) { reader->exp++; }  // 丢弃溢出位
     }
-    c = *ptr++;
+  } else if (c == (('.'-'0') & 0xff)  &&  !(reader->isdecimal)) {
+    reader->isdecimal = true;
+  } else {
+    return(false);
   }
+  return(true);
+}
 
-  // 如果没有读取到数字，则返回。
-  if (!ndigit) { return(false); };
 
+float float_reader_value(float_reader_t *reader)
+{
   // 将整数转换为浮点数。
-  float fval;
-  fval = (float)intval;
+  float fval = (float)reader->intval;
+  int8_t exp = reader->exp;
 
   // 应用小数。对于预期范围内的 E0 到 E-4，
   // 不应执行超过两个浮点乘法。
@@ -90,16 +114,30 @@ uint8_t read_float(char *line, uint8_t *char_counter, float *float_ptr)
       } while (--exp > 0);
     }
   }
+  return(fval);
+}
 
-  // 用正确的符号分配浮点值。
-  if (isnegative) {
-    *float_ptr = -fval;
+uint8_t float_reader_fixed(float_reader_t *reader, int32_t *fixed_ptr)
+{
+  uint32_t fixed = reader->intval;
+  int8_t exp = reader->exp + 4; // FIXED_POINT_SCALE 的位数
+
+  if (exp < 0) {
+    // 多于 4 位小数，舍去多余的位。
+    while (exp < -1) {
+      fixed /= 10;
+      exp++;
+    }
+    fixed = (fixed + 5) / 10;
   } else {
-    *float_ptr = fval;
+    // intval 不超过 MAX_INT_DIGITS 位，每次乘 10 之前检查是否会超出 int32。
+    while (exp > 0) {
+      if (fixed > 214748364) { return(false); }
+      fixed = (((fixed << 2) + fixed) << 1); // fixed*10
+      exp--;
+    }
   }
-
-  *char_counter = ptr - line - 1; // 将 char_counter 设置为下一个语句
-
+  *fixed_ptr = fixed;
   return(true);
 }
 
@@ -70,6 +70,36 @@
 // 指向结果变量的指针。成功时返回 true
 uint8_t read_float(char *line, uint8_t *char_counter, float *float_ptr);
 
+#define MAX_INT_DIGITS 8 // int32（和 float）中的最大数字位数
+
+// 逐字符读取无符号数值的状态。read_float() 和流式 G 代码分词共用，保证两者得到相同的值。
+typedef struct {
+  uint32_t intval; // 截断到 MAX_INT_DIGITS 位的数字
+  int8_t exp;      // 十进制指数
+  uint8_t ndigit;  // 已读取的数字位数
+  bool isdecimal;  // 已读到小数点
+} float_reader_t;
+
+// 开始读取一个新的数值。
+void float_reader_init(float_reader_t *reader);
+
+// 读入一个字符。c 是数字或第一个小数点时返回 true，否则数值在 c 之前结束。
+uint8_t float_reader_char(float_reader_t *reader, uint8_t c);
+
+// 返回已读入的数值（不含符号）。
+float float_reader_value(float_reader_t *reader);
+
+// 定点数：数值乘以 FIXED_POINT_SCALE 后的整数，即 0.0001 单位（毫米时为 0.1 微米）。
+#define FIXED_POINT_SCALE 10000
+#define fixed_to_float(fixed) ((float)(fixed) * (1.0f / FIXED_POINT_SCALE))
+
+// 把已读入的数值（不含符号）转换为定点数，第 4 位之后的小数四舍五入，只用整数运算。
+// 数值不小于 214748.3648 时返回 false，此时改用 float_reader_value()。
+uint8_t float_reader_fixed(float_reader_t *reader, int32_t *fixed_ptr);
+
+// 将浮点值按 precision 位小数格式化为字符串，写入 str。
+void float2string(float fval, char *str, uint8_t precision);
+
 // 非阻塞延迟函数，用于一般操作和挂起功能。
 void delay_sec(float seconds, uint8_t mode);
 
@@ -26,6 +26,13 @@ static uint8_t block_buffer_head;                    // 下一个要推入的块
 static uint8_t next_buffer_head;                     // 下一个缓冲区头索引
 static uint8_t block_buffer_planned;                 // 最优规划块的索引
 
+#ifdef ENABLE_NATIVE_ARCS
+// 圆弧块的几何数据。只有圆弧块在此入队，顺序与块缓冲区相同，随圆弧块一起丢弃。
+static plan_arc_t arc_buffer[ARC_BUFFER_SIZE];
+static uint8_t arc_buffer_tail; // 当前或下一个圆弧块的数据索引
+static uint8_t arc_buffer_head; // 下一个要推入的圆弧数据索引
+#endif
+
 // 定义规划变量
 typedef struct
 {
@@ -34,9 +41,56 @@ typedef struct
                                    // 即弧线、固定循环和反向间隙补偿。
   float previous_unit_vec[N_AXIS]; // 前一个路径线段的单位向量
   float previous_nominal_speed;    // 前一个路径线段的名义速度
+#ifdef ENABLE_SEGMENT_MERGING
+  // 最新块入队前的规划器状态，合并时据此弹出最新块并从其起点重新规划。
+  int32_t merge_position[N_AXIS];  // 最新块的起点（步数）
+  float merge_unit_vec[N_AXIS];    // 最新块之前的单位向量
+  float merge_nominal_speed;       // 最新块之前的名义速度
+  float merge_deviation;           // 最新块已合并的顶点到其直线的最大距离上界（mm）
+#ifdef ENABLE_PATH_CONTROL_MODES
+  float merge_path_tolerance;
+#endif
+  uint8_t merge_ready;             // 以上状态有效
+  uint32_t merge_count;            // 复位以来合并的线段数
+#endif
+  // 覆盖变化后的增量更新，见 plan_update_velocity_profile_parameters()。
+  uint8_t ovr_changed;             // 尚未更新完的覆盖类型（PLAN_OVR_*），为零时没有待更新的块
+  uint8_t ovr_index;               // 下一个要检查的块
+  uint8_t ovr_arc_index;           // 该块的圆弧数据索引
+  uint8_t ovr_prev_arc_index;      // 上一个块的圆弧数据索引
+  uint8_t ovr_prev_affected;       // 上一个块的名义速度随覆盖改变
+  uint8_t ovr_prev_known;          // ovr_prev_nominal_speed 有效
+  float ovr_prev_nominal_speed;    // 上一个块按当前覆盖值的名义速度
 } planner_t;
 static planner_t pl;
 
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+// 第二级前瞻：块缓冲区之后、尚未入队的运动的摘要，按入队顺序排列。
+typedef struct
+{
+  float speed_sqr_delta;     // 与 plan_block_t 相同，2*加速度*长度
+  float max_entry_speed_sqr; // 与前一运动连接处的最大入口速度（平方）
+} plan_summary_t;
+
+// 计算摘要所需的规划器状态，与 pl 中的同名字段相同。
+typedef struct
+{
+  int32_t position[N_AXIS];
+  float previous_unit_vec[N_AXIS];
+  float previous_nominal_speed;
+} plan_summary_state_t;
+
+static struct
+{
+  plan_summary_t summary[LOOKAHEAD_BUFFER_SIZE];
+  uint8_t tail;               // 第一个摘要，即下一个入队的运动
+  uint8_t count;
+  uint8_t exit_valid;         // exit_speed_sqr 有效
+  float exit_speed_sqr;       // 块缓冲区中最后一个块的退出速度（平方）
+  plan_summary_state_t state; // 最后一个摘要之后的规划器状态
+} lookahead;
+#endif
+
 // 返回环形缓冲区中下一个块的索引。也由步进段缓冲区调用。
 uint8_t plan_next_block_index(uint8_t block_index)
 {
@@ -59,6 +113,32 @@ static uint8_t plan_prev_block_index(uint8_t block_index)
   return (block_index);
 }
 
+#ifdef ENABLE_NATIVE_ARCS
+// 返回圆弧缓冲区中下一个数据的索引
+static uint8_t plan_next_arc_index(uint8_t arc_index)
+{
+  arc_index++;
+  if (arc_index == ARC_BUFFER_SIZE)
+  {
+    arc_index = 0;
+  }
+  return (arc_index);
+}
+#endif
+
+uint32_t plan_get_block_steps(plan_block_t *block, uint8_t idx)
+{
+  uint8_t *steps = block->steps[idx];
+  return (steps[0] | ((uint16_t)steps[1] << 8) | ((uint32_t)steps[2] << 16));
+}
+
+static void plan_set_block_steps(plan_block_t *block, uint8_t idx, uint32_t steps)
+{
+  block->steps[idx][0] = steps & 0xff;
+  block->steps[idx][1] = (steps >> 8) & 0xff;
+  block->steps[idx][2] = steps >> 16;
+}
+
 /*                            规划速度定义
                                      +--------+   <- current->nominal_speed
                                     /          \
@@ -91,9 +171,52 @@ static uint8_t plan_prev_block_index(uint8_t block_index)
   - block_buffer_planned：指向正常流操作条件下最后一个最佳规划块之后的第一个缓冲块。用于规划优化，通过避免在添加新块时重新计算不变的规划缓冲区部分，如上所述。此外，该块永远不会小于 block_buffer_tail，并且在遇到 plan_discard_current_block() 例程时将始终向前推进并保持此要求。
 
   注意：由于规划器仅在规划缓冲区内计算，因此某些具有许多短线段的运动，如 G2/G3 弧线或复杂曲线，可能看起来移动缓慢。这是因为整个缓冲区内的总行驶距离不足以加速到名义速度，然后在缓冲区结束时减速至完全停止，正如准则所述。如果发生这种情况并且变得令人烦恼，有一些简单的解决方案：(1) 最大化机器加速度。规划器将能够在相同的总行驶距离内计算更高的速度曲线。(2) 最大化每个块的线路运动距离到所需的公差。规划器可用的总行驶距离越多，它的速度就越快。(3) 最大化规划器缓冲区大小。这也将增加规划器计算的总行驶距离。这也增加了规划器为计算最佳规划而必须执行的计算次数，因此请谨慎选择。Arduino 328p 的内存已经达到了最大值，但未来的 ARM 版本应该有足够的内存和速度，能够处理多达一百个或更多的前瞻性块。
+  启用 ENABLE_LOOKAHEAD_SUMMARY 时，缓冲区末端之后还有接收缓冲区中已预读的运动摘要（第二级前瞻），最后一个块的退出速度按能在这些摘要内停下计算，而不是零，见 plan_summary_begin()。
 
 */
 
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+// 第 n 个摘要的索引。
+static uint8_t plan_summary_index(uint8_t n)
+{
+  n += lookahead.tail;
+  if (n >= LOOKAHEAD_BUFFER_SIZE)
+  {
+    n -= LOOKAHEAD_BUFFER_SIZE;
+  }
+  return (n);
+}
+
+static void plan_summary_clear()
+{
+  lookahead.count = 0;
+  lookahead.exit_valid = false;
+}
+
+// 与反向计算相同地从最后一个摘要（退出速度为零）向前求出第一个摘要的入口速度，即块缓冲区中最后一个块的
+// 退出速度。摘要改变后才重新计算。
+static float plan_summary_exit_speed_sqr()
+{
+  if (!lookahead.exit_valid)
+  {
+    float exit_speed_sqr = 0.0;
+    uint8_t n = lookahead.count;
+    while (n--)
+    {
+      plan_summary_t *summary = &lookahead.summary[plan_summary_index(n)];
+      exit_speed_sqr += summary->speed_sqr_delta;
+      if (exit_speed_sqr > summary->max_entry_speed_sqr)
+      {
+        exit_speed_sqr = summary->max_entry_speed_sqr;
+      }
+    }
+    lookahead.exit_speed_sqr = exit_speed_sqr;
+    lookahead.exit_valid = true;
+  }
+  return (lookahead.exit_speed_sqr);
+}
+#endif
+
 static void planner_recalculate()
 {
   // 初始化块索引为规划缓冲区中的最后一个块。
@@ -112,8 +235,13 @@ static void planner_recalculate()
   plan_block_t *next;
   plan_block_t *current = &block_buffer[block_index];
 
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  // 计算缓冲区中最后一个块的最大入口速度，退出速度由第二级前瞻给出，没有摘要时为零。
+  current->entry_speed_sqr = min(current->max_entry_speed_sqr, plan_summary_exit_speed_sqr() + current->speed_sqr_delta);
+#else
   // 计算缓冲区中最后一个块的最大入口速度，退出速度始终为零。
-  current->entry_speed_sqr = min(current->max_entry_speed_sqr, 2 * current->acceleration * current->millimeters);
+  current->entry_speed_sqr = min(current->max_entry_speed_sqr, current->speed_sqr_delta);
+#endif
 
   block_index = plan_prev_block_index(block_index);
   if (block_index == block_buffer_planned)
@@ -141,7 +269,7 @@ static void planner_recalculate()
       // 根据当前块的退出速度计算最大入口速度。
       if (current->entry_speed_sqr != current->max_entry_speed_sqr)
       {
-        entry_speed_sqr = next->entry_speed_sqr + 2 * current->acceleration * current->millimeters;
+        entry_speed_sqr = next->entry_speed_sqr + current->speed_sqr_delta;
         if (entry_speed_sqr < current->max_entry_speed_sqr)
         {
           current->entry_speed_sqr = entry_speed_sqr;
@@ -167,7 +295,7 @@ static void planner_recalculate()
     // 换句话说，逻辑上从缓冲区尾到规划指针之间的任何内容都无法改善规划。
     if (current->entry_speed_sqr < next->entry_speed_sqr)
     {
-      entry_speed_sqr = current->entry_speed_sqr + 2 * current->acceleration * current->millimeters;
+      entry_speed_sqr = current->entry_speed_sqr + current->speed_sqr_delta;
       // 如果为真，当前块为全加速，且我们可以将规划指针向前移动。
       if (entry_speed_sqr < next->entry_speed_sqr)
       {
@@ -187,6 +315,27 @@ static void planner_recalculate()
   }
 }
 
+// 退出速度限制或最大入口速度降低后（去掉第二级前瞻的摘要、覆盖变化时）从尾块起完全重新规划。
+// planner_recalculate() 的反向计算跳过入口速度等于最大入口速度的块，这只在这些限制不会降低时成立，
+// 否则这样的块可能来不及减速。
+// 先把尾块之后的入口速度置零，反向计算就对每一块取下一块入口速度加 speed_sqr_delta 与最大入口速度的较小值。
+// 尾块正在执行，入口速度是步进模块的当前速度，保持不变。
+static void plan_replan_from_tail()
+{
+  if (block_buffer_tail == block_buffer_head)
+  {
+    return;
+  }
+  uint8_t block_index = plan_next_block_index(block_buffer_tail);
+  while (block_index != block_buffer_head)
+  {
+    block_buffer[block_index].entry_speed_sqr = 0.0;
+    block_index = plan_next_block_index(block_index);
+  }
+  block_buffer_planned = block_buffer_tail;
+  planner_recalculate();
+}
+
 void plan_reset()
 {
   memset(&pl, 0, sizeof(planner_t)); // 清除规划器结构体
@@ -195,10 +344,21 @@ void plan_reset()
 
 void plan_reset_buffer()
 {
+#ifdef ENABLE_SEGMENT_MERGING
+  pl.merge_ready = false;
+#endif
+  pl.ovr_changed = 0;
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  plan_summary_clear();
+#endif
   block_buffer_tail = 0;
   block_buffer_head = 0;    // 空 = 尾
   next_buffer_head = 1;     // plan_next_block_index(block_buffer_head)
   block_buffer_planned = 0; // = block_buffer_tail;
+#ifdef ENABLE_NATIVE_ARCS
+  arc_buffer_tail = 0;
+  arc_buffer_head = 0;
+#endif
 }
 
 void plan_discard_current_block()
@@ -211,6 +371,23 @@ void plan_discard_current_block()
     {
       block_buffer_planned = block_index;
     }
+#ifdef ENABLE_NATIVE_ARCS
+    if (block_buffer[block_buffer_tail].arc_axes)
+    {
+      arc_buffer_tail = plan_next_arc_index(arc_buffer_tail);
+    }
+#endif
+    // 增量更新尚未越过新的尾块时，从新的尾块继续。尾块之前没有块，与更新开始时一样处理。
+    if (pl.ovr_changed && ((pl.ovr_index == block_buffer_tail) || (pl.ovr_index == block_index)))
+    {
+      pl.ovr_index = block_index;
+#ifdef ENABLE_NATIVE_ARCS
+      pl.ovr_arc_index = arc_buffer_tail;
+#endif
+      pl.ovr_prev_nominal_speed = SOME_LARGE_VALUE;
+      pl.ovr_prev_known = true;
+      pl.ovr_prev_affected = false;
+    }
     block_buffer_tail = block_index;
   }
 }
@@ -231,6 +408,13 @@ plan_block_t *plan_get_current_block()
   return (&block_buffer[block_buffer_tail]);
 }
 
+#ifdef ENABLE_NATIVE_ARCS
+plan_arc_t *plan_get_current_arc()
+{
+  return (&arc_buffer[arc_buffer_tail]);
+}
+#endif
+
 float plan_get_exec_block_exit_speed_sqr()
 {
   uint8_t block_index = plan_next_block_index(block_buffer_tail);
@@ -241,6 +425,43 @@ float plan_get_exec_block_exit_speed_sqr()
   return (block_buffer[block_index].entry_speed_sqr);
 }
 
+#ifdef GRBL_SIM
+// 仿真检查：返回尾块之后入口速度超过下一块入口速度加上本块 speed_sqr_delta 的块数，即规划要求
+// 减速快于加速度允许的块数。最后一个块的下一块入口速度为第二级前瞻给出的退出速度。尾块正在执行，
+// 入口速度是步进模块的当前速度，不检查。
+uint8_t plan_check_entry_speeds()
+{
+  if (block_buffer_tail == block_buffer_head)
+  {
+    return (0);
+  }
+  uint8_t n_violation = 0;
+  uint8_t block_index = plan_next_block_index(block_buffer_tail);
+  while (block_index != block_buffer_head)
+  {
+    plan_block_t *block = &block_buffer[block_index];
+    block_index = plan_next_block_index(block_index);
+    float next_entry_speed_sqr = 0.0;
+    if (block_index != block_buffer_head)
+    {
+      next_entry_speed_sqr = block_buffer[block_index].entry_speed_sqr;
+    }
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+    else
+    {
+      next_entry_speed_sqr = plan_summary_exit_speed_sqr();
+    }
+#endif
+    // 容差只为吸收浮点舍入。
+    if (block->entry_speed_sqr > 1.0001 * (next_entry_speed_sqr + block->speed_sqr_delta))
+    {
+      n_violation++;
+    }
+  }
+  return (n_violation);
+}
+#endif
+
 // 返回块环形缓冲区的可用状态。如果满，返回真。
 uint8_t plan_check_full_buffer()
 {
@@ -248,12 +469,101 @@ uint8_t plan_check_full_buffer()
   {
     return (true);
   }
+#ifdef ENABLE_NATIVE_ARCS
+  if (arc_buffer_tail == plan_next_arc_index(arc_buffer_head))
+  {
+    return (true);
+  }
+#endif
+  return (false);
+}
+
+#ifdef ENABLE_NATIVE_ARCS
+// 由平面内的弧长和 unit_vec[] 中非平面轴的位移（mm）求螺旋线长度，并把 unit_vec[] 换为限制加速度和
+// 速率用的方向：切向在圆弧上转动，按两个平面轴都可能沿切向全速移动计算。返回螺旋线长度。
+static float plan_compute_arc_unit_vector(float *unit_vec, float plane_mm, uint8_t axis_0, uint8_t axis_1)
+{
+  uint8_t idx;
+  float mm_sqr = plane_mm * plane_mm;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    if ((idx != axis_0) && (idx != axis_1))
+    {
+      mm_sqr += unit_vec[idx] * unit_vec[idx];
+    }
+  }
+  float millimeters = sqrt(mm_sqr);
+  float inv_mm = 1.0 / millimeters;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    unit_vec[idx] *= inv_mm;
+  }
+  unit_vec[axis_0] = plane_mm * inv_mm;
+  unit_vec[axis_1] = unit_vec[axis_0];
+  return (millimeters);
+}
+
+// 圆弧的最大速率。除各轴的限制外，向心加速度 v^2/r 不超过平面两轴中较小的加速度。
+static float plan_compute_arc_rapid_rate(float *unit_vec, float radius, uint8_t axis_0, uint8_t axis_1)
+{
+  float rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+  float arc_rate = sqrt(min(settings.acceleration[axis_0], settings.acceleration[axis_1]) * radius);
+  if (rapid_rate > arc_rate)
+  {
+    rapid_rate = arc_rate;
+  }
+  return (rapid_rate);
+}
+#endif
+
+// 求块方向上轴限制调整后的最大速率（mm/min）。与入队时的计算相同，由各轴步数求方向。
+// arc_index 为圆弧块在圆弧缓冲区中的数据索引。
+static float plan_compute_rapid_rate(plan_block_t *block, uint8_t arc_index)
+{
+  float unit_vec[N_AXIS];
+  uint8_t idx;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    unit_vec[idx] = plan_get_block_steps(block, idx) / settings.steps_per_mm[idx];
+  }
+#ifdef ENABLE_NATIVE_ARCS
+  if (block->arc_axes)
+  {
+    plan_arc_t *arc = &arc_buffer[arc_index];
+    uint8_t axis_0 = block->arc_axes & 0x0f;
+    uint8_t axis_1 = block->arc_axes >> 4;
+    float radius = sqrt(arc->offset[0] * arc->offset[0] + arc->offset[1] * arc->offset[1]);
+    plan_compute_arc_unit_vector(unit_vec, fabs(arc->travel) * radius, axis_0, axis_1);
+    return (plan_compute_arc_rapid_rate(unit_vec, radius, axis_0, axis_1));
+  }
+#endif
+  convert_delta_vector_to_unit_vector(unit_vec);
+  return (limit_value_by_axis_maximum(settings.max_rate, unit_vec));
+}
+
+// 块的最大速率不低于各轴最大速率中的最小值，名义速度不超过该值时不受最大速率限制，不必求出。
+static uint8_t plan_check_rapid_rate_limit(plan_block_t *block, float nominal_speed)
+{
+#ifdef ENABLE_NATIVE_ARCS
+  if (block->arc_axes)
+  {
+    return (true);
+  } // 圆弧还受向心加速度限制。
+#endif
+  uint8_t idx;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    if (nominal_speed > settings.max_rate[idx])
+    {
+      return (true);
+    }
+  }
   return (false);
 }
 
-// 根据运行条件和覆盖值计算并返回块的名义速度。
+// 根据运行条件和覆盖值计算并返回块的名义速度。rapid_rate 为块的最大速率，为零时在需要时求出。
 // 注意：所有系统运动命令，如归位/停车，不受覆盖的影响。
-float plan_compute_profile_nominal_speed(plan_block_t *block)
+static float plan_compute_nominal_speed(plan_block_t *block, float rapid_rate, uint8_t arc_index)
 {
   float nominal_speed = block->programmed_rate;
   if (block->condition & PL_COND_FLAG_RAPID_MOTION)
@@ -266,9 +576,13 @@ float plan_compute_profile_nominal_speed(plan_block_t *block)
     {
       nominal_speed *= (0.01 * sys.f_override);
     }
-    if (nominal_speed > block->rapid_rate)
+    if ((rapid_rate == 0.0) && plan_check_rapid_rate_limit(block, nominal_speed))
+    {
+      rapid_rate = plan_compute_rapid_rate(block, arc_index);
+    }
+    if ((rapid_rate > 0.0) && (nominal_speed > rapid_rate))
     {
-      nominal_speed = block->rapid_rate;
+      nominal_speed = rapid_rate;
     }
   }
   if (nominal_speed > MINIMUM_FEED_RATE)
@@ -278,6 +592,16 @@ float plan_compute_profile_nominal_speed(plan_block_t *block)
   return (MINIMUM_FEED_RATE);
 }
 
+// 由步进段缓冲区对当前块或系统运动块调用。
+float plan_compute_profile_nominal_speed(plan_block_t *block)
+{
+#ifdef ENABLE_NATIVE_ARCS
+  return (plan_compute_nominal_speed(block, 0.0, arc_buffer_tail));
+#else
+  return (plan_compute_nominal_speed(block, 0.0, 0));
+#endif
+}
+
 // 计算并更新块的最大入口速度（平方），基于连接的前后名义速度和最大连接速度的最小值。
 static void plan_compute_profile_parameters(plan_block_t *block, float nominal_speed, float prev_nominal_speed)
 {
@@ -296,22 +620,98 @@ static void plan_compute_profile_parameters(plan_block_t *block, float nominal_s
   }
 }
 
-// 在基于运动的覆盖变化后重新计算缓冲运动的参数。
+// 块的名义速度是否随 ovr_changed 中的覆盖类型改变。
+static uint8_t plan_check_override_affected(plan_block_t *block, uint8_t ovr_changed)
+{
+  if (block->condition & PL_COND_FLAG_RAPID_MOTION)
+  {
+    return (ovr_changed & PLAN_OVR_RAPID);
+  }
+  if (block->condition & PL_COND_FLAG_NO_FEED_OVERRIDE)
+  {
+    return (false);
+  }
+  return (ovr_changed & PLAN_OVR_FEED);
+}
+
+// 进给或快速覆盖改变后调用。执行中的块立即按新的覆盖值重新计算速度曲线，缓冲区中其余的块
+// 由 plan_update_velocity_profile_parameters() 从尾块开始分批更新，更新完成前其余块仍按原覆盖值执行，
+// 时间上限见 planner.h 中的 PLAN_OVERRIDE_UPDATE_BLOCKS。更新完成前再次改变时从尾块重新开始。
+void plan_request_velocity_profile_update(uint8_t ovr_changed)
+{
+  pl.ovr_changed |= ovr_changed;
+  pl.ovr_index = block_buffer_tail;
+#ifdef ENABLE_NATIVE_ARCS
+  pl.ovr_arc_index = arc_buffer_tail;
+#endif
+  pl.ovr_prev_nominal_speed = SOME_LARGE_VALUE; // 尾块的最大入口速度不受前一块限制
+  pl.ovr_prev_known = true;
+  pl.ovr_prev_affected = false;
+  st_update_plan_block_parameters();
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  // 摘要按原覆盖值计算。去掉后最后一个块的退出速度降低，立即从尾块完全重新规划，不等分批更新完成。
+  plan_summary_clear();
+  plan_replan_from_tail();
+#endif
+}
+
+// 在基于运动的覆盖变化后重新计算缓冲运动的参数。由主程序反复调用，每次最多更新
+// PLAN_OVERRIDE_UPDATE_BLOCKS 个块。只有名义速度随覆盖改变的块及其后一块（最大入口速度取决于前一块的
+// 名义速度）需要更新，其余块跳过。全部更新后从尾块起完全重新规划一次。
 void plan_update_velocity_profile_parameters()
 {
-  uint8_t block_index = block_buffer_tail;
-  plan_block_t *block;
-  float nominal_speed;
-  float prev_nominal_speed = SOME_LARGE_VALUE; // 设置为高值以便计算第一个块的名义速度。
-  while (block_index != block_buffer_head)
+  if (!pl.ovr_changed)
   {
-    block = &block_buffer[block_index];
-    nominal_speed = plan_compute_profile_nominal_speed(block);
-    plan_compute_profile_parameters(block, nominal_speed, prev_nominal_speed);
-    prev_nominal_speed = nominal_speed;
-    block_index = plan_next_block_index(block_index);
+    return;
+  }
+  uint8_t n_update = 0;
+  while (pl.ovr_index != block_buffer_head)
+  {
+    if (n_update == PLAN_OVERRIDE_UPDATE_BLOCKS)
+    {
+      return;
+    } // 其余的块留到下次调用
+    plan_block_t *block = &block_buffer[pl.ovr_index];
+    uint8_t affected = plan_check_override_affected(block, pl.ovr_changed);
+    if (affected || pl.ovr_prev_affected)
+    {
+      if (!pl.ovr_prev_known)
+      {
+        pl.ovr_prev_nominal_speed = plan_compute_nominal_speed(&block_buffer[plan_prev_block_index(pl.ovr_index)], 0.0,
+                                                               pl.ovr_prev_arc_index);
+      }
+      float nominal_speed = plan_compute_nominal_speed(block, 0.0, pl.ovr_arc_index);
+      plan_compute_profile_parameters(block, nominal_speed, pl.ovr_prev_nominal_speed);
+      pl.ovr_prev_nominal_speed = nominal_speed;
+      pl.ovr_prev_known = true;
+      n_update++;
+    }
+    else
+    {
+      pl.ovr_prev_known = false;
+    }
+    pl.ovr_prev_affected = affected;
+    pl.ovr_prev_arc_index = pl.ovr_arc_index;
+#ifdef ENABLE_NATIVE_ARCS
+    if (block->arc_axes)
+    {
+      pl.ovr_arc_index = plan_next_arc_index(pl.ovr_arc_index);
+    }
+#endif
+    pl.ovr_index = plan_next_block_index(pl.ovr_index);
+  }
+  // 最后一块跳过时名义速度未变，pl.previous_nominal_speed 仍然有效。
+  if (pl.ovr_prev_known)
+  {
+    pl.previous_nominal_speed = pl.ovr_prev_nominal_speed; // 更新上一个名义速度，以便于下一个传入块。
   }
-  pl.previous_nominal_speed = prev_nominal_speed; // 更新上一个名义速度，以便于下一个传入块。
+  pl.ovr_changed = 0;
+#ifdef ENABLE_SEGMENT_MERGING
+  pl.merge_ready = false; // 保存的名义速度已过时
+#endif
+  // 最大入口速度可能降低，入口速度等于原最大值的块不能被反向计算跳过。
+  st_update_plan_block_parameters();
+  plan_replan_from_tail();
 }
 
 /* 将新的线性运动添加到缓冲区。 target[N_AXIS] 是以毫米为单位的带符号绝对目标位置。
@@ -321,41 +721,157 @@ void plan_update_velocity_profile_parameters()
    换句话说，缓冲区头从不等于缓冲区尾。此外，进给速率输入值以三种方式使用：如果 invert_feed_rate 为 false，则作为正常进给速率；如果 invert_feed_rate 为 true，则作为反向时间；如果 feed_rate 值为负（并且 invert_feed_rate 始终为 false），则作为寻址/快速速率。
    系统运动条件告诉规划器在始终未使用的块缓冲区头中规划运动。它避免更改规划器状态并保留缓冲区，以确保后续的 G-code 运动仍能正确规划，同时步进模块仅指向块缓冲区头以执行特殊的系统运动。 */
 
-uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
+#ifdef ENABLE_NATIVE_ARCS
+// 设置圆弧块的几何数据和长度，返回加速度，rapid_rate 返回最大速率。调用时 unit_vec[] 为起点到终点的
+// 位移（mm），返回时为起点的切向单位向量，exit_unit_vec[] 为终点的切向单位向量。非平面轴随圆弧线性
+// 移动，块长度为螺旋线长度。
+static float plan_compute_arc_parameters(plan_block_t *block, plan_line_data_t *pl_data, float *unit_vec, float *exit_unit_vec,
+                                         float *rapid_rate)
 {
-  // 准备并初始化新块。复制相关的 pl_data 以供块执行。
-  plan_block_t *block = &block_buffer[block_buffer_head];
-  memset(block, 0, sizeof(plan_block_t)); // 将所有块值置零。
-  block->condition = pl_data->condition;
-  block->spindle_speed = pl_data->spindle_speed;
-  block->line_number = pl_data->line_number;
+  uint8_t axis_0 = pl_data->arc_axis_0;
+  uint8_t axis_1 = pl_data->arc_axis_1;
+  plan_arc_t *arc = &arc_buffer[arc_buffer_head];
+  arc->travel = pl_data->arc_travel;
+  arc->offset[0] = pl_data->arc_offset[0];
+  arc->offset[1] = pl_data->arc_offset[1];
+  block->arc_axes = axis_0 | (axis_1 << 4);
 
-  // 计算并存储初始移动距离数据。
-  int32_t target_steps[N_AXIS], position_steps[N_AXIS];
-  float unit_vec[N_AXIS], delta_mm;
-  uint8_t idx;
+  float r_start_0 = -pl_data->arc_offset[0]; // 圆心到起点和终点的半径向量
+  float r_start_1 = -pl_data->arc_offset[1];
+  float r_end_0 = unit_vec[axis_0] + r_start_0;
+  float r_end_1 = unit_vec[axis_1] + r_start_1;
+  float radius = sqrt(r_start_0 * r_start_0 + r_start_1 * r_start_1);
 
-  // 根据计划的运动类型复制位置数据。
-  if (block->condition & PL_COND_FLAG_SYSTEM_MOTION)
+  // 通过最大速率限制名义速度和入口速度。
+  block->millimeters = plan_compute_arc_unit_vector(unit_vec, fabs(pl_data->arc_travel) * radius, axis_0, axis_1);
+  float acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
+  *rapid_rate = plan_compute_arc_rapid_rate(unit_vec, radius, axis_0, axis_1);
+
+  // 平面内切向为半径向量逆时针旋转 90 度，按角行程的符号取向。
+  float inv_mm = 1.0 / block->millimeters;
+  float k = pl_data->arc_travel * inv_mm;
+  memcpy(exit_unit_vec, unit_vec, N_AXIS * sizeof(float));
+  unit_vec[axis_0] = -k * r_start_1;
+  unit_vec[axis_1] = k * r_start_0;
+  exit_unit_vec[axis_0] = -k * r_end_1;
+  exit_unit_vec[axis_1] = k * r_end_0;
+  return (acceleration);
+}
+#endif
+
+#ifdef ENABLE_SEGMENT_MERGING
+// 检查新线段能否与缓冲区中最新的块合并。设最新块从 S 到 P，新线段从 P 到 T，P 到直线 ST 的距离加上
+// 最新块已有的偏差上界不超过 SEGMENT_MERGE_TOLERANCE 时，弹出最新块并恢复其入队前的规划器状态，
+// 由 plan_buffer_line() 把 S 到 T 作为一个块重新规划。之前合并的顶点到 ST 的距离不超过它们到 SP 的距离
+// 加上 P 到 ST 的距离，所以偏差上界逐次累加。
+// 注意：最新块不能是尾块或尾块之后的块。前者正在执行，后者的入口速度是尾块的退出速度。
+static uint8_t plan_pop_collinear_block(float *target, plan_line_data_t *pl_data)
+{
+  if (!pl.merge_ready || pl.ovr_changed || (pl_data->condition & (PL_COND_FLAG_SYSTEM_MOTION | PL_COND_FLAG_INVERSE_TIME)))
   {
-#ifdef COREXY
-    position_steps[X_AXIS] = system_convert_corexy_to_x_axis_steps(sys_position);
-    position_steps[Y_AXIS] = system_convert_corexy_to_y_axis_steps(sys_position);
-    position_steps[Z_AXIS] = sys_position[Z_AXIS];
-#else
-    memcpy(position_steps, sys_position, sizeof(sys_position));
+    return (false);
+  }
+#ifdef ENABLE_NATIVE_ARCS
+  if (pl_data->arc_travel != 0.0)
+  {
+    return (false);
+  }
 #endif
+  uint8_t block_index = plan_prev_block_index(block_buffer_head);
+  if ((block_buffer_head == block_buffer_tail) || (block_index == block_buffer_tail) ||
+      (block_index == plan_next_block_index(block_buffer_tail)))
+  {
+    return (false);
   }
-  else
+  plan_block_t *block = &block_buffer[block_index];
+  if ((block->condition != pl_data->condition) || (block->spindle_speed != pl_data->spindle_speed))
   {
-    memcpy(position_steps, pl.position, sizeof(pl.position));
+    return (false);
+  }
+#ifdef ENABLE_NATIVE_ARCS
+  if (block->arc_axes)
+  {
+    return (false);
+  }
+#endif
+  if (!(block->condition & PL_COND_FLAG_RAPID_MOTION) && (block->programmed_rate != pl_data->feed_rate))
+  {
+    return (false);
+  }
+#ifdef ENABLE_PATH_CONTROL_MODES
+  if ((pl_data->path_tolerance < 0.0) || (pl_data->path_tolerance != pl.merge_path_tolerance))
+  {
+    return (false);
+  }
+#endif
+
+  // a = P - S，c = T - S（mm）。
+  float a[N_AXIS], c[N_AXIS];
+  float a_dot_c = 0.0, c_sqr = 0.0, a_dot_b = 0.0;
+  uint8_t idx;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    float position_mm = pl.position[idx] / settings.steps_per_mm[idx];
+    a[idx] = position_mm - pl.merge_position[idx] / settings.steps_per_mm[idx];
+    c[idx] = target[idx] - position_mm;
+    a_dot_b += a[idx] * c[idx];
+    c[idx] += a[idx];
+    if (fabs(c[idx]) * settings.steps_per_mm[idx] > 0.5 * PLAN_BLOCK_MAX_STEPS)
+    {
+      return (false);
+    } // 合并块的步数留有余量，不超过 24 位。
+    a_dot_c += a[idx] * c[idx];
+    c_sqr += c[idx] * c[idx];
+  }
+  if (a_dot_b <= 0.0)
+  {
+    return (false);
+  } // 新线段折返或为零长度。
+
+  // 显式求 a 垂直于 c 的分量，避免长块上 |a|^2 - (a.c)^2/|c|^2 的相消误差。
+  float t = a_dot_c / c_sqr;
+  float deviation_sqr = 0.0;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    float d = a[idx] - t * c[idx];
+    deviation_sqr += d * d;
+  }
+  float deviation = pl.merge_deviation + sqrt(deviation_sqr);
+  if (deviation > SEGMENT_MERGE_TOLERANCE)
+  {
+    return (false);
   }
 
+  // 弹出最新块。规划指针不能越过新的缓冲区头。
+  block_buffer_head = block_index;
+  next_buffer_head = plan_next_block_index(block_index);
+  if (block_buffer_planned == block_index)
+  {
+    block_buffer_planned = plan_prev_block_index(block_index);
+  }
+  memcpy(pl.position, pl.merge_position, sizeof(pl.position));
+  memcpy(pl.previous_unit_vec, pl.merge_unit_vec, sizeof(pl.previous_unit_vec));
+  pl.previous_nominal_speed = pl.merge_nominal_speed;
+  pl.merge_deviation = deviation;
+  pl.merge_count++;
+  return (true);
+}
+
+uint32_t plan_get_merge_count() { return (pl.merge_count); }
+#endif
+
+// 由起点和目标求目标步数、各轴步数和单位向量的分子（各轴位移 mm），返回最大步数。
+static uint32_t plan_compute_line_steps(float *target, int32_t *position_steps, int32_t *target_steps, uint32_t *steps,
+                                        float *unit_vec)
+{
+  uint32_t step_event_count = 0;
+  float delta_mm;
+  uint8_t idx;
 #ifdef COREXY
   target_steps[A_MOTOR] = lround(target[A_MOTOR] * settings.steps_per_mm[A_MOTOR]);
   target_steps[B_MOTOR] = lround(target[B_MOTOR] * settings.steps_per_mm[B_MOTOR]);
-  block->steps[A_MOTOR] = labs((target_steps[X_AXIS] - position_steps[X_AXIS]) + (target_steps[Y_AXIS] - position_steps[Y_AXIS]));
-  block->steps[B_MOTOR] = labs((target_steps[X_AXIS] - position_steps[X_AXIS]) - (target_steps[Y_AXIS] - position_steps[Y_AXIS]));
+  steps[A_MOTOR] = labs((target_steps[X_AXIS] - position_steps[X_AXIS]) + (target_steps[Y_AXIS] - position_steps[Y_AXIS]));
+  steps[B_MOTOR] = labs((target_steps[X_AXIS] - position_steps[X_AXIS]) - (target_steps[Y_AXIS] - position_steps[Y_AXIS]));
 #endif
 
   for (idx = 0; idx < N_AXIS; idx++)
@@ -367,9 +883,9 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
     if (!(idx == A_MOTOR) && !(idx == B_MOTOR))
     {
       target_steps[idx] = lround(target[idx] * settings.steps_per_mm[idx]);
-      block->steps[idx] = labs(target_steps[idx] - position_steps[idx]);
+      steps[idx] = labs(target_steps[idx] - position_steps[idx]);
     }
-    block->step_event_count = max(block->step_event_count, block->steps[idx]);
+    step_event_count = max(step_event_count, steps[idx]);
     if (idx == A_MOTOR)
     {
       delta_mm = (target_steps[X_AXIS] - position_steps[X_AXIS] + target_steps[Y_AXIS] - position_steps[Y_AXIS]) / settings.steps_per_mm[idx];
@@ -384,36 +900,296 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
     }
 #else
     target_steps[idx] = lround(target[idx] * settings.steps_per_mm[idx]);
-    block->steps[idx] = labs(target_steps[idx] - position_steps[idx]);
-    block->step_event_count = max(block->step_event_count, block->steps[idx]);
+    steps[idx] = labs(target_steps[idx] - position_steps[idx]);
+    step_event_count = max(step_event_count, steps[idx]);
     delta_mm = (target_steps[idx] - position_steps[idx]) / settings.steps_per_mm[idx];
 #endif
     unit_vec[idx] = delta_mm; // 存储单位向量的分子
+  }
+  return (step_event_count);
+}
+
+// 按向心加速度近似求与前一运动连接处的最大速度（平方），见 plan_buffer_line() 中的说明。
+static float plan_compute_junction_speed_sqr(float *previous_unit_vec, float *unit_vec, plan_line_data_t *pl_data)
+{
+  float junction_speed_sqr;
+  float junction_unit_vec[N_AXIS];
+  float junction_cos_theta = 0.0;
+  uint8_t idx;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    junction_cos_theta -= previous_unit_vec[idx] * unit_vec[idx];
+    junction_unit_vec[idx] = unit_vec[idx] - previous_unit_vec[idx];
+  }
+
+  // 注意：通过三角函数半角恒等式计算，无需任何昂贵的三角函数 sin() 或 acos()。
+  if (junction_cos_theta > 0.999999)
+  {
+    // 对于 0 度的锐角连接，只需设置最小连接速度。
+    junction_speed_sqr = MINIMUM_JUNCTION_SPEED * MINIMUM_JUNCTION_SPEED;
+  }
+  else
+  {
+    if (junction_cos_theta < -0.999999)
+    {
+      // 连接是直线或 180 度。连接速度是无限的。
+      junction_speed_sqr = SOME_LARGE_VALUE;
+    }
+    else
+    {
+      convert_delta_vector_to_unit_vector(junction_unit_vec);
+      float junction_acceleration = limit_value_by_axis_maximum(settings.acceleration, junction_unit_vec);
+      float sin_theta_d2 = sqrt(0.5 * (1.0 - junction_cos_theta)); // 三角半角恒等式。始终为正。
+      float junction_deviation = settings.junction_deviation;
+#ifdef ENABLE_PATH_CONTROL_MODES
+      if (pl_data->path_tolerance > 0.0)
+      {
+        // G64 P，限制在 $11 的固定倍数内。拐角不被圆滑，更大的偏差只会使拐角处的速度突变更大。
+        junction_deviation = min(pl_data->path_tolerance, PATH_CONTROL_MAX_DEVIATION * settings.junction_deviation);
+      }
+#endif
+      junction_speed_sqr = max(MINIMUM_JUNCTION_SPEED * MINIMUM_JUNCTION_SPEED,
+                               (junction_acceleration * junction_deviation * sin_theta_d2) / (1.0 - sin_theta_d2));
+    }
+  }
+#ifdef ENABLE_PATH_CONTROL_MODES
+  if (pl_data->path_tolerance < 0.0)
+  {
+    junction_speed_sqr = 0.0; // G61.1 精确停止，直线连接也停止。
+  }
+#endif
+  return (junction_speed_sqr);
+}
+
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+// 与 plan_buffer_line() 相同地计算从 state 开始的直线运动的摘要，并把 state 更新为运动之后的状态。
+// 圆弧、系统运动和需要分段的长直线不作摘要，返回 false，state 不变。
+static uint8_t plan_compute_summary(float *target, plan_line_data_t *pl_data, plan_summary_state_t *state,
+                                    plan_summary_t *summary)
+{
+  if (pl.ovr_changed || (pl_data->condition & PL_COND_FLAG_SYSTEM_MOTION))
+  {
+    return (false);
+  }
+#ifdef ENABLE_NATIVE_ARCS
+  if (pl_data->arc_travel != 0.0)
+  {
+    return (false);
+  }
+#endif
+  int32_t target_steps[N_AXIS];
+  uint32_t steps[N_AXIS];
+  float unit_vec[N_AXIS];
+  uint32_t step_event_count = plan_compute_line_steps(target, state->position, target_steps, steps, unit_vec);
+  if ((step_event_count == 0) || (step_event_count > PLAN_BLOCK_MAX_STEPS))
+  {
+    return (false);
+  }
+
+  // 名义速度和最大入口速度只用到块的以下字段。
+  plan_block_t block;
+  block.condition = pl_data->condition;
+  block.millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+  float acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
+  float rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+  if (block.condition & PL_COND_FLAG_RAPID_MOTION)
+  {
+    block.programmed_rate = rapid_rate;
+  }
+  else
+  {
+    block.programmed_rate = pl_data->feed_rate;
+    if (block.condition & PL_COND_FLAG_INVERSE_TIME)
+    {
+      block.programmed_rate *= block.millimeters;
+    }
+  }
+  block.max_junction_speed_sqr = plan_compute_junction_speed_sqr(state->previous_unit_vec, unit_vec, pl_data);
+  float nominal_speed = plan_compute_nominal_speed(&block, rapid_rate, 0);
+  plan_compute_profile_parameters(&block, nominal_speed, state->previous_nominal_speed);
+
+  summary->speed_sqr_delta = 2 * acceleration * block.millimeters;
+  summary->max_entry_speed_sqr = block.max_entry_speed_sqr;
+  memcpy(state->position, target_steps, sizeof(target_steps));
+  memcpy(state->previous_unit_vec, unit_vec, sizeof(unit_vec));
+  state->previous_nominal_speed = nominal_speed;
+  return (true);
+}
+
+// mc_line() 等待空位时，等待入队的运动必定是下一个入队的块，可以作为第一个摘要；之后的摘要由 G 代码解析器
+// 从接收缓冲区中已收完的行预读。只要送入规划器的运动与摘要一致，最后一个块就不必在缓冲区末端停下。
+// 已有摘要时该运动应当就是第一个摘要，此时之前预读的摘要继续有效。
+uint8_t plan_summary_begin(float *target, plan_line_data_t *pl_data)
+{
+  plan_summary_state_t state;
+  plan_summary_t summary;
+  memcpy(state.position, pl.position, sizeof(pl.position));
+  memcpy(state.previous_unit_vec, pl.previous_unit_vec, sizeof(pl.previous_unit_vec));
+  state.previous_nominal_speed = pl.previous_nominal_speed;
+  uint8_t computed = plan_compute_summary(target, pl_data, &state, &summary);
+  if (lookahead.count)
+  {
+    if (computed && (summary.speed_sqr_delta == lookahead.summary[lookahead.tail].speed_sqr_delta))
+    {
+      return (PLAN_SUMMARY_CONTINUE);
+    }
+    // 摘要与实际送入的运动不一致。去掉摘要后最后一个块的退出速度降低，从尾块起完全重新规划。
+    plan_summary_clear();
+    plan_replan_from_tail();
+  }
+  if (!computed)
+  {
+    return (PLAN_SUMMARY_NONE);
+  }
+  lookahead.tail = 0;
+  lookahead.summary[0] = summary;
+  lookahead.count = 1;
+  memcpy(&lookahead.state, &state, sizeof(state));
+  planner_recalculate();
+  return (PLAN_SUMMARY_NEW);
+}
+
+uint8_t plan_summary_append(float *target, plan_line_data_t *pl_data)
+{
+  if (!lookahead.count || (lookahead.count == LOOKAHEAD_BUFFER_SIZE))
+  {
+    return (false);
+  }
+  if (!plan_compute_summary(target, pl_data, &lookahead.state, &lookahead.summary[plan_summary_index(lookahead.count)]))
+  {
+    return (false);
+  }
+  lookahead.count++;
+  lookahead.exit_valid = false;
+  // 最后一个块的退出速度只会提高，与加入新块一样从规划指针开始重新规划即可。
+  planner_recalculate();
+  return (true);
+}
 
+uint8_t plan_summary_available() { return (LOOKAHEAD_BUFFER_SIZE - lookahead.count); }
+
+// 新块入队时去掉对应的第一个摘要。合并的块包含第一个摘要的运动，同样去掉。新块入队后需要从尾块起完全
+// 重新规划时返回 true。
+static uint8_t plan_summary_pop(plan_block_t *block, uint8_t merged)
+{
+  if (!lookahead.count)
+  {
+    return (false);
+  }
+  plan_summary_t *summary = &lookahead.summary[lookahead.tail];
+  if (!merged && (block->speed_sqr_delta != summary->speed_sqr_delta))
+  {
+    // 送入的不是预读的运动。去掉摘要后退出速度降低。
+    plan_summary_clear();
+    return (true);
+  }
+  // 合并改变了前一运动的方向时，实际的入口限制可能低于摘要。低于之前规划的退出速度时，之前已是最优的块
+  // 需要更早减速。合并的块由合并时的检查处理。
+  uint8_t replan = (!merged && (block->max_entry_speed_sqr < plan_summary_exit_speed_sqr()));
+  lookahead.tail = plan_summary_index(1);
+  lookahead.count--;
+  lookahead.exit_valid = false;
+  return (replan);
+}
+#endif
+
+uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
+{
+#ifdef ENABLE_SEGMENT_MERGING
+  uint8_t merged = plan_pop_collinear_block(target, pl_data);
+  int32_t line_number = pl_data->line_number;
+  float merged_entry_speed_sqr = 0.0;
+  if (merged)
+  {
+    // 合并块报告第一行的行号，实时报告的行号不会超前于实际执行的位置。
+    line_number = block_buffer[block_buffer_head].line_number;
+    merged_entry_speed_sqr = block_buffer[block_buffer_head].entry_speed_sqr;
+  }
+#endif
+
+  // 准备并初始化新块。复制相关的 pl_data 以供块执行。
+  plan_block_t *block = &block_buffer[block_buffer_head];
+  memset(block, 0, sizeof(plan_block_t)); // 将所有块值置零。
+  block->condition = pl_data->condition;
+  block->spindle_speed = pl_data->spindle_speed;
+#ifdef ENABLE_SEGMENT_MERGING
+  block->line_number = line_number;
+#else
+  block->line_number = pl_data->line_number;
+#endif
+
+  // 计算并存储初始移动距离数据。
+  int32_t target_steps[N_AXIS], position_steps[N_AXIS];
+  uint32_t steps[N_AXIS], step_event_count;
+  float unit_vec[N_AXIS];
+  float acceleration, rapid_rate;
+  uint8_t idx;
+
+  // 根据计划的运动类型复制位置数据。
+  if (block->condition & PL_COND_FLAG_SYSTEM_MOTION)
+  {
+#ifdef COREXY
+    position_steps[X_AXIS] = system_convert_corexy_to_x_axis_steps(sys_position);
+    position_steps[Y_AXIS] = system_convert_corexy_to_y_axis_steps(sys_position);
+    position_steps[Z_AXIS] = sys_position[Z_AXIS];
+#else
+    memcpy(position_steps, sys_position, sizeof(sys_position));
+#endif
+  }
+  else
+  {
+    memcpy(position_steps, pl.position, sizeof(pl.position));
+  }
+
+  step_event_count = plan_compute_line_steps(target, position_steps, target_steps, steps, unit_vec);
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
     // 设置方向位。启用的位表示方向为负。
-    if (delta_mm < 0.0)
+    if (unit_vec[idx] < 0.0)
     {
       block->direction_bits |= get_direction_pin_mask(idx);
     }
   }
 
-  // 如果这是一个零长度块，则退出。极不可能发生。
-  if (block->step_event_count == 0)
+  // 步数超出块的存储范围时不缓冲，由 mc_line() 分段。合并检查保证合并块不会超出。
+  if (step_event_count > PLAN_BLOCK_MAX_STEPS)
+  {
+    return (PLAN_LONG_LINE);
+  }
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    plan_set_block_steps(block, idx, steps[idx]);
+  }
+
+#ifdef ENABLE_NATIVE_ARCS
+  float exit_unit_vec[N_AXIS];
+  if (pl_data->arc_travel != 0.0)
   {
-    return (PLAN_EMPTY_BLOCK);
+    // 圆弧块。整圆的起点和终点相同，步数为零也不是空块。
+    acceleration = plan_compute_arc_parameters(block, pl_data, unit_vec, exit_unit_vec, &rapid_rate);
   }
+  else
+#endif
+  {
+    // 如果这是一个零长度块，则退出。极不可能发生。
+    if (step_event_count == 0)
+    {
+      return (PLAN_EMPTY_BLOCK);
+    }
 
-  // 计算线性移动的单位向量以及块的最大进给速率和加速度，确保不超过各轴的最大值。
-  // 注意：该计算假设所有轴都是正交的（笛卡尔坐标系），并且可以与 ABC 轴一起工作，
-  // 如果它们也是正交/独立的。作用于单位向量的绝对值。
-  block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
-  block->acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
-  block->rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+    // 计算线性移动的单位向量以及块的最大进给速率和加速度，确保不超过各轴的最大值。
+    // 注意：该计算假设所有轴都是正交的（笛卡尔坐标系），并且可以与 ABC 轴一起工作，
+    // 如果它们也是正交/独立的。作用于单位向量的绝对值。
+    block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+    acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
+    rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+  }
+  block->speed_sqr_delta = 2 * acceleration * block->millimeters;
 
   // 存储编程速率。
   if (block->condition & PL_COND_FLAG_RAPID_MOTION)
   {
-    block->programmed_rate = block->rapid_rate;
+    block->programmed_rate = rapid_rate;
   }
   else
   {
@@ -450,46 +1226,57 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
     // 注意：最大连接速度是固定值，因为机器加速度限制在操作期间无法动态更改，且线性移动几何形状也无法更改。
     // 在进给速率覆盖改变块的名义速度时，必须将其保存在内存中，这可能会改变所有块的整体最大入口速度条件。
 
-    float junction_unit_vec[N_AXIS];
-    float junction_cos_theta = 0.0;
-    for (idx = 0; idx < N_AXIS; idx++)
-    {
-      junction_cos_theta -= pl.previous_unit_vec[idx] * unit_vec[idx];
-      junction_unit_vec[idx] = unit_vec[idx] - pl.previous_unit_vec[idx];
-    }
-
-    // 注意：通过三角函数半角恒等式计算，无需任何昂贵的三角函数 sin() 或 acos()。
-    if (junction_cos_theta > 0.999999)
-    {
-      // 对于 0 度的锐角连接，只需设置最小连接速度。
-      block->max_junction_speed_sqr = MINIMUM_JUNCTION_SPEED * MINIMUM_JUNCTION_SPEED;
-    }
-    else
-    {
-      if (junction_cos_theta < -0.999999)
-      {
-        // 连接是直线或 180 度。连接速度是无限的。
-        block->max_junction_speed_sqr = SOME_LARGE_VALUE;
-      }
-      else
-      {
-        convert_delta_vector_to_unit_vector(junction_unit_vec);
-        float junction_acceleration = limit_value_by_axis_maximum(settings.acceleration, junction_unit_vec);
-        float sin_theta_d2 = sqrt(0.5 * (1.0 - junction_cos_theta)); // 三角半角恒等式。始终为正。
-        block->max_junction_speed_sqr = max(MINIMUM_JUNCTION_SPEED * MINIMUM_JUNCTION_SPEED,
-                                            (junction_acceleration * settings.junction_deviation * sin_theta_d2) / (1.0 - sin_theta_d2));
-      }
-    }
+    block->max_junction_speed_sqr = plan_compute_junction_speed_sqr(pl.previous_unit_vec, unit_vec, pl_data);
   }
 
   // 阻止系统运动更新此数据，以确保下一个 G-code 运动正确计算。
   if (!(block->condition & PL_COND_FLAG_SYSTEM_MOTION))
   {
-    float nominal_speed = plan_compute_profile_nominal_speed(block);
+#ifdef ENABLE_SEGMENT_MERGING
+    // 保存入队前的状态，下一条线段与此块合并时恢复。
+    memcpy(pl.merge_position, pl.position, sizeof(pl.position));
+    memcpy(pl.merge_unit_vec, pl.previous_unit_vec, sizeof(pl.previous_unit_vec));
+    pl.merge_nominal_speed = pl.previous_nominal_speed;
+#ifdef ENABLE_PATH_CONTROL_MODES
+    pl.merge_path_tolerance = pl_data->path_tolerance;
+#endif
+    if (!merged)
+    {
+      pl.merge_deviation = 0.0;
+    }
+    pl.merge_ready = true;
+#endif
+
+    float nominal_speed = plan_compute_nominal_speed(block, rapid_rate, 0);
     plan_compute_profile_parameters(block, nominal_speed, pl.previous_nominal_speed);
+    // 覆盖更新进行中时部分块的最大入口速度已降低而入口速度尚未更新，新块入队后从尾块起完全重新规划。
+    uint8_t replan = pl.ovr_changed;
+#ifdef ENABLE_SEGMENT_MERGING
+    // 合并后与前一块的拐角更尖时，入口限制可能低于被弹出块已规划的入口速度，之前已是最优的块需要
+    // 更早减速，同样从尾块起完全重新规划。
+    if (merged && (block->max_entry_speed_sqr < merged_entry_speed_sqr))
+    {
+      replan = true;
+    }
+#endif
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+#ifdef ENABLE_SEGMENT_MERGING
+    replan |= plan_summary_pop(block, merged);
+#else
+    replan |= plan_summary_pop(block, false);
+#endif
+#endif
     pl.previous_nominal_speed = nominal_speed;
 
     // 更新前一个路径单位向量和规划器位置。
+#ifdef ENABLE_NATIVE_ARCS
+    if (block->arc_axes)
+    {
+      memcpy(pl.previous_unit_vec, exit_unit_vec, sizeof(exit_unit_vec)); // 圆弧终点的切向
+      arc_buffer_head = plan_next_arc_index(arc_buffer_head);
+    }
+    else
+#endif
     memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
     memcpy(pl.position, target_steps, sizeof(target_steps));  // pl.position[] = target_steps[]
 
@@ -498,7 +1285,14 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
     next_buffer_head = plan_next_block_index(block_buffer_head);
 
     // 最后通过新块重新计算计划。
-    planner_recalculate();
+    if (replan)
+    {
+      plan_replan_from_tail();
+    }
+    else
+    {
+      planner_recalculate();
+    }
   }
   return (PLAN_OK);
 }
@@ -508,6 +1302,12 @@ void plan_sync_position()
 {
   // TODO：对于与机器位置不在同一坐标系中的电机配置，
   // 此函数需要更新以适应差异。
+#ifdef ENABLE_SEGMENT_MERGING
+  pl.merge_ready = false;
+#endif
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  plan_summary_clear();
+#endif
   uint8_t idx;
   for (idx = 0; idx < N_AXIS; idx++)
   {
@@ -530,6 +1330,15 @@ void plan_sync_position()
   }
 }
 
+void plan_get_planner_mpos(float *target)
+{
+  uint8_t idx;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    target[idx] = pl.position[idx] / settings.steps_per_mm[idx];
+  }
+}
+
 // 返回规划器缓冲区中可用块的数量。
 uint8_t plan_get_block_buffer_available()
 {
@@ -18,12 +18,43 @@
 
 // 在任何给定时间内，计划中可以包含的线性运动数量
 #ifndef BLOCK_BUFFER_SIZE
-  #define BLOCK_BUFFER_SIZE 36
+  #define BLOCK_BUFFER_SIZE 40
 #endif
 
+// 圆弧块的几何数据单独存放，缓冲区中同时最多有这么多圆弧块。
+#ifndef ARC_BUFFER_SIZE
+  #define ARC_BUFFER_SIZE 16
+#endif
+
+// 第二级前瞻最多保存的运动摘要数。
+#ifndef LOOKAHEAD_BUFFER_SIZE
+  #define LOOKAHEAD_BUFFER_SIZE 24
+#endif
+
+// 覆盖改变后，主程序每次调用 plan_update_velocity_profile_parameters() 最多更新的块数。更新完成之前，
+// 除正在执行的尾块外其余块仍按原覆盖值执行。主程序每把一个块送入规划器至少经过一次实时检查点，
+// 因此更新最多在 ceil((BLOCK_BUFFER_SIZE - 1) / (PLAN_OVERRIDE_UPDATE_BLOCKS - 1)) 个检查点（默认 6 个）
+// 内完成，随后从尾块起完全重新规划。更新期间入队的块同样完全重新规划，入口速度始终不超过能减速到的值。
+#ifndef PLAN_OVERRIDE_UPDATE_BLOCKS
+  #define PLAN_OVERRIDE_UPDATE_BLOCKS 8
+#endif
+
+// 块的每轴步数以 24 位存储。更长的直线由 mc_line() 分成几个块。
+#define PLAN_BLOCK_MAX_STEPS 0xFFFFFFUL
+
+// 传给 plan_request_velocity_profile_update() 的覆盖类型。
+#define PLAN_OVR_FEED  bit(0)
+#define PLAN_OVR_RAPID bit(1)
+
+// plan_summary_begin() 的返回值。
+#define PLAN_SUMMARY_NONE     0 // 运动不能作为摘要，第二级前瞻为空
+#define PLAN_SUMMARY_NEW      1 // 第二级前瞻从该运动重新开始
+#define PLAN_SUMMARY_CONTINUE 2 // 该运动就是已有的第一个摘要，之后的摘要继续有效
+
 // 从规划器返回的状态消息。
 #define PLAN_OK true
 #define PLAN_EMPTY_BLOCK false
+#define PLAN_LONG_LINE 2 // 有轴的步数超过 PLAN_BLOCK_MAX_STEPS，未缓冲。
 
 // 定义规划器数据条件标志。用于表示块的运行条件。
 #define PL_COND_FLAG_RAPID_MOTION      bit(0)
@@ -39,11 +70,12 @@
 
 // 此结构存储 g-code 块运动的线性运动及其关键的“标称”值
 // 按照源 g-code 中的规定。
+// 注意：块缓冲区占用 Grbl 的大部分 RAM，只保存不能由其他字段求出的值。最大步数由各轴步数求出，
+// 加速度由 speed_sqr_delta 和 millimeters 求出，轴限制的最大速率见 plan_compute_profile_nominal_speed()。
 typedef struct {
   // Bresenham 算法用于跟踪线的字段
   // 注意：由步进器算法正确执行块。请勿更改这些值。
-  uint32_t steps[N_AXIS];    // 每个轴的步数
-  uint32_t step_event_count; // 完成此块所需的最大步轴计数和步数。
+  uint8_t steps[N_AXIS][3];  // 每个轴的步数，24 位小端。通过 plan_get_block_steps() 读取。
   uint8_t direction_bits;    // 此块的方向位设置（引用 config.h 中的 *_DIRECTION_BIT）
 
   // 块条件数据以确保根据状态和覆盖进行正确执行。
@@ -55,27 +87,51 @@ typedef struct {
   float entry_speed_sqr;     // 块连接处当前计划的入速（mm/min）^2
   float max_entry_speed_sqr; // 基于连接限制和相邻标称速度的最小值的最大允许入速
                              // （mm/min）^2
-  float acceleration;        // 轴限制调整后的线加速度（mm/min^2）。不改变。
   float millimeters;         // 此块在执行中的剩余距离（mm）。
                              // 注意：此值可能在执行过程中由步进算法更改。
+  float speed_sqr_delta;     // 以最大加速度走完剩余距离时速度平方的变化：2*加速度*millimeters
+                             // （mm/min）^2。与 millimeters 一起更新。
 
   // 规划器在发生变化时使用的速率限制数据。
   float max_junction_speed_sqr; // 基于方向向量的连接入速限制（mm/min）^2
-  float rapid_rate;             // 此块方向的轴限制调整后的最大速率（mm/min）
   float programmed_rate;        // 此块的编程速率（mm/min）。
 
   // 用于主轴覆盖和恢复方法的存储主轴速度数据。
   float spindle_speed;    // 块主轴速度。复制自 pl_line_data。
+
+  #ifdef ENABLE_NATIVE_ARCS
+    // 圆弧块。steps[] 和 direction_bits 仍为起点到终点的总步数，由步进段准备逐段插补。
+    uint8_t arc_axes;     // 平面轴：低 4 位为第一轴，高 4 位为第二轴。为零时为直线块。
+  #endif
 } plan_block_t;
 
+#ifdef ENABLE_NATIVE_ARCS
+  // 圆弧块的几何数据，按块的顺序存放在圆弧缓冲区中。
+  typedef struct {
+    float travel;     // 角行程（弧度，逆时针为正）
+    float offset[2];  // 圆心相对块起点的偏移（mm），按平面轴顺序
+  } plan_arc_t;
+#endif
+
 // 规划器数据原型。传递新运动给规划器时必须使用。
 typedef struct {
   float feed_rate;          // 线性运动所需的进给速率。如果是快速运动，则忽略该值。
   float spindle_speed;      // 线性运动的所需主轴速度。
   int32_t line_number;    // 执行时要报告的所需行号。
   uint8_t condition;        // 指示规划器条件的位标志变量。请参阅上面的定义。
+  #ifdef ENABLE_PATH_CONTROL_MODES
+    float path_tolerance;   // 与上一运动连接处的连接偏差（mm）。为零时使用 $11，PL_PATH_EXACT_STOP 时在连接处停止。
+  #endif
+  #ifdef ENABLE_NATIVE_ARCS
+    float arc_travel;       // 非零时为圆弧：角行程（弧度，逆时针为正）。
+    float arc_offset[2];    // 圆心相对起点的偏移（mm）
+    uint8_t arc_axis_0;     // 圆弧平面的两个轴
+    uint8_t arc_axis_1;
+  #endif
 } plan_line_data_t;
 
+#define PL_PATH_EXACT_STOP -1.0 // G61.1
+
 // 初始化并重置运动计划子系统
 void plan_reset(); // 重置所有
 void plan_reset_buffer(); // 仅重置缓冲区。
@@ -95,16 +151,32 @@ plan_block_t *plan_get_system_motion_block();
 // 获取当前块。如果缓冲区为空则返回 NULL
 plan_block_t *plan_get_current_block();
 
+#ifdef ENABLE_NATIVE_ARCS
+  // 获取当前块的圆弧数据。仅当当前块为圆弧块时有效。
+  plan_arc_t *plan_get_current_arc();
+#endif
+
+// 返回块在某轴上的步数。
+uint32_t plan_get_block_steps(plan_block_t *block, uint8_t idx);
+
 // 由步进段缓冲区定期调用。主要由规划器内部使用。
 uint8_t plan_next_block_index(uint8_t block_index);
 
 // 在计算执行块速度曲线时由步进段缓冲区调用。
 float plan_get_exec_block_exit_speed_sqr();
 
+#ifdef GRBL_SIM
+  // 仿真检查：返回入口速度要求减速快于加速度允许的块数，正确的规划应为 0。
+  uint8_t plan_check_entry_speeds();
+#endif
+
 // 在主程序进行规划计算和步进段缓冲区初始化期间调用。
 float plan_compute_profile_nominal_speed(plan_block_t *block);
 
-// 在基于运动的覆盖变化后重新计算缓冲运动的配置参数。
+// 进给或快速覆盖改变后调用，开始更新缓冲运动的配置参数。
+void plan_request_velocity_profile_update(uint8_t ovr_changed);
+
+// 分批完成覆盖变化后的更新，没有待更新的块时立即返回。由实时执行循环调用。
 void plan_update_velocity_profile_parameters();
 
 // 重置规划器位置向量（以步数计）
@@ -120,9 +192,26 @@ uint8_t plan_get_block_buffer_available();
 // 注意：已弃用。除非在 config.h 中启用经典状态报告，否则不使用。
 uint8_t plan_get_block_buffer_count();
 
-// 返回块环缓冲区的状态。如果缓冲区已满，则返回 true。
+// 返回块环缓冲区的状态。如果缓冲区或圆弧缓冲区已满，则返回 true。
 uint8_t plan_check_full_buffer();
 
+// 返回规划器位置（mm），即最后一个缓冲块的终点。
 void plan_get_planner_mpos(float *target);
 
+#ifdef ENABLE_SEGMENT_MERGING
+  // 返回复位以来合并的线段数。
+  uint32_t plan_get_merge_count();
+#endif
+
+#ifdef ENABLE_LOOKAHEAD_SUMMARY
+  // 块缓冲区已满时由 mc_line() 调用，把等待入队的运动作为第二级前瞻的第一个摘要。
+  uint8_t plan_summary_begin(float *target, plan_line_data_t *pl_data);
+
+  // 在最后一个摘要之后加入一个运动摘要。第二级前瞻已满或为空、运动不能作为摘要时返回 false。
+  uint8_t plan_summary_append(float *target, plan_line_data_t *pl_data);
+
+  // 第二级前瞻中空闲的摘要数。
+  uint8_t plan_summary_available();
+#endif
+
 #endif
@@ -25,6 +25,7 @@
 #define LINE_FLAG_OVERFLOW bit(0)
 #define LINE_FLAG_COMMENT_PARENTHESES bit(1)
 #define LINE_FLAG_COMMENT_SEMICOLON bit(2)
+#define LINE_FLAG_PROGRAM_MARK bit(3)
 
 
 static char line[LINE_BUFFER_SIZE]; // 要执行的行。零结尾。
@@ -32,6 +33,21 @@ static char line[LINE_BUFFER_SIZE]; // 要执行的行。零结尾。
 static void protocol_exec_rt_suspend();
 
 
+// 应答一行 G 代码。窗口应答模式下以行首的 N 字作为序号。
+static void protocol_report_gcode_status(char *line, uint8_t status_code)
+{
+  #ifdef ENABLE_WINDOWED_ACK
+    uint8_t char_counter = 1;
+    float sequence;
+    if (sys.ack_window && (line[0] == 'N') && read_float(line, &char_counter, &sequence)) {
+      report_sequenced_status(status_code, trunc(sequence));
+      return;
+    }
+  #endif
+  report_status_message(status_code);
+}
+
+
 /*
   GRBL 主循环：
 */
@@ -71,15 +87,48 @@ void protocol_main_loop()
   uint8_t line_flags = 0;
   uint8_t char_counter = 0;
   uint8_t c;
+  #ifdef ENABLE_MOTION_FRAME
+    frame_reset(); // 丢弃复位前未收完的帧
+  #endif
+  #ifdef ENABLE_WINDOWED_ACK
+    report_ack_reset(); // 复位前未应答的行已随接收缓冲区一起丢弃
+  #endif
+  gc_tokenize_reset();
   for (;;) {
 
     // 处理一行传入的串行数据，当数据可用时进行处理。
     // 通过删除空格和注释并将所有字母大写来进行初步过滤。
-    while((c = serial_read()) != SERIAL_NO_DATA) {
+    #ifdef ENABLE_MOTION_FRAME
+      // 运动帧内的字节可能等于 SERIAL_NO_DATA，因此按缓冲区计数读取。
+      while (serial_get_rx_buffer_count()) {
+        c = serial_read();
+    #else
+      while((c = serial_read()) != SERIAL_NO_DATA) {
+    #endif
+      #ifdef ENABLE_MOTION_FRAME
+        // 二进制运动帧不经过行过滤和 G 代码解析，收齐后直接执行并像一行一样应答。
+        if (frame_collecting() || (c == CMD_MOTION_FRAME)) {
+          if (frame_collect(c)) {
+            protocol_execute_realtime(); // 运行时命令检查点。
+            if (sys.abort) { return; } // 系统中止时返回调用函数
+            mc_arc_finish();
+            if (sys.abort) { return; }
+            #ifdef ENABLE_WINDOWED_ACK
+              uint8_t status_code = frame_execute();
+              report_sequenced_status(status_code, frame_sequence());
+            #else
+              report_status_message(frame_execute());
+            #endif
+          }
+          continue;
+        }
+      #endif
       if ((c == '\n') || (c == '\r')) { // 到达行末
 
         protocol_execute_realtime(); // 运行时命令检查点。
         if (sys.abort) { return; } // 系统中止时返回调用函数
+        mc_arc_finish(); // 上一行的圆弧全部进入规划器后才能执行这一行。
+        if (sys.abort) { return; }
 
         line[char_counter] = 0; // 设置字符串结束字符。
         #ifdef REPORT_ECHO_LINE_RECEIVED
@@ -90,6 +139,12 @@ void protocol_main_loop()
         if (line_flags & LINE_FLAG_OVERFLOW) {
           // 报告行溢出错误。
           report_status_message(STATUS_OVERFLOW);
+        #ifdef ENABLE_PROGRAM_MODE
+        } else if (line_flags & LINE_FLAG_PROGRAM_MARK) {
+          // '%' 行开始或结束程序。
+          sys.program_mode = !sys.program_mode;
+          report_status_message(STATUS_OK);
+        #endif
         } else if (line[0] == 0) {
           // 空行或注释行。用于同步。
           report_status_message(STATUS_OK);
@@ -98,15 +153,20 @@ void protocol_main_loop()
           report_status_message(system_execute_line(line));
         } else if (sys.state & (STATE_ALARM | STATE_JOG)) {
           // 其他情况均为 gcode。如果处于警报或 jog 模式，则阻止。
-          report_status_message(STATUS_SYSTEM_GC_LOCK);
+          protocol_report_gcode_status(line, STATUS_SYSTEM_GC_LOCK);
         } else {
-          // 解析并执行 g-code 块。
-          report_status_message(gc_execute_line(line));
+          // 执行接收时已分好字的 g-code 块。
+          protocol_report_gcode_status(line, gc_execute_tokens(line));
+          #ifdef ENABLE_PROGRAM_MODE
+            // 程序中的运动立即开始执行，不等待接收缓冲区为空。
+            if (sys.program_mode) { protocol_auto_cycle_start(); }
+          #endif
         }
 
         // 重置下一行的跟踪数据。
         line_flags = 0;
         char_counter = 0;
+        gc_tokenize_reset();
 
       } else {
 
@@ -131,25 +191,27 @@ void protocol_main_loop()
           } else if (c == ';') {
             // 注意：';' 注释到 EOL 是 LinuxCNC 定义的，非 NIST 标准。
             line_flags |= LINE_FLAG_COMMENT_SEMICOLON;
-          // TODO: 添加 '%' 特性
-          // } else if (c == '%') {
-            // 不支持程序起止百分号。
-            // 注意：可以用于告知 Grbl 程序的运行状态（程序运行 vs 手动输入），
-            // 在程序期间，系统将自动开始执行所有任务直到下一个 '%' 符号。
-            // 这有助于解决某些任务清空规划器缓冲区以按时执行的问题。
+          #ifdef ENABLE_PROGRAM_MODE
+          } else if ((c == '%') && (char_counter == 0)) {
+            // 程序起止百分号。该行其余字符与注释一样丢弃。
+            line_flags |= LINE_FLAG_PROGRAM_MARK;
+          #endif
           } else if (char_counter >= (LINE_BUFFER_SIZE-1)) {
             // 检测到行缓冲区溢出并设置标志。
             line_flags |= LINE_FLAG_OVERFLOW;
-          } else if (c >= 'a' && c <= 'z') { // 转换小写字母为大写
-            line[char_counter++] = c-'a'+'A';
           } else {
-            line[char_counter++] = c;
+            if (c >= 'a' && c <= 'z') { c -= 'a'-'A'; } // 转换小写字母为大写
+            line[char_counter++] = c; // 行缓冲区仍用于 '$' 命令
+            gc_tokenize_char(c); // 在接收时完成分词
           }
         }
 
       }
     }
 
+    // 继续展开上一行的圆弧。规划器满时立即返回，主循环继续接收和分词下一行。
+    mc_arc_continue();
+
     // 如果串行读取缓冲区中没有更多字符可处理和执行，
     // 则表示 g-code 流已填满计划缓冲区或已完成。
     // 无论是哪种情况，如果启用了自动循环启动，将执行所有排队的移动。
@@ -172,6 +234,8 @@ void protocol_main_loop()
 // 以便在需要时生效。同时等待干净的循环结束。
 void protocol_buffer_synchronize()
 {
+  mc_arc_finish(); // 未送完的圆弧段也属于缓存的运动
+  if (sys.abort) { return; }
   // 如果系统已排队，确保循环恢复（如果自动启动标志存在）。
   protocol_auto_cycle_start();
   do {
@@ -203,11 +267,36 @@ void protocol_auto_cycle_start()
 // 注意：sys_rt_exec_state 变量标志由任何过程、步进或串行中断、输出引脚、限位开关或主程序设置。
 void protocol_execute_realtime()
 {
+  #ifdef GRBL_SIM
+    sim_idle(); // 主机仿真：主程序在此让出 CPU，虚拟时钟前进并派发到期的中断。
+  #endif
   protocol_exec_rt_system();
   if (sys.suspend) { protocol_exec_rt_suspend(); }
 }
 
 
+// 在收到请求的串口上回复副串口状态报告和二进制状态帧。
+static void protocol_exec_report_request()
+{
+  uint8_t port;
+  for (port = 0; port < SERIAL_N_PORT; port++) {
+    uint8_t request = serial_get_report_request(port);
+    if (!request) { continue; }
+    #ifdef ENABLE_AUX_SERIAL
+      serial_select_output(port);
+      if (request & SERIAL_REQUEST_STATUS) { report_aux_realtime_status(); }
+    #endif
+    #ifdef ENABLE_STATUS_FRAME
+      if (request & SERIAL_REQUEST_FRAME) { report_status_frame(port, false); }
+      else if (request & SERIAL_REQUEST_FRAME_DELTA) { report_status_frame(port, true); }
+    #endif
+    #ifdef ENABLE_AUX_SERIAL
+      serial_select_output(SERIAL_PORT_MAIN);
+    #endif
+  }
+}
+
+
 // 当需要时执行运行时命令。此函数主要作为 Grbl 的状态机，
 // 控制 Grbl 提供的各种实时功能。
 // 注意：除非完全了解，否则不要更改此处！
@@ -232,6 +321,12 @@ void protocol_exec_rt_system()
     system_clear_exec_alarm(); // 清除报警
   }
 
+  protocol_exec_report_request();
+
+  #ifdef ENABLE_STATUS_PUSH
+    if (status_push_due()) { system_set_exec_state_flag(EXEC_STATUS_REPORT); }
+  #endif
+
   rt_exec = sys_rt_exec_state; // 复制易变的 sys_rt_exec_state。
   if (rt_exec) {
 
@@ -391,14 +486,12 @@ void protocol_exec_rt_system()
   // 执行覆盖。
   rt_exec = sys_rt_exec_motion_override; // 复制易变的 sys_rt_exec_motion_override
   if (rt_exec) {
-    system_clear_exec_motion_overrides(); // 清除所有运动覆盖标志。
+    int16_t feed_delta = system_clear_exec_motion_overrides(); // 清除所有运动覆盖标志并取出累加的增减。
 
-    uint8_t new_f_override =  sys.f_override;
+    // 先复位再加上复位之后收到的增减。
+    int16_t new_f_override =  sys.f_override;
     if (rt_exec & EXEC_FEED_OVR_RESET) { new_f_override = DEFAULT_FEED_OVERRIDE; }
-    if (rt_exec & EXEC_FEED_OVR_COARSE_PLUS) { new_f_override += FEED_OVERRIDE_COARSE_INCREMENT; }
-    if (rt_exec & EXEC_FEED_OVR_COARSE_MINUS) { new_f_override -= FEED_OVERRIDE_COARSE_INCREMENT; }
-    if (rt_exec & EXEC_FEED_OVR_FINE_PLUS) { new_f_override += FEED_OVERRIDE_FINE_INCREMENT; }
-    if (rt_exec & EXEC_FEED_OVR_FINE_MINUS) { new_f_override -= FEED_OVERRIDE_FINE_INCREMENT; }
+    new_f_override += feed_delta;
     new_f_override = min(new_f_override,MAX_FEED_RATE_OVERRIDE);
     new_f_override = max(new_f_override,MIN_FEED_RATE_OVERRIDE);
 
@@ -407,14 +500,18 @@ void protocol_exec_rt_system()
     if (rt_exec & EXEC_RAPID_OVR_MEDIUM) { new_r_override = RAPID_OVERRIDE_MEDIUM; }
     if (rt_exec & EXEC_RAPID_OVR_LOW) { new_r_override = RAPID_OVERRIDE_LOW; }
 
-    if ((new_f_override != sys.f_override) || (new_r_override != sys.r_override)) {
+    uint8_t ovr_changed = 0;
+    if (new_f_override != sys.f_override) { ovr_changed |= PLAN_OVR_FEED; }
+    if (new_r_override != sys.r_override) { ovr_changed |= PLAN_OVR_RAPID; }
+    if (ovr_changed) {
       sys.f_override = new_f_override;
       sys.r_override = new_r_override;
       sys.report_ovr_counter = 0; // 设置为立即报告更改
-      plan_update_velocity_profile_parameters();
-      plan_cycle_reinitialize();
+      plan_request_velocity_profile_update(ovr_changed);
     }
   }
+  // 分批更新缓冲区中受覆盖影响的块，每次调用的耗时有上限。
+  plan_update_velocity_profile_parameters();
 
   rt_exec = sys_rt_exec_accessory_override;
   if (rt_exec) {
@@ -100,6 +100,14 @@ static void report_util_uint8_setting(uint8_t n, int val)
   print_uint8_base10(val);
   report_util_line_feed(); // report_util_setting_string(n);
 }
+#ifdef ENABLE_STATUS_PUSH
+static void report_util_uint32_setting(uint8_t n, uint32_t val)
+{
+  report_util_setting_prefix(n);
+  print_uint32_base10(val);
+  report_util_line_feed(); // report_util_setting_string(n);
+}
+#endif
 static void report_util_float_setting(uint8_t n, float val, uint8_t n_decimal)
 {
   report_util_setting_prefix(n);
@@ -112,6 +120,9 @@ static void report_util_float_setting(uint8_t n, float val, uint8_t n_decimal)
 // 错误事件可以来自 G-code 解析器、设置模块或异步的关键错误，例如触发的硬限制。接口应始终监视这些响应。
 void report_status_message(uint8_t status_code)
 {
+  #ifdef ENABLE_WINDOWED_ACK
+    report_ack_flush(); // 保持应答顺序
+  #endif
   switch (status_code)
   {
   case STATUS_OK: // STATUS_OK
@@ -124,6 +135,43 @@ void report_status_message(uint8_t status_code)
   }
 }
 
+#ifdef ENABLE_WINDOWED_ACK
+  static uint8_t ack_pending;   // 已处理但尚未应答的行数
+  static uint32_t ack_sequence; // 其中最后一行的序号
+
+  void report_sequenced_status(uint8_t status_code, int32_t sequence)
+  {
+    if (!sys.ack_window || (sequence < 0)) {
+      report_status_message(status_code);
+      return;
+    }
+    if (status_code == STATUS_OK) {
+      ack_sequence = sequence;
+      if (++ack_pending >= sys.ack_window) { report_ack_flush(); }
+    } else {
+      // 出错的行也算已处理，上位机据此释放该行之前的全部行。
+      report_ack_flush();
+      printPgmString(PSTR("error:"));
+      print_uint8_base10(status_code);
+      serial_write(':');
+      print_uint32_base10(sequence);
+      report_util_line_feed();
+    }
+  }
+
+  void report_ack_flush()
+  {
+    if (ack_pending) {
+      ack_pending = 0;
+      printPgmString(PSTR("ok:"));
+      print_uint32_base10(ack_sequence);
+      report_util_line_feed();
+    }
+  }
+
+  void report_ack_reset() { ack_pending = 0; }
+#endif
+
 // 打印警报消息。
 void report_alarm_message(uint8_t alarm_code)
 {
@@ -186,7 +234,7 @@ void report_init_message()
 // Grbl 帮助消息
 void report_grbl_help()
 {
-  printPgmString(PSTR("[帮助:$$ $# $G $I $N $x=值 $Nx=行 $J=行 $SLP $C $X $H ~ ! ? ctrl-x]\r\n"));
+  printPgmString(PSTR("[帮助:$$ $# $G $I $N $M $x=值 $Nx=行 $Mx=行 $J=行 $SLP $C $X $H ~ ! ? ctrl-x]\r\n"));
 }
 
 // Grbl 全局设置打印。
@@ -205,6 +253,9 @@ void report_grbl_settings()
   report_util_float_setting(11, settings.junction_deviation, N_DECIMAL_SETTINGVALUE);
   report_util_float_setting(12, settings.arc_tolerance, N_DECIMAL_SETTINGVALUE);
   report_util_uint8_setting(13, bit_istrue(settings.flags, BITFLAG_REPORT_INCHES));
+#ifdef ENABLE_STATUS_PUSH
+  report_util_uint32_setting(14, settings.status_push_interval);
+#endif
   report_util_uint8_setting(20, bit_istrue(settings.flags, BITFLAG_SOFT_LIMIT_ENABLE));
   report_util_uint8_setting(21, bit_istrue(settings.flags, BITFLAG_HARD_LIMIT_ENABLE));
   report_util_uint8_setting(22, bit_istrue(settings.flags, BITFLAG_HOMING_ENABLE));
@@ -355,6 +406,12 @@ void report_gcode_modes()
     printPgmString(PSTR("38."));
     print_uint8_base10(gc_state.modal.motion - (MOTION_MODE_PROBE_TOWARD - 2));
   }
+#ifdef ENABLE_SPLINES
+  else if (gc_state.modal.motion == MOTION_MODE_QUADRATIC_SPLINE)
+  {
+    printPgmString(PSTR("5.1"));
+  }
+#endif
   else
   {
     print_uint8_base10(gc_state.modal.motion);
@@ -375,6 +432,26 @@ void report_gcode_modes()
   report_util_gcode_modes_G();
   print_uint8_base10(94 - gc_state.modal.feed_rate);
 
+#ifdef ENABLE_CANNED_CYCLES
+  report_util_gcode_modes_G();
+  print_uint8_base10(98 + gc_state.modal.retract);
+#endif
+
+#ifdef ENABLE_PATH_CONTROL_MODES
+  report_util_gcode_modes_G();
+  switch (gc_state.modal.control)
+  {
+  case CONTROL_MODE_EXACT_PATH:
+    print_uint8_base10(61);
+    break;
+  case CONTROL_MODE_EXACT_STOP:
+    printPgmString(PSTR("61.1"));
+    break;
+  default:
+    print_uint8_base10(64);
+  }
+#endif
+
   if (gc_state.modal.program_flow)
   {
     report_util_gcode_modes_M();
@@ -444,6 +521,17 @@ void report_startup_line(uint8_t n, char *line)
   report_util_line_feed();
 }
 
+#ifdef ENABLE_MACRO
+void report_macro(uint8_t n, char *line)
+{
+  printPgmString(PSTR("$M"));
+  print_uint8_base10(n);
+  serial_write('=');
+  printString(line);
+  report_util_line_feed();
+}
+#endif
+
 void report_execute_startup_message(char *line, uint8_t status_code)
 {
   serial_write('>');
@@ -835,6 +923,158 @@ void report_realtime_status()
   report_util_line_feed();
 }
 
+
+#ifdef ENABLE_AUX_SERIAL
+// 副串口使用自己的 WCO 和倍率刷新计数，高频轮询不会推迟主串口报告中这些字段的刷新。
+void report_aux_realtime_status()
+{
+  static uint8_t aux_wco_counter = 0;
+  static uint8_t aux_ovr_counter = 0;
+  uint8_t wco_counter = sys.report_wco_counter;
+  uint8_t ovr_counter = sys.report_ovr_counter;
+  sys.report_wco_counter = aux_wco_counter;
+  sys.report_ovr_counter = aux_ovr_counter;
+  report_realtime_status();
+  aux_wco_counter = sys.report_wco_counter;
+  aux_ovr_counter = sys.report_ovr_counter;
+  sys.report_wco_counter = wco_counter;
+  sys.report_ovr_counter = ovr_counter;
+}
+#endif
+
+
+#ifdef ENABLE_STATUS_FRAME
+#define STATUS_FRAME_FIELD_BYTES (2 + 4 + 4 + 3 + 2 + 2 + 2)
+
+static const uint8_t status_frame_field_size[STATUS_FRAME_N_FIELD] = { 2, 4, 4, 3, 2, 2, 2 };
+
+// 状态帧的内容。字段组已按帧格式排好，可以直接逐字节比较和发送。
+typedef struct {
+  int32_t position[N_AXIS];
+  uint8_t field[STATUS_FRAME_FIELD_BYTES];
+} status_frame_t;
+
+static status_frame_t status_frame_last[SERIAL_N_PORT]; // 各串口上一次发出的帧
+static uint8_t status_frame_sent; // 位 n：串口 n 已发出过帧
+static uint8_t status_frame_checksum;
+
+
+static void status_frame_put_uint16(uint8_t **ptr, uint16_t value)
+{
+  *(*ptr)++ = value & 0xff;
+  *(*ptr)++ = value >> 8;
+}
+
+
+static void status_frame_put_int32(uint8_t **ptr, int32_t value)
+{
+  status_frame_put_uint16(ptr, (uint32_t)value & 0xffff);
+  status_frame_put_uint16(ptr, (uint32_t)value >> 16);
+}
+
+
+// 浮点速度转换为帧中的 uint16，超出范围时饱和。
+static uint16_t status_frame_rate(float value)
+{
+  if (value <= 0.0) { return (0); }
+  if (value >= 65535.0) { return (0xffff); }
+  return ((uint16_t)(value + 0.5));
+}
+
+
+static void status_frame_write(uint8_t data)
+{
+  status_frame_checksum += data;
+  serial_write(data);
+}
+
+
+void report_status_frame(uint8_t port, uint8_t delta)
+{
+  status_frame_t frame;
+  status_frame_t *last = &status_frame_last[port];
+  int32_t position_delta[N_AXIS];
+  uint8_t axis_mask = 0, field_mask = 0;
+  uint8_t idx, n;
+
+  memcpy(frame.position, sys_position, sizeof(sys_position));
+  uint8_t *ptr = frame.field;
+  *ptr++ = sys.state;
+  *ptr++ = sys.suspend;
+  plan_block_t *cur_block = plan_get_current_block();
+  status_frame_put_int32(&ptr, (cur_block != NULL) ? cur_block->line_number : 0);
+  status_frame_put_uint16(&ptr, status_frame_rate(st_get_realtime_rate()));
+  status_frame_put_uint16(&ptr, status_frame_rate(sys.spindle_speed));
+  *ptr++ = sys.f_override;
+  *ptr++ = sys.r_override;
+  *ptr++ = sys.spindle_speed_ovr;
+  *ptr++ = plan_get_block_buffer_available();
+  *ptr++ = serial_get_rx_buffer_available();
+  *ptr++ = limits_get_state();
+  *ptr++ = system_control_get_state() | (probe_get_state() ? bit(7) : 0);
+  *ptr++ = spindle_get_state() | (coolant_get_state() << 2);
+  *ptr++ = settings.tool;
+
+  // 增量帧：比较每轴位置和每个字段组，任一轴增量超出 int16 时改为完整帧。
+  uint8_t length = 3; // 字段掩码、轴掩码、校验和
+  if (bit_isfalse(status_frame_sent, bit(port))) { delta = false; }
+  if (delta) {
+    for (idx = 0; idx < N_AXIS; idx++) {
+      position_delta[idx] = frame.position[idx] - last->position[idx];
+      if (position_delta[idx] == 0) { continue; }
+      if ((position_delta[idx] > INT16_MAX) || (position_delta[idx] < INT16_MIN)) {
+        delta = false;
+        break;
+      }
+      axis_mask |= bit(idx);
+      length += 2;
+    }
+    ptr = frame.field;
+    for (n = 0; n < STATUS_FRAME_N_FIELD; n++) {
+      if (memcmp(ptr, &last->field[ptr - frame.field], status_frame_field_size[n])) {
+        field_mask |= bit(n);
+        length += status_frame_field_size[n];
+      }
+      ptr += status_frame_field_size[n];
+    }
+  }
+  if (!delta) { length = 4 * N_AXIS + STATUS_FRAME_FIELD_BYTES + 1; }
+
+  serial_write(delta ? CMD_STATUS_FRAME_DELTA : CMD_STATUS_FRAME);
+  serial_write(length);
+  status_frame_checksum = 0;
+  if (delta) {
+    status_frame_write(field_mask);
+    status_frame_write(axis_mask);
+    for (idx = 0; idx < N_AXIS; idx++) {
+      if (bit_isfalse(axis_mask, bit(idx))) { continue; }
+      status_frame_write(position_delta[idx] & 0xff);
+      status_frame_write((position_delta[idx] >> 8) & 0xff);
+    }
+  } else {
+    field_mask = (1 << STATUS_FRAME_N_FIELD) - 1;
+    for (idx = 0; idx < N_AXIS; idx++) {
+      uint32_t value = frame.position[idx];
+      for (n = 0; n < 4; n++) {
+        status_frame_write(value & 0xff);
+        value >>= 8;
+      }
+    }
+  }
+  ptr = frame.field;
+  for (n = 0; n < STATUS_FRAME_N_FIELD; n++) {
+    if (bit_istrue(field_mask, bit(n))) {
+      for (idx = 0; idx < status_frame_field_size[n]; idx++) { status_frame_write(ptr[idx]); }
+    }
+    ptr += status_frame_field_size[n];
+  }
+  serial_write(status_frame_checksum);
+
+  memcpy(last, &frame, sizeof(status_frame_t));
+  status_frame_sent |= bit(port);
+}
+#endif
+
 #ifdef DEBUG
 void report_realtime_debug()
 {
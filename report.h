@@ -55,6 +55,8 @@
 #define STATUS_GCODE_UNUSED_WORDS 36
 #define STATUS_GCODE_G43_DYNAMIC_AXIS_ERROR 37
 #define STATUS_GCODE_MAX_VALUE_EXCEEDED 38
+#define STATUS_FRAME_INVALID 39 // 二进制运动帧长度或校验和错误
+#define STATUS_MACRO_NESTED 40  // 宏中调用了宏
 
 // 定义 Grbl 报警代码。有效值（1-255）。0 为保留。
 #define ALARM_HARD_LIMIT_ERROR      EXEC_ALARM_HARD_LIMIT
@@ -83,6 +85,17 @@
 // 打印系统状态消息。
 void report_status_message(uint8_t status_code);
 
+#ifdef ENABLE_WINDOWED_ACK
+  // 按序号应答一行。窗口应答模式下成功的行累计到窗口满时应答，序号为负或未启用时同 report_status_message()。
+  void report_sequenced_status(uint8_t status_code, int32_t sequence);
+
+  // 应答窗口内已处理但尚未应答的行。
+  void report_ack_flush();
+
+  // 丢弃尚未应答的窗口。复位时调用。
+  void report_ack_reset();
+#endif
+
 // 打印系统报警消息。
 void report_alarm_message(uint8_t alarm_code);
 
@@ -104,6 +117,54 @@ void report_echo_line_received(char *line);
 // 打印实时状态报告
 void report_realtime_status();
 
+#ifdef ENABLE_AUX_SERIAL
+  // 打印副串口的实时状态报告。输出通道由调用者选择。
+  void report_aux_realtime_status();
+#endif
+
+/*
+  二进制状态帧。多字节值为小端，与运动帧（见 frame.h）一样以 8 位累加和结尾。
+
+    字节 0      CMD_STATUS_FRAME（完整帧）或 CMD_STATUS_FRAME_DELTA（增量帧）
+    字节 1      长度：其后的字节数（含校验和）
+
+  完整帧依次为：
+    int32       每轴一个，机器位置，单位为步（sys_position）
+    字段组      按 STATUS_FRAME_FIELD_* 的位顺序排列：
+                  STATE      uint8 状态（sys.state）、uint8 挂起位（sys.suspend）
+                  LINE       int32 正在执行的块的行号，没有时为 0
+                  RATE       uint16 实时进给速度 mm/min、uint16 主轴转速 RPM
+                  OVERRIDE   uint8 进给、快速、主轴倍率百分比
+                  BUFFER     uint8 规划器可用块数、接收缓冲区可用字节数
+                  PINS       uint8 限位引脚（位 n 为轴 n）、uint8 控制引脚（CONTROL_PIN_INDEX_*，位 7 为探针）
+                  ACCESSORY  uint8 主轴（位 0-1，SPINDLE_STATE_*）和冷却（位 2-3，COOLANT_STATE_*）、uint8 刀号
+    校验和      字节 2 至校验和之前全部字节的 8 位累加和
+
+  增量帧依次为：
+    uint8       字段掩码，变化的字段组
+    uint8       轴掩码，位置变化的轴
+    int16       轴掩码中每轴一个，相对上一帧的位置增量，单位为步
+    字段组      字段掩码中的字段组，格式同完整帧
+    校验和
+
+  增量相对该串口上一次发出的帧（完整或增量）。该串口尚未发出过帧，或某轴增量超出 int16 时，
+  增量请求回复完整帧。上位机丢失帧或控制器复位后应请求一次完整帧。机器状态不变时增量帧为 5 字节。
+  工作坐标偏移不在帧内，可用 $# 查询。
+*/
+#define STATUS_FRAME_FIELD_STATE      bit(0)
+#define STATUS_FRAME_FIELD_LINE       bit(1)
+#define STATUS_FRAME_FIELD_RATE       bit(2)
+#define STATUS_FRAME_FIELD_OVERRIDE   bit(3)
+#define STATUS_FRAME_FIELD_BUFFER     bit(4)
+#define STATUS_FRAME_FIELD_PINS       bit(5)
+#define STATUS_FRAME_FIELD_ACCESSORY  bit(6)
+#define STATUS_FRAME_N_FIELD 7
+
+#ifdef ENABLE_STATUS_FRAME
+  // 在当前输出通道上打印二进制状态帧。port 为请求所在的串口，各串口分别记录增量的参考帧。
+  void report_status_frame(uint8_t port, uint8_t delta);
+#endif
+
 // 打印记录的探测位置
 void report_probe_parameters();
 
@@ -117,6 +178,11 @@ void report_gcode_modes();
 void report_startup_line(uint8_t n, char *line);
 void report_execute_startup_message(char *line, uint8_t status_code);
 
+#ifdef ENABLE_MACRO
+// 打印存储的宏
+void report_macro(uint8_t n, char *line);
+#endif
+
 // 打印构建信息和用户信息
 void report_build_info(char *line);
 
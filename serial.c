@@ -26,10 +26,28 @@ uint8_t serial_rx_buffer[RX_RING_BUFFER]; // 接收缓冲区
 uint8_t serial_rx_buffer_head = 0; // 接收缓冲区头部索引
 volatile uint8_t serial_rx_buffer_tail = 0; // 接收缓冲区尾部索引
 
+#ifdef ENABLE_MOTION_FRAME
+  #define RX_FRAME_LENGTH_PENDING 0xff // 已收到帧起始字节，下一字节为长度
+  static uint8_t serial_rx_frame_remaining = 0; // 当前运动帧尚未收到的原始字节数
+  static uint8_t serial_rx_frame_discard = false; // 读取缓冲区在帧中途被清除，帧的其余字节丢弃
+#endif
+
 uint8_t serial_tx_buffer[TX_RING_BUFFER]; // 发送缓冲区
 uint8_t serial_tx_buffer_head = 0; // 发送缓冲区头部索引
 volatile uint8_t serial_tx_buffer_tail = 0; // 发送缓冲区尾部索引
 
+static volatile uint8_t serial_report_request[SERIAL_N_PORT]; // 各通道收到的报告请求，见 SERIAL_REQUEST_*
+
+#ifdef ENABLE_AUX_SERIAL
+  #define AUX_TX_RING_BUFFER (AUX_TX_BUFFER_SIZE+1)
+
+  // 副串口只有发送缓冲区。接收中断直接执行实时命令，没有需要缓冲的字节。
+  uint8_t serial_aux_tx_buffer[AUX_TX_RING_BUFFER];
+  uint8_t serial_aux_tx_buffer_head = 0;
+  volatile uint8_t serial_aux_tx_buffer_tail = 0;
+  static uint8_t serial_output = SERIAL_PORT_MAIN;
+#endif
+
 
 // 返回 RX 串口缓冲区中可用的字节数。
 uint8_t serial_get_rx_buffer_available()
@@ -41,12 +59,12 @@ uint8_t serial_get_rx_buffer_available()
 
 
 // 返回 RX 串口缓冲区中已使用的字节数。
-// 注意：已废弃。除非在 config.h 中启用经典状态报告，否则不会使用。
+// 注意：启用运动帧时主循环按此计数读取，见 protocol_main_loop()。
 uint8_t serial_get_rx_buffer_count()
 {
   uint8_t rtail = serial_rx_buffer_tail; // 复制以限制对 volatile 的多次调用
   if (serial_rx_buffer_head >= rtail) { return(serial_rx_buffer_head-rtail); }
-  return (RX_BUFFER_SIZE - (rtail-serial_rx_buffer_head));
+  return (RX_RING_BUFFER - (rtail-serial_rx_buffer_head));
 }
 
 
@@ -77,19 +95,99 @@ void serial_init()
   UCSR0B |= (1<<RXEN0 | 1<<TXEN0 | 1<<RXCIE0);
 
   // 默认为 8 位，无奇偶校验，1 个停止位
+
+  #ifdef ENABLE_AUX_SERIAL
+    #if AUX_BAUD_RATE < 57600
+      uint16_t UBRR1_value = ((F_CPU / (8L * AUX_BAUD_RATE)) - 1)/2 ;
+      UCSR1A &= ~(1 << U2X1);
+    #else
+      uint16_t UBRR1_value = ((F_CPU / (4L * AUX_BAUD_RATE)) - 1)/2;
+      UCSR1A |= (1 << U2X1);
+    #endif
+    UBRR1H = UBRR1_value >> 8;
+    UBRR1L = UBRR1_value;
+    SERIAL_AUX_RX_PORT |= (1 << SERIAL_AUX_RX_BIT); // 上拉 RX1，未接设备时引脚悬空不会收到杂散字节。
+    UCSR1B |= (1<<RXEN1 | 1<<TXEN1 | 1<<RXCIE1);
+  #endif
+}
+
+
+uint8_t serial_get_report_request(uint8_t port)
+{
+  uint8_t request = serial_report_request[port];
+  if (request) {
+    uint8_t sreg = SREG;
+    cli();
+    request = serial_report_request[port];
+    serial_report_request[port] = 0;
+    SREG = sreg;
+  }
+  return (request);
+}
+
+
+// 等待发送缓冲区腾出空间时调用。长报告期间继续准备步进段，避免段缓冲区在运动中被取空。
+// 注意：这里不执行其他实时命令，否则状态报告等输出会插入到正在打印的报告中间。
+static void serial_tx_wait()
+{
+  if (sys.state & (STATE_CYCLE | STATE_HOLD | STATE_SAFETY_DOOR | STATE_HOMING | STATE_JOG)) {
+    st_prep_buffer();
+  }
+  #ifdef GRBL_SIM
+    sim_idle(); // 主机仿真：推进虚拟时钟，让发送中断腾出空间。
+  #endif
+}
+
+
+#ifdef ENABLE_AUX_SERIAL
+void serial_select_output(uint8_t port) { serial_output = port; }
+
+
+static void serial_aux_write(uint8_t data)
+{
+  uint8_t next_head = serial_aux_tx_buffer_head + 1;
+  if (next_head == AUX_TX_RING_BUFFER) { next_head = 0; }
+
+  while (next_head == serial_aux_tx_buffer_tail) {
+    if (sys_rt_exec_state & EXEC_RESET) { return; }
+    serial_tx_wait();
+  }
+
+  serial_aux_tx_buffer[serial_aux_tx_buffer_head] = data;
+  serial_aux_tx_buffer_head = next_head;
+  UCSR1B |=  (1 << UDRIE1);
 }
 
 
+ISR(SERIAL_AUX_UDRE)
+{
+  uint8_t tail = serial_aux_tx_buffer_tail;
+  UDR1 = serial_aux_tx_buffer[tail];
+  tail++;
+  if (tail == AUX_TX_RING_BUFFER) { tail = 0; }
+  serial_aux_tx_buffer_tail = tail;
+  if (tail == serial_aux_tx_buffer_head) { UCSR1B &= ~(1 << UDRIE1); }
+}
+#endif
+
+
 // 向 TX 串口缓冲区写入一个字节。由主程序调用。
 void serial_write(uint8_t data) {
+  #ifdef ENABLE_AUX_SERIAL
+    if (serial_output == SERIAL_PORT_AUX) {
+      serial_aux_write(data);
+      return;
+    }
+  #endif
+
   // 计算下一个头部索引
   uint8_t next_head = serial_tx_buffer_head + 1;
   if (next_head == TX_RING_BUFFER) { next_head = 0; }
 
   // 等待缓冲区有空间
   while (next_head == serial_tx_buffer_tail) {
-    // TODO: 重新构建 st_prep_buffer() 的调用，以便在长打印期间在这里执行。
     if (sys_rt_exec_state & EXEC_RESET) { return; } // 仅检查中止以避免无限循环。
+    serial_tx_wait();
   }
 
   // 存储数据并前进头部
@@ -138,63 +236,160 @@ uint8_t serial_read()
 }
 
 
+// 返回下一个要读取的字节在接收缓冲区中的索引，供 serial_peek() 从该处开始查看。
+uint8_t serial_get_rx_read_index() { return (serial_rx_buffer_tail); }
+
+
+// 查看接收缓冲区中 index 处尚未读取的字节，不从缓冲区中移出。没有更多数据时返回 false，否则把字节存入
+// data 并把 index 移到下一字节。
+uint8_t serial_peek(uint8_t *index, uint8_t *data)
+{
+  uint8_t rx_index = *index;
+  if (rx_index == serial_rx_buffer_head) { return (false); }
+  *data = serial_rx_buffer[rx_index];
+  rx_index++;
+  if (rx_index == RX_RING_BUFFER) { rx_index = 0; }
+  *index = rx_index;
+  return (true);
+}
+
+
+// 记录二进制状态帧请求，由主程序在该通道上回复。data 是状态帧命令时返回 true。
+static uint8_t serial_report_command(uint8_t port, uint8_t data)
+{
+  #ifdef ENABLE_STATUS_FRAME
+    switch (data) {
+      case CMD_STATUS_FRAME: serial_report_request[port] |= SERIAL_REQUEST_FRAME; return (true);
+      case CMD_STATUS_FRAME_DELTA: serial_report_request[port] |= SERIAL_REQUEST_FRAME_DELTA; return (true);
+    }
+  #endif
+  return (false);
+}
+
+
+// 执行状态查询以外的实时命令。data 是实时命令时返回 true。主串口和副串口的接收中断共用。
+static uint8_t serial_execute_realtime(uint8_t data)
+{
+  switch (data) {
+    case CMD_RESET:         mc_reset(); break; // 调用运动控制重置例程。
+    case CMD_CYCLE_START:   system_set_exec_state_flag(EXEC_CYCLE_START); break; // 设置为真
+    case CMD_FEED_HOLD:     system_set_exec_state_flag(EXEC_FEED_HOLD); break; // 设置为真
+    case CMD_SAFETY_DOOR:   system_set_exec_state_flag(EXEC_SAFETY_DOOR); break; // 设置为真
+    case CMD_JOG_CANCEL:   
+      if (sys.state & STATE_JOG) { // 阻止其他状态调用运动取消。
+        system_set_exec_state_flag(EXEC_MOTION_CANCEL); 
+      }
+      break; 
+    #ifdef DEBUG
+      case CMD_DEBUG_REPORT: {uint8_t sreg = SREG; cli(); bit_true(sys_rt_exec_debug,EXEC_DEBUG_REPORT); SREG = sreg;} break; // 调试报告
+    #endif
+    case CMD_FEED_OVR_RESET: system_set_exec_motion_override_flag(EXEC_FEED_OVR_RESET); break;
+    case CMD_FEED_OVR_COARSE_PLUS: system_add_exec_feed_override(FEED_OVERRIDE_COARSE_INCREMENT); break;
+    case CMD_FEED_OVR_COARSE_MINUS: system_add_exec_feed_override(-FEED_OVERRIDE_COARSE_INCREMENT); break;
+    case CMD_FEED_OVR_FINE_PLUS: system_add_exec_feed_override(FEED_OVERRIDE_FINE_INCREMENT); break;
+    case CMD_FEED_OVR_FINE_MINUS: system_add_exec_feed_override(-FEED_OVERRIDE_FINE_INCREMENT); break;
+    case CMD_RAPID_OVR_RESET: system_set_exec_motion_override_flag(EXEC_RAPID_OVR_RESET); break;
+    case CMD_RAPID_OVR_MEDIUM: system_set_exec_motion_override_flag(EXEC_RAPID_OVR_MEDIUM); break;
+    case CMD_RAPID_OVR_LOW: system_set_exec_motion_override_flag(EXEC_RAPID_OVR_LOW); break;
+    case CMD_SPINDLE_OVR_RESET: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_RESET); break;
+    case CMD_SPINDLE_OVR_COARSE_PLUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_COARSE_PLUS); break;
+    case CMD_SPINDLE_OVR_COARSE_MINUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_COARSE_MINUS); break;
+    case CMD_SPINDLE_OVR_FINE_PLUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_FINE_PLUS); break;
+    case CMD_SPINDLE_OVR_FINE_MINUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_FINE_MINUS); break;
+    case CMD_SPINDLE_OVR_STOP: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_STOP); break;
+    case CMD_COOLANT_FLOOD_OVR_TOGGLE: system_set_exec_accessory_override_flag(EXEC_COOLANT_FLOOD_OVR_TOGGLE); break;
+    case CMD_COOLANT_MIST_OVR_TOGGLE: system_set_exec_accessory_override_flag(EXEC_COOLANT_MIST_OVR_TOGGLE); break;
+    default: return (false);
+  }
+  return (true);
+}
+
+
 ISR(SERIAL_RX)
 {
   uint8_t data = UDR0; // 从接收数据寄存器读取数据
   uint8_t next_head;
 
+  #ifdef ENABLE_MOTION_FRAME
+    // 运动帧内的字节原样写入缓冲区，不识别实时命令。
+    if (serial_rx_frame_remaining) {
+      if (serial_rx_frame_remaining == RX_FRAME_LENGTH_PENDING) {
+        serial_rx_frame_remaining = (data <= FRAME_MAX_LENGTH) ? data : 0;
+      } else {
+        serial_rx_frame_remaining--;
+      }
+      if (serial_rx_frame_discard) {
+        if (!serial_rx_frame_remaining) { serial_rx_frame_discard = false; }
+        return;
+      }
+      next_head = serial_rx_buffer_head + 1;
+      if (next_head == RX_RING_BUFFER) { next_head = 0; }
+      if (next_head != serial_rx_buffer_tail) {
+        serial_rx_buffer[serial_rx_buffer_head] = data;
+        serial_rx_buffer_head = next_head;
+      }
+      return;
+    }
+  #endif
+
   // 从串行流中直接获取实时命令字符。这些字符
   // 不会传递到主缓冲区，而是设置系统状态标志位以便实时执行。
-  switch (data) {
-    case CMD_RESET:         mc_reset(); break; // 调用运动控制重置例程。
-    case CMD_STATUS_REPORT: system_set_exec_state_flag(EXEC_STATUS_REPORT); break; // 设置为真
-    case CMD_CYCLE_START:   system_set_exec_state_flag(EXEC_CYCLE_START); break; // 设置为真
-    case CMD_FEED_HOLD:     system_set_exec_state_flag(EXEC_FEED_HOLD); break; // 设置为真
-    default :
-      if (data > 0x7F) { // 实时控制字符仅为扩展 ASCII。
-        switch(data) {
-          case CMD_SAFETY_DOOR:   system_set_exec_state_flag(EXEC_SAFETY_DOOR); break; // 设置为真
-          case CMD_JOG_CANCEL:   
-            if (sys.state & STATE_JOG) { // 阻止其他状态调用运动取消。
-              system_set_exec_state_flag(EXEC_MOTION_CANCEL); 
-            }
-            break; 
-          #ifdef DEBUG
-            case CMD_DEBUG_REPORT: {uint8_t sreg = SREG; cli(); bit_true(sys_rt_exec_debug,EXEC_DEBUG_REPORT); SREG = sreg;} break; // 调试报告
-          #endif
-          case CMD_FEED_OVR_RESET: system_set_exec_motion_override_flag(EXEC_FEED_OVR_RESET); break;
-          case CMD_FEED_OVR_COARSE_PLUS: system_set_exec_motion_override_flag(EXEC_FEED_OVR_COARSE_PLUS); break;
-          case CMD_FEED_OVR_COARSE_MINUS: system_set_exec_motion_override_flag(EXEC_FEED_OVR_COARSE_MINUS); break;
-          case CMD_FEED_OVR_FINE_PLUS: system_set_exec_motion_override_flag(EXEC_FEED_OVR_FINE_PLUS); break;
-          case CMD_FEED_OVR_FINE_MINUS: system_set_exec_motion_override_flag(EXEC_FEED_OVR_FINE_MINUS); break;
-          case CMD_RAPID_OVR_RESET: system_set_exec_motion_override_flag(EXEC_RAPID_OVR_RESET); break;
-          case CMD_RAPID_OVR_MEDIUM: system_set_exec_motion_override_flag(EXEC_RAPID_OVR_MEDIUM); break;
-          case CMD_RAPID_OVR_LOW: system_set_exec_motion_override_flag(EXEC_RAPID_OVR_LOW); break;
-          case CMD_SPINDLE_OVR_RESET: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_RESET); break;
-          case CMD_SPINDLE_OVR_COARSE_PLUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_COARSE_PLUS); break;
-          case CMD_SPINDLE_OVR_COARSE_MINUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_COARSE_MINUS); break;
-          case CMD_SPINDLE_OVR_FINE_PLUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_FINE_PLUS); break;
-          case CMD_SPINDLE_OVR_FINE_MINUS: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_FINE_MINUS); break;
-          case CMD_SPINDLE_OVR_STOP: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_STOP); break;
-          case CMD_COOLANT_FLOOD_OVR_TOGGLE: system_set_exec_accessory_override_flag(EXEC_COOLANT_FLOOD_OVR_TOGGLE); break;
-          case CMD_COOLANT_MIST_OVR_TOGGLE: system_set_exec_accessory_override_flag(EXEC_COOLANT_MIST_OVR_TOGGLE); break;
-        }
-        // 丢弃任何未找到的扩展 ASCII 字符，不将其传递到串口缓冲区。
-      } else { // 将字符写入缓冲区
+  if (data == CMD_STATUS_REPORT) {
+    system_set_exec_state_flag(EXEC_STATUS_REPORT); // 设置为真
+    return;
+  }
+  if (serial_report_command(SERIAL_PORT_MAIN, data)) { return; }
+  if (serial_execute_realtime(data)) { return; }
+
+  if (data > 0x7F) { // 实时控制字符仅为扩展 ASCII。
+    #ifdef ENABLE_MOTION_FRAME
+      if (data == CMD_MOTION_FRAME) {
+        // 帧起始字节写入缓冲区，供主程序识别。
         next_head = serial_rx_buffer_head + 1;
         if (next_head == RX_RING_BUFFER) { next_head = 0; }
-
-        // 将数据写入缓冲区，除非已满。
         if (next_head != serial_rx_buffer_tail) {
           serial_rx_buffer[serial_rx_buffer_head] = data;
           serial_rx_buffer_head = next_head;
         }
+        serial_rx_frame_remaining = RX_FRAME_LENGTH_PENDING;
       }
+    #endif
+    return; // 丢弃任何未找到的扩展 ASCII 字符，不将其传递到串口缓冲区。
+  }
+
+  // 将字符写入缓冲区
+  next_head = serial_rx_buffer_head + 1;
+  if (next_head == RX_RING_BUFFER) { next_head = 0; }
+
+  // 将数据写入缓冲区，除非已满。
+  if (next_head != serial_rx_buffer_tail) {
+    serial_rx_buffer[serial_rx_buffer_head] = data;
+    serial_rx_buffer_head = next_head;
   }
 }
 
 
+#ifdef ENABLE_AUX_SERIAL
+// 副串口只接受实时命令，其余字节丢弃。
+ISR(SERIAL_AUX_RX)
+{
+  uint8_t data = UDR1;
+  if (data == CMD_STATUS_REPORT) { serial_report_request[SERIAL_PORT_AUX] |= SERIAL_REQUEST_STATUS; }
+  else if (!serial_report_command(SERIAL_PORT_AUX, data)) { serial_execute_realtime(data); }
+}
+#endif
+
+
 void serial_reset_read_buffer()
 {
-  serial_rx_buffer_tail = serial_rx_buffer_head; // 重置读取缓冲区
+  #ifdef ENABLE_MOTION_FRAME
+    // 与接收中断互斥：帧头已随缓冲区清除，帧的其余字节不能再作为 ASCII 行或新的帧写入缓冲区。
+    uint8_t sreg = SREG;
+    cli();
+    serial_rx_buffer_tail = serial_rx_buffer_head; // 重置读取缓冲区
+    if (serial_rx_frame_remaining) { serial_rx_frame_discard = true; }
+    SREG = sreg;
+  #else
+    serial_rx_buffer_tail = serial_rx_buffer_head; // 重置读取缓冲区
+  #endif
 }
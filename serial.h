@@ -26,8 +26,26 @@
   #define TX_BUFFER_SIZE 255
 #endif
 
+#ifndef AUX_TX_BUFFER_SIZE
+  #define AUX_TX_BUFFER_SIZE 255 // 至少容纳一条完整的状态报告，轮询时不必等待发送
+#endif
+
 #define SERIAL_NO_DATA 0xff
 
+// 串口通道编号，用于 serial_select_output() 和 serial_get_report_request()
+#define SERIAL_PORT_MAIN 0
+#define SERIAL_PORT_AUX  1
+#ifdef ENABLE_AUX_SERIAL
+  #define SERIAL_N_PORT 2
+#else
+  #define SERIAL_N_PORT 1
+#endif
+
+// serial_get_report_request() 返回的请求位。主串口的 '?' 仍通过 EXEC_STATUS_REPORT 处理。
+#define SERIAL_REQUEST_STATUS       bit(0) // 副串口的 '?'
+#define SERIAL_REQUEST_FRAME        bit(1) // 完整二进制状态帧
+#define SERIAL_REQUEST_FRAME_DELTA  bit(2) // 增量二进制状态帧
+
 void serial_init();
 
 // 将一个字节写入 TX 串口缓冲区。由主程序调用。
@@ -36,6 +54,12 @@ void serial_write(uint8_t data);
 // 获取串口读取缓冲区中的第一个字节。由主程序调用。
 uint8_t serial_read();
 
+// 返回下一个要读取的字节在接收缓冲区中的索引。
+uint8_t serial_get_rx_read_index();
+
+// 查看 index 处尚未读取的字节而不移出。由 G 代码解析器预读后续的行。
+uint8_t serial_peek(uint8_t *index, uint8_t *data);
+
 // 重置并清空读取缓冲区中的数据。由急停和重置使用。
 void serial_reset_read_buffer();
 
@@ -50,4 +74,12 @@ uint8_t serial_get_rx_buffer_count();
 // 注意：除调试和确保没有 TX 瓶颈外不使用。
 uint8_t serial_get_tx_buffer_count();
 
+#ifdef ENABLE_AUX_SERIAL
+  // 选择 serial_write() 的输出通道。打印副串口的回复后应立即恢复为 SERIAL_PORT_MAIN。
+  void serial_select_output(uint8_t port);
+#endif
+
+// 返回并清除通道上收到的报告请求（SERIAL_REQUEST_* 位）。由主程序调用。
+uint8_t serial_get_report_request(uint8_t port);
+
 #endif
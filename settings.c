@@ -38,6 +38,16 @@ void settings_store_build_info(char *line)
   memcpy_to_eeprom_with_checksum(EEPROM_ADDR_BUILD_INFO, (char *)line, LINE_BUFFER_SIZE);
 }
 
+#ifdef ENABLE_MACRO
+// 将宏存储到 EEPROM 的方法
+// 注意：此函数只能在 IDLE 状态下调用。
+void settings_store_macro(uint8_t n, char *line)
+{
+  uint32_t addr = n * (MACRO_SIZE + 1) + EEPROM_ADDR_MACRO;
+  memcpy_to_eeprom_with_checksum(addr, (char *)line, MACRO_SIZE);
+}
+#endif
+
 // 将坐标数据参数存储到 EEPROM 的方法
 void settings_write_coord_data(uint8_t coord_select, float *coord_data)
 {
@@ -66,6 +76,7 @@ void settings_restore(uint8_t restore_flag)
     settings.step_invert_mask = DEFAULT_STEPPING_INVERT_MASK;
     settings.dir_invert_mask = DEFAULT_DIRECTION_INVERT_MASK;
     settings.status_report_mask = DEFAULT_STATUS_REPORT_MASK;
+    settings.status_push_interval = DEFAULT_STATUS_PUSH_INTERVAL;
     settings.junction_deviation = DEFAULT_JUNCTION_DEVIATION;
     settings.arc_tolerance = DEFAULT_ARC_TOLERANCE;
 
@@ -189,6 +200,18 @@ void settings_restore(uint8_t restore_flag)
     eeprom_put_char(EEPROM_ADDR_BUILD_INFO, 0);
     eeprom_put_char(EEPROM_ADDR_BUILD_INFO + 1, 0); // 校验和
   }
+
+#ifdef ENABLE_MACRO
+  if (restore_flag & SETTINGS_RESTORE_MACROS)
+  {
+    uint8_t n;
+    for (n = 0; n < N_MACRO; n++)
+    {
+      eeprom_put_char(n * (MACRO_SIZE + 1) + EEPROM_ADDR_MACRO, 0);
+      eeprom_put_char(n * (MACRO_SIZE + 1) + EEPROM_ADDR_MACRO + 1, 0); // 校验和
+    }
+  }
+#endif
 }
 
 // 从 EEPROM 读取启动行。更新指向的行字符串数据。
@@ -218,6 +241,22 @@ uint8_t settings_read_build_info(char *line)
   return (true);
 }
 
+#ifdef ENABLE_MACRO
+// 从 EEPROM 读取宏 n。更新指向的行字符串数据。
+uint8_t settings_read_macro(uint8_t n, char *line)
+{
+  uint32_t addr = n * (MACRO_SIZE + 1) + EEPROM_ADDR_MACRO;
+  if (!(memcpy_from_eeprom_with_checksum((char *)line, addr, MACRO_SIZE)))
+  {
+    // 用默认值重置宏
+    line[0] = 0; // 空宏
+    settings_store_macro(n, line);
+    return (false);
+  }
+  return (true);
+}
+#endif
+
 // 从 EEPROM 读取所选坐标数据。更新指向的 coord_data 值。
 uint8_t settings_read_coord_data(uint8_t coord_select, float *coord_data)
 {
@@ -424,6 +463,16 @@ uint8_t settings_store_global_setting(uint8_t parameter, float value)
       }
       system_flag_wco_change(); // 确保 WCO 立即更新。
       break;
+#ifdef ENABLE_STATUS_PUSH
+    case 14:
+      if ((value < 0.0) || (value > STATUS_PUSH_INTERVAL_MAX))
+      {
+        return (STATUS_INVALID_STATEMENT);
+      }
+      settings.status_push_interval = trunc(value);
+      status_push_init(); // 立即按新的间隔推送。
+      break;
+#endif
     case 20:
       if (int_value)
       {
@@ -27,9 +27,11 @@
 #define EEPROM_LINE_SIZE 80 // EEPROM 行大小
 #endif
 
+#define MACRO_SIZE 255 // 每个宏在 EEPROM 中的字节数（含结尾的 0，另加 1 字节校验和）
+
 // EEPROM 数据的版本。将在固件升级时用于从旧版本的 Grbl 迁移现有数据。
 // 始终存储在 EEPROM 的字节 0 中
-#define SETTINGS_VERSION 10 // 注意：移动到下一个版本时，请检查 settings_reset()。
+#define SETTINGS_VERSION 11 // 注意：移动到下一个版本时，请检查 settings_reset()。
 
 // 定义 settings.flag 中布尔设置的位标志掩码。
 #define BITFLAG_REPORT_INCHES bit(0)     // 报告英寸
@@ -50,6 +52,7 @@
 #define SETTINGS_RESTORE_PARAMETERS bit(1)    // 恢复参数
 #define SETTINGS_RESTORE_STARTUP_LINES bit(2) // 恢复启动行
 #define SETTINGS_RESTORE_BUILD_INFO bit(3)    // 恢复构建信息
+#define SETTINGS_RESTORE_MACROS bit(4)        // 清除宏
 #ifndef SETTINGS_RESTORE_ALL
 #define SETTINGS_RESTORE_ALL 0xFF // 所有位标志
 #endif
@@ -59,6 +62,13 @@
 #define EEPROM_ADDR_PARAMETERS 512U    // 参数地址
 #define EEPROM_ADDR_STARTUP_BLOCK 768U // 启动块地址
 #define EEPROM_ADDR_BUILD_INFO 942U    // 构建信息地址
+#define EEPROM_ADDR_MACRO 1536U        // 宏地址，位于启动行和构建信息之后
+
+#if defined(ENABLE_MACRO) && defined(E2END)
+  #if (EEPROM_ADDR_MACRO + N_MACRO * (MACRO_SIZE + 1) > E2END + 1)
+    #error "N_MACRO 个宏超出 EEPROM 容量。"
+  #endif
+#endif
 
 // 定义坐标参数的 EEPROM 地址索引
 #define N_COORDINATE_SYSTEM 6                        // 支持的工作坐标系数量（从索引 1 开始）
@@ -91,6 +101,7 @@ typedef struct
   uint8_t dir_invert_mask;        // 方向反转掩码
   uint8_t stepper_idle_lock_time; // 如果最大值为 255，则步进电机不禁用。
   uint8_t status_report_mask;     // 指示所需报告数据的掩码。
+  uint16_t status_push_interval;  // 自动推送状态报告的间隔（毫秒），0 为禁用。
   float junction_deviation;       // 交汇偏差
   float arc_tolerance;            // 弧容差
 
@@ -134,6 +145,14 @@ void settings_store_build_info(char *line);
 // 读取用户定义的构建信息字符串
 uint8_t settings_read_build_info(char *line);
 
+#ifdef ENABLE_MACRO
+// 存储宏 n
+void settings_store_macro(uint8_t n, char *line);
+
+// 读取宏 n。line 至少为 MACRO_SIZE 字节。
+uint8_t settings_read_macro(uint8_t n, char *line);
+#endif
+
 // 将选定的坐标数据写入 EEPROM
 void settings_write_coord_data(uint8_t coord_select, float *coord_data);
 
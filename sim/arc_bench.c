@@ -0,0 +1,229 @@
+/*
+  arc_bench.c - 圆弧插补器的性能基准
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  用法：arc_bench [-r 重复次数] [语料名 ...]
+
+    每个语料是一组圆弧，直接调用 mc_arc_begin() 和 mc_arc_next() 展开为直线段，不经过规划器，
+  因此计时只包含插补器本身（启用 ENABLE_NATIVE_ARCS 时 mc_arc() 不使用插补器，但插补器仍可单独
+  测量）。结果为每段平均耗时和每秒生成的段数。
+    另外用双精度按段号计算每段终点的精确位置，报告插补结果与其最大距离（漂移），包括平面内的
+  旋转误差和平面外各轴的线性插值误差。与 plan_bench 一样，主机耗时只用于不同提交之间的相对比较：
+  主机有硬件浮点，ATmega2560 上软件浮点运算和 sin()/cos() 的代价要大得多。
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include "grbl.h"
+#include "avr_sim.h"
+
+#define BENCH_MAX_ARCS 2000
+
+typedef struct {
+  float position[N_AXIS];
+  float target[N_AXIS];
+  float offset[N_AXIS];
+  float angular_travel;
+  uint8_t axis_0, axis_1;
+} bench_arc_t;
+
+typedef struct {
+  const char *name;
+  const char *description;
+  void (*generate)(void);
+} corpus_t;
+
+static struct {
+  uint16_t n_arc;
+  bench_arc_t arc[BENCH_MAX_ARCS];
+} bench;
+
+
+static uint64_t bench_now_ns()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return ((uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+
+// 加入一段圆弧：圆心在 axis_0/axis_1 平面内的 (c0, c1)，起点角 start，逆时针转过 travel 弧度，
+// 平面外的轴按 delta 移动。
+static void bench_add(float c0, float c1, float radius, float start, float travel, uint8_t axis_0, uint8_t axis_1,
+                      const float *delta)
+{
+  if (bench.n_arc == BENCH_MAX_ARCS) { return; }
+  bench_arc_t *arc = &bench.arc[bench.n_arc++];
+  uint8_t idx;
+  memset(arc, 0, sizeof(bench_arc_t));
+  for (idx = 0; idx < N_AXIS; idx++) {
+    if (delta) { arc->target[idx] = delta[idx]; }
+  }
+  arc->position[axis_0] = c0 + radius * cos(start);
+  arc->position[axis_1] = c1 + radius * sin(start);
+  arc->target[axis_0] = c0 + radius * cos(start + travel);
+  arc->target[axis_1] = c1 + radius * sin(start + travel);
+  arc->offset[axis_0] = c0 - arc->position[axis_0];
+  arc->offset[axis_1] = c1 - arc->position[axis_1];
+  arc->angular_travel = travel;
+  arc->axis_0 = axis_0;
+  arc->axis_1 = axis_1;
+}
+
+
+// 小圆角：半径 0.5-3 毫米的 90 度圆弧，每段圆弧只有几段，圆弧开始的开销占主要部分。
+static void corpus_fillet()
+{
+  uint16_t n;
+  for (n = 0; n < 2000; n++) {
+    bench_add(10, 10, 0.5 + 0.25 * (n % 11), 0.5 * M_PI * (n % 4), ((n & 1) ? -0.5 : 0.5) * M_PI, X_AXIS, Y_AXIS, NULL);
+  }
+}
+
+
+// 整圆：半径 5-50 毫米，顺逆交替。
+static void corpus_circle()
+{
+  uint16_t n;
+  for (n = 0; n < 200; n++) {
+    bench_add(0, 0, 5 + 5 * (n % 10), 0.1 * n, ((n & 1) ? -2 : 2) * M_PI, X_AXIS, Y_AXIS, NULL);
+  }
+}
+
+
+// 大半径：半径 500 毫米的整圆，每段圆弧数千段，漂移修正的效果最明显。
+static void corpus_large()
+{
+  uint16_t n;
+  for (n = 0; n < 4; n++) {
+    bench_add(0, 0, 500, 0.3 * n, 2 * M_PI, X_AXIS, Y_AXIS, NULL);
+  }
+}
+
+
+// 四轴螺旋：YZ 平面内半径 20 毫米的整圆，X 进给 5 毫米，A 轴同时转 360 度。
+static void corpus_helix()
+{
+  float delta[N_AXIS] = { 0 };
+  uint16_t n;
+  for (n = 0; n < 100; n++) {
+    delta[X_AXIS] = 5 * (n + 1);
+    delta[A_AXIS] = 360;
+    bench_add(0, 0, 20, 0, -2 * M_PI, Y_AXIS, Z_AXIS, delta);
+    bench.arc[bench.n_arc - 1].position[X_AXIS] = 5 * n;
+  }
+}
+
+
+static const corpus_t corpora[] = {
+  { "fillet", "小半径 90 度圆角", corpus_fillet },
+  { "circle", "5-50 毫米整圆", corpus_circle },
+  { "large", "500 毫米整圆", corpus_large },
+  { "helix", "YZ 平面螺旋加 X 和 A 轴", corpus_helix },
+};
+#define N_CORPUS (sizeof(corpora) / sizeof(corpus_t))
+
+
+static uint16_t bench_begin(bench_arc_t *arc)
+{
+  return (mc_arc_begin(arc->target, arc->position, arc->offset, hypot(arc->offset[arc->axis_0], arc->offset[arc->axis_1]),
+                       arc->angular_travel, arc->axis_0, arc->axis_1));
+}
+
+
+// 按段号求精确终点，返回插补器所给终点与其最大距离。
+static double bench_drift(bench_arc_t *arc)
+{
+  double c0 = (double)arc->position[arc->axis_0] + arc->offset[arc->axis_0];
+  double c1 = (double)arc->position[arc->axis_1] + arc->offset[arc->axis_1];
+  double start = atan2(-(double)arc->offset[arc->axis_1], -(double)arc->offset[arc->axis_0]);
+  double radius = hypot(arc->offset[arc->axis_0], arc->offset[arc->axis_1]);
+  uint16_t segments = bench_begin(arc), i;
+  float point[N_AXIS];
+  double drift = 0;
+  for (i = 1; mc_arc_next(point); i++) {
+    double angle = start + arc->angular_travel * i / segments;
+    double error_sqr = 0;
+    uint8_t idx;
+    for (idx = 0; idx < N_AXIS; idx++) {
+      double exact = arc->position[idx] + ((double)arc->target[idx] - arc->position[idx]) * i / segments;
+      if (idx == arc->axis_0) { exact = c0 + radius * cos(angle); }
+      if (idx == arc->axis_1) { exact = c1 + radius * sin(angle); }
+      error_sqr += (point[idx] - exact) * (point[idx] - exact);
+    }
+    if (i < segments) { drift = fmax(drift, sqrt(error_sqr)); } // 最后一段为给定的目标，不计
+  }
+  return (drift);
+}
+
+
+static void bench_run(const corpus_t *corpus, uint16_t repeat)
+{
+  double best_ns = 0, drift = 0;
+  uint32_t n_segment = 0, n, k;
+  float point[N_AXIS];
+
+  bench.n_arc = 0;
+  corpus->generate();
+  for (n = 0; n < repeat; n++) {
+    n_segment = 0;
+    uint64_t start = bench_now_ns();
+    for (k = 0; k < bench.n_arc; k++) {
+      bench_begin(&bench.arc[k]);
+      while (mc_arc_next(point)) { n_segment++; }
+    }
+    double elapsed = bench_now_ns() - start;
+    if ((n == 0) || (elapsed < best_ns)) { best_ns = elapsed; }
+  }
+  for (k = 0; k < bench.n_arc; k++) { drift = fmax(drift, bench_drift(&bench.arc[k])); }
+
+  printf("%-8s %5u %8lu %7.1f %11.0f %10.6f  %s\n", corpus->name, bench.n_arc, (unsigned long)n_segment,
+         best_ns / n_segment, n_segment / (best_ns * 1e-9), drift, corpus->description);
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint16_t repeat = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "r:")) != -1) {
+    switch (opt) {
+      case 'r': repeat = atoi(optarg); break;
+      default:
+        fprintf(stderr, "用法：%s [-r 重复次数] [语料名 ...]\n", argv[0]);
+        return (2);
+    }
+  }
+  if (repeat < 1) { repeat = 1; }
+
+  sim_init(100);
+  settings_restore(SETTINGS_RESTORE_ALL);
+
+  printf("$12 圆弧公差 %.3f mm，N_ARC_CORRECTION %d\n", settings.arc_tolerance, N_ARC_CORRECTION);
+  printf("语料      圆弧     段数   ns/段       段/秒  最大漂移mm\n");
+  uint8_t idx;
+  for (idx = 0; idx < N_CORPUS; idx++) {
+    uint8_t selected = (optind == argc);
+    int arg;
+    for (arg = optind; arg < argc; arg++) {
+      if (strcmp(argv[arg], corpora[idx].name) == 0) { selected = true; }
+    }
+    if (selected) { bench_run(&corpora[idx], repeat); }
+  }
+  return (0);
+}
@@ -0,0 +1,44 @@
+/*
+  avr/interrupt.h - 主机仿真用的中断替身
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+// ISR(vect) 展开为普通函数，由 avr_sim.c 的虚拟时钟按时间顺序调用。
+// cli()/sei() 只操作 SREG 的 I 位；派发器在 I 位清零时推迟所有中断。
+
+#ifndef avr_interrupt_h
+#define avr_interrupt_h
+
+#include <avr/io.h>
+
+#define ISR(vector) void vector(void)
+
+#define cli() (SREG &= ~0x80)
+#define sei() (SREG |= 0x80)
+
+// 固件实现的中断向量。未启用的功能对应的向量在 avr_sim.c 中提供弱定义。
+void TIMER1_COMPA_vect(void);
+void TIMER0_OVF_vect(void);
+void TIMER0_COMPA_vect(void);
+void TIMER3_OVF_vect(void);
+void TIMER5_COMPA_vect(void);
+void USART0_RX_vect(void);
+void USART0_UDRE_vect(void);
+void USART1_RX_vect(void);
+void USART1_UDRE_vect(void);
+void PCINT0_vect(void);
+void PCINT2_vect(void);
+void WDT_vect(void);
+
+#endif
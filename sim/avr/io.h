@@ -0,0 +1,181 @@
+/*
+  avr/io.h - 主机仿真用的 ATmega2560 寄存器替身
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+// 仅在主机仿真构建中通过 -I sim 代替 avr-libc 的同名头文件。
+// 固件直接读写的每个寄存器在这里都是普通的全局变量，由 avr_sim.c 定义，
+// 虚拟时钟在派发中断前后检查这些变量来模拟定时器和 USART 的行为。
+// 输入引脚寄存器（PINx）是只读的，读取时由仿真器根据开关状态计算。
+
+#ifndef avr_io_h
+#define avr_io_h
+
+#include <stdint.h>
+
+// 8 位寄存器
+#define SIM_REG8(name) extern volatile uint8_t name;
+// 16 位寄存器
+#define SIM_REG16(name) extern volatile uint16_t name;
+
+// 通用 I/O 端口
+SIM_REG8(PORTA) SIM_REG8(DDRA)
+SIM_REG8(PORTB) SIM_REG8(DDRB)
+SIM_REG8(PORTC) SIM_REG8(DDRC)
+SIM_REG8(PORTD) SIM_REG8(DDRD)
+SIM_REG8(PORTE) SIM_REG8(DDRE)
+SIM_REG8(PORTF) SIM_REG8(DDRF)
+SIM_REG8(PORTG) SIM_REG8(DDRG)
+SIM_REG8(PORTH) SIM_REG8(DDRH)
+SIM_REG8(PORTJ) SIM_REG8(DDRJ)
+SIM_REG8(PORTK) SIM_REG8(DDRK)
+SIM_REG8(PORTL) SIM_REG8(DDRL)
+
+// 输入引脚。端口编号 A=0 ... L=10（与 avr_sim.h 中的 SIM_PORT_* 一致）。
+uint8_t sim_pin_read(uint8_t port);
+#define PINA sim_pin_read(0)
+#define PINB sim_pin_read(1)
+#define PINC sim_pin_read(2)
+#define PIND sim_pin_read(3)
+#define PINE sim_pin_read(4)
+#define PINF sim_pin_read(5)
+#define PING sim_pin_read(6)
+#define PINH sim_pin_read(7)
+#define PINJ sim_pin_read(8)
+#define PINK sim_pin_read(9)
+#define PINL sim_pin_read(10)
+
+// 状态寄存器（仅使用全局中断使能位 I）
+SIM_REG8(SREG)
+SIM_REG8(MCUSR)
+SIM_REG8(SPMCSR)
+
+// 定时器 0、1、3、4、5
+SIM_REG8(TCCR0A) SIM_REG8(TCCR0B) SIM_REG8(TCNT0) SIM_REG8(OCR0A) SIM_REG8(OCR0B) SIM_REG8(TIMSK0)
+SIM_REG8(TCCR1A) SIM_REG8(TCCR1B) SIM_REG16(TCNT1) SIM_REG16(OCR1A) SIM_REG16(OCR1B) SIM_REG8(TIMSK1)
+SIM_REG8(TCCR3A) SIM_REG8(TCCR3B) SIM_REG16(TCNT3) SIM_REG16(OCR3A) SIM_REG8(TIMSK3)
+SIM_REG8(TCCR4A) SIM_REG8(TCCR4B) SIM_REG16(TCNT4) SIM_REG16(OCR4A) SIM_REG16(OCR4B) SIM_REG8(TIMSK4)
+SIM_REG8(TCCR5A) SIM_REG8(TCCR5B) SIM_REG16(TCNT5) SIM_REG16(OCR5A) SIM_REG8(TIMSK5)
+
+// 引脚变化中断和看门狗
+SIM_REG8(PCICR) SIM_REG8(PCMSK0) SIM_REG8(PCMSK1) SIM_REG8(PCMSK2)
+SIM_REG8(WDTCSR)
+
+// USART0
+SIM_REG8(UCSR0A) SIM_REG8(UCSR0B) SIM_REG8(UCSR0C) SIM_REG8(UBRR0H) SIM_REG8(UBRR0L) SIM_REG8(UDR0)
+
+// USART1
+SIM_REG8(UCSR1A) SIM_REG8(UCSR1B) SIM_REG8(UCSR1C) SIM_REG8(UBRR1H) SIM_REG8(UBRR1L) SIM_REG8(UDR1)
+
+// EEPROM（仿真构建中由 eeprom_sim.c 替代 eeprom.c，这里只为编译保留）
+SIM_REG16(EEAR) SIM_REG8(EEDR) SIM_REG8(EECR)
+
+#undef SIM_REG8
+#undef SIM_REG16
+
+// 端口位编号
+#define PA0 0
+#define PA1 1
+#define PA2 2
+#define PA3 3
+#define PA4 4
+#define PA5 5
+#define PA6 6
+#define PA7 7
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PH0 0
+#define PH3 3
+
+// 定时器位
+#define CS00 0
+#define CS01 1
+#define CS02 2
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define CS30 0
+#define CS31 1
+#define CS32 2
+#define CS40 0
+#define CS41 1
+#define CS42 2
+#define CS50 0
+#define CS51 1
+#define CS52 2
+#define WGM10 0
+#define WGM11 1
+#define WGM12 3
+#define WGM13 4
+#define WGM40 0
+#define WGM41 1
+#define WGM42 3
+#define WGM43 4
+#define WGM52 3
+#define COM1B0 4
+#define COM1B1 5
+#define COM1A0 6
+#define COM1A1 7
+#define COM4B0 4
+#define COM4B1 5
+#define TOIE0 0
+#define OCIE0A 1
+#define OCIE0B 2
+#define TOIE1 0
+#define OCIE1A 1
+#define OCIE1B 2
+#define TOIE3 0
+#define TOIE4 0
+#define OCIE5A 1
+
+// 引脚变化中断
+#define PCIE0 0
+#define PCIE1 1
+#define PCIE2 2
+
+// 看门狗
+#define WDP0 0
+#define WDE 3
+#define WDCE 4
+#define WDIE 6
+#define WDRF 3
+
+// USART0
+#define U2X0 1
+#define UDRE0 5
+#define TXEN0 3
+#define RXEN0 4
+#define UDRIE0 5
+#define RXCIE0 7
+
+// USART1
+#define U2X1 1
+#define UDRE1 5
+#define TXEN1 3
+#define RXEN1 4
+#define UDRIE1 5
+#define RXCIE1 7
+
+// EEPROM
+#define EERE 0
+#define EEPE 1
+#define EEMPE 2
+#define SELFPRGEN 0
+
+// 主机仿真钩子：主程序在忙等待检查点调用，让虚拟时钟前进并派发到期的中断。
+void sim_idle(void);
+
+#endif
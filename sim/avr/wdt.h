@@ -0,0 +1,24 @@
+/*
+  avr/wdt.h - 主机仿真用的看门狗替身
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+#ifndef avr_wdt_h
+#define avr_wdt_h
+
+#define wdt_reset()
+#define wdt_disable()
+#define wdt_enable(timeout)
+
+#endif
@@ -0,0 +1,336 @@
+/*
+  avr_sim.c - ATmega2560 外设和虚拟时钟的主机仿真
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  仿真模型：
+    固件在单线程中运行。主程序每次到达 sim_idle() 检查点（protocol_execute_realtime()
+  和 serial_write() 的忙等待）时，虚拟时钟前进 sim.loop_cycles 个周期，并按时间顺序派发
+  这段时间内到期的中断。中断函数在派发时一次执行完毕，不会嵌套。
+    Timer1 按 CTC 模式建模：比较匹配后计数器归零，下一次匹配在 (OCR1A+1)*预分频 个周期后，
+  因此 ISR 内写入的 OCR1A 对下一个周期生效。Timer0 在 TCCR0B 选定时钟源时开始计数，
+  (256-TCNT0)*预分频 个周期后溢出。Timer5 与 Timer1 一样按 CTC 模式建模。USART0 和 USART1 各自按 UBRRn 和 U2Xn 计算每字节 10 位的传输
+  时间，接收和发送都按该速率逐字节进行。
+    由于不依赖主机实际运行速度，同一输入在任何机器上产生完全相同的中断序列。
+*/
+
+#include "grbl.h"
+#include "avr_sim.h"
+
+sim_t sim;
+
+// 寄存器存储
+volatile uint8_t PORTA, DDRA, PORTB, DDRB, PORTC, DDRC, PORTD, DDRD, PORTE, DDRE, PORTF, DDRF;
+volatile uint8_t PORTG, DDRG, PORTH, DDRH, PORTJ, DDRJ, PORTK, DDRK, PORTL, DDRL;
+volatile uint8_t SREG, MCUSR, SPMCSR;
+volatile uint8_t TCCR0A, TCCR0B, TCNT0, OCR0A, OCR0B, TIMSK0;
+volatile uint8_t TCCR1A, TCCR1B, TIMSK1;
+volatile uint16_t TCNT1, OCR1A, OCR1B;
+volatile uint8_t TCCR3A, TCCR3B, TIMSK3;
+volatile uint16_t TCNT3, OCR3A;
+volatile uint8_t TCCR4A, TCCR4B, TIMSK4;
+volatile uint16_t TCNT4, OCR4A, OCR4B;
+volatile uint8_t TCCR5A, TCCR5B, TIMSK5;
+volatile uint16_t TCNT5, OCR5A;
+volatile uint8_t PCICR, PCMSK0, PCMSK1, PCMSK2, WDTCSR;
+volatile uint8_t UCSR0A, UCSR0B, UCSR0C, UBRR0H, UBRR0L, UDR0;
+volatile uint8_t UCSR1A, UCSR1B, UCSR1C, UBRR1H, UBRR1L, UDR1;
+volatile uint16_t EEAR;
+volatile uint8_t EEDR, EECR;
+
+// 未在当前配置中编译的中断向量。
+__attribute__((weak)) void TIMER0_COMPA_vect(void) {}
+__attribute__((weak)) void TIMER3_OVF_vect(void) {}
+__attribute__((weak)) void TIMER5_COMPA_vect(void) {}
+__attribute__((weak)) void PCINT0_vect(void) {}
+__attribute__((weak)) void PCINT2_vect(void) {}
+__attribute__((weak)) void WDT_vect(void) {}
+__attribute__((weak)) void USART1_RX_vect(void) {}
+__attribute__((weak)) void USART1_UDRE_vect(void) {}
+
+// 通过展开 cpu_map.h 中的 PINx 宏取得限位和探针所在的端口编号。
+#define sim_pin_read(port) (port)
+static const uint8_t limit_port = LIMIT_PIN;
+static const uint8_t probe_port = PROBE_PIN;
+static const uint8_t control_port = CONTROL_PIN;
+#undef sim_pin_read
+
+// 返回端口的输入电平。仿真中所有开关都处于未触发状态，未触发电平随设置中的反转位而定。
+uint8_t sim_pin_read(uint8_t port)
+{
+  uint8_t pin = 0xff; // 内部上拉，悬空为高
+  if (port == limit_port) {
+    if (bit_istrue(settings.flags, BITFLAG_INVERT_LIMIT_PINS)) { pin &= ~LIMIT_MASK; }
+    #ifdef INVERT_LIMIT_PIN_MASK
+      pin ^= INVERT_LIMIT_PIN_MASK;
+    #endif
+  }
+  if (port == probe_port) {
+    if (bit_istrue(settings.flags, BITFLAG_INVERT_PROBE_PIN)) { pin &= ~PROBE_MASK; }
+  }
+  if (port == control_port) {
+    #ifdef INVERT_CONTROL_PIN_MASK
+      pin ^= INVERT_CONTROL_PIN_MASK;
+    #endif
+  }
+  return (pin);
+}
+
+
+// 由 CSn2:0 位返回预分频系数。零表示定时器停止。外部时钟源不支持。
+static uint16_t sim_prescaler(uint8_t tccrb)
+{
+  static const uint16_t prescaler[8] = { 0, 1, 8, 64, 256, 1024, 0, 0 };
+  return (prescaler[tccrb & 0x07]);
+}
+
+
+static uint32_t sim_timer1_period()
+{
+  return ((uint32_t)(OCR1A + 1) * sim_prescaler(TCCR1B));
+}
+
+
+static uint32_t sim_timer5_period()
+{
+  return ((uint32_t)(OCR5A + 1) * sim_prescaler(TCCR5B));
+}
+
+
+// 每个 USART 字节（1 起始位、8 数据位、1 停止位）的周期数。
+static uint32_t sim_usart_byte_cycles(uint8_t ubrrh, uint8_t ubrrl, uint8_t double_speed)
+{
+  uint32_t ubrr = ((uint32_t)ubrrh << 8) | ubrrl;
+  uint32_t cycles_per_bit = double_speed ? 8 : 16;
+  return (10 * cycles_per_bit * (ubrr + 1));
+}
+
+
+static uint32_t sim_serial_byte_cycles()
+{
+  return (sim_usart_byte_cycles(UBRR0H, UBRR0L, UCSR0A & (1 << U2X0)));
+}
+
+
+static uint32_t sim_serial_aux_byte_cycles()
+{
+  return (sim_usart_byte_cycles(UBRR1H, UBRR1L, UCSR1A & (1 << U2X1)));
+}
+
+
+void sim_init(uint32_t loop_us)
+{
+  memset(&sim, 0, sizeof(sim_t));
+  sim.loop_cycles = loop_us * (F_CPU / 1000000UL);
+  if (sim.loop_cycles == 0) { sim.loop_cycles = 1; }
+  SREG = 0; // 上电时全局中断关闭，直到 main() 调用 sei()。
+}
+
+
+double sim_seconds()
+{
+  return ((double)sim.cycles / (double)F_CPU);
+}
+
+
+uint16_t sim_serial_send(const char *data, uint16_t len)
+{
+  uint16_t n;
+  if (sim.rx_head == sim.rx_tail) {
+    // 队列从空变为非空，第一个字节在一个字节时间后到达。
+    if (sim.rx_next < sim.cycles) { sim.rx_next = sim.cycles; }
+    sim.rx_next += sim_serial_byte_cycles();
+  }
+  for (n = 0; n < len; n++) {
+    uint16_t next_head = sim.rx_head + 1;
+    if (next_head == SIM_RX_QUEUE_SIZE) { next_head = 0; }
+    if (next_head == sim.rx_tail) { break; }
+    sim.rx_queue[sim.rx_head] = data[n];
+    sim.rx_head = next_head;
+  }
+  return (n);
+}
+
+
+uint16_t sim_serial_rx_pending()
+{
+  if (sim.rx_head >= sim.rx_tail) { return (sim.rx_head - sim.rx_tail); }
+  return (SIM_RX_QUEUE_SIZE - (sim.rx_tail - sim.rx_head));
+}
+
+
+uint16_t sim_serial_aux_send(const char *data, uint16_t len)
+{
+  uint16_t n;
+  if (sim.aux_rx_head == sim.aux_rx_tail) {
+    if (sim.aux_rx_next < sim.cycles) { sim.aux_rx_next = sim.cycles; }
+    sim.aux_rx_next += sim_serial_aux_byte_cycles();
+  }
+  for (n = 0; n < len; n++) {
+    uint16_t next_head = sim.aux_rx_head + 1;
+    if (next_head == SIM_AUX_RX_QUEUE_SIZE) { next_head = 0; }
+    if (next_head == sim.aux_rx_tail) { break; }
+    sim.aux_rx_queue[sim.aux_rx_head] = data[n];
+    sim.aux_rx_head = next_head;
+  }
+  return (n);
+}
+
+
+// 根据固件写入的控制寄存器启动或停止定时器。
+static void sim_update_timers()
+{
+  if ((TIMSK1 & (1 << OCIE1A)) && sim_prescaler(TCCR1B)) {
+    if (!sim.t1_armed) {
+      sim.t1_armed = true;
+      sim.t1_next = sim.cycles + sim_timer1_period();
+    }
+  } else {
+    sim.t1_armed = false;
+  }
+
+  if ((TIMSK5 & (1 << OCIE5A)) && sim_prescaler(TCCR5B)) {
+    if (!sim.t5_armed) {
+      sim.t5_armed = true;
+      sim.t5_next = sim.cycles + sim_timer5_period();
+    }
+  } else {
+    sim.t5_armed = false;
+  }
+
+  if (sim_prescaler(TCCR0B)) {
+    if (!sim.t0_armed) {
+      sim.t0_armed = true;
+      sim.t0_next = sim.cycles + (uint32_t)(256 - TCNT0) * sim_prescaler(TCCR0B);
+    }
+  } else {
+    sim.t0_armed = false;
+  }
+}
+
+
+// 中断源，按 ATmega2560 向量优先级排列（数值越小优先级越高）。
+enum { SIM_EVENT_NONE, SIM_EVENT_TIMER1, SIM_EVENT_TIMER0, SIM_EVENT_RX, SIM_EVENT_TX, SIM_EVENT_AUX_RX, SIM_EVENT_AUX_TX, SIM_EVENT_TIMER5 };
+
+static void sim_select_event(uint8_t *event, uint64_t *when, uint8_t candidate, uint64_t candidate_when)
+{
+  if (*event == SIM_EVENT_NONE) {
+    if (candidate_when > *when) { return; } // 超出本次推进的时间窗口
+  } else if (candidate_when >= *when) {
+    return;
+  }
+  *event = candidate;
+  *when = candidate_when;
+}
+
+void sim_run_until(uint64_t end_cycles)
+{
+  for (;;) {
+    sim_update_timers();
+    if (!(SREG & 0x80)) { break; } // 全局中断关闭，所有中断挂起。
+
+    // 选出最早到期的事件。按优先级顺序检查，时间相同时保留先选中的事件。
+    uint8_t event = SIM_EVENT_NONE;
+    uint64_t when = end_cycles;
+    if (sim.t1_armed) { sim_select_event(&event, &when, SIM_EVENT_TIMER1, sim.t1_next); }
+    if (sim.t0_armed) { sim_select_event(&event, &when, SIM_EVENT_TIMER0, sim.t0_next); }
+    if ((sim.rx_head != sim.rx_tail) && (UCSR0B & (1 << RXEN0))) {
+      sim_select_event(&event, &when, SIM_EVENT_RX, sim.rx_next);
+    }
+    if (UCSR0B & (1 << UDRIE0)) {
+      sim_select_event(&event, &when, SIM_EVENT_TX, (sim.tx_free > sim.cycles) ? sim.tx_free : sim.cycles);
+    }
+    if ((sim.aux_rx_head != sim.aux_rx_tail) && (UCSR1B & (1 << RXEN1))) {
+      sim_select_event(&event, &when, SIM_EVENT_AUX_RX, sim.aux_rx_next);
+    }
+    if (UCSR1B & (1 << UDRIE1)) {
+      sim_select_event(&event, &when, SIM_EVENT_AUX_TX, (sim.aux_tx_free > sim.cycles) ? sim.aux_tx_free : sim.cycles);
+    }
+    if (sim.t5_armed) { sim_select_event(&event, &when, SIM_EVENT_TIMER5, sim.t5_next); }
+    if (event == SIM_EVENT_NONE) { break; }
+
+    // 中断处理中的延时可能已让时钟越过事件时间。此时事件被推迟到当前时间执行。
+    if (when > sim.cycles) { sim.cycles = when; }
+
+    sim.in_isr = true;
+    SREG &= ~0x80; // 进入中断时硬件清除 I 位
+    switch (event) {
+      case SIM_EVENT_TIMER1:
+        sim.n_timer1++;
+        TIMER1_COMPA_vect();
+        sim.t0_armed = false; // 步进中断总是重新装载 Timer0
+        sim.t1_next = when + sim_timer1_period();
+        if (sim.step_isr) { sim.step_isr(when); }
+        break;
+      case SIM_EVENT_TIMER0:
+        sim.n_timer0++;
+        if (TIMSK0 & (1 << TOIE0)) { TIMER0_OVF_vect(); }
+        sim.t0_next = when + 256UL * sim_prescaler(TCCR0B);
+        break;
+      case SIM_EVENT_RX:
+        sim.n_rx++;
+        UDR0 = sim.rx_queue[sim.rx_tail];
+        if (++sim.rx_tail == SIM_RX_QUEUE_SIZE) { sim.rx_tail = 0; }
+        sim.rx_next = when + sim_serial_byte_cycles();
+        if (UCSR0B & (1 << RXCIE0)) { USART0_RX_vect(); }
+        break;
+      case SIM_EVENT_TX:
+        sim.n_tx++;
+        USART0_UDRE_vect();
+        sim.tx_free = when + sim_serial_byte_cycles();
+        if (sim.serial_out) { sim.serial_out(UDR0); }
+        break;
+      case SIM_EVENT_AUX_RX:
+        sim.n_aux_rx++;
+        UDR1 = sim.aux_rx_queue[sim.aux_rx_tail];
+        if (++sim.aux_rx_tail == SIM_AUX_RX_QUEUE_SIZE) { sim.aux_rx_tail = 0; }
+        sim.aux_rx_next = when + sim_serial_aux_byte_cycles();
+        if (UCSR1B & (1 << RXCIE1)) { USART1_RX_vect(); }
+        break;
+      case SIM_EVENT_AUX_TX:
+        sim.n_aux_tx++;
+        USART1_UDRE_vect();
+        sim.aux_tx_free = when + sim_serial_aux_byte_cycles();
+        if (sim.serial_aux_out) { sim.serial_aux_out(UDR1); }
+        break;
+      case SIM_EVENT_TIMER5:
+        sim.n_timer5++;
+        TIMER5_COMPA_vect();
+        sim.t5_next = when + sim_timer5_period();
+        break;
+    }
+    SREG |= 0x80; // RETI
+    sim.in_isr = false;
+  }
+  if (end_cycles > sim.cycles) { sim.cycles = end_cycles; }
+}
+
+
+void sim_delay_cycles(uint32_t cycles)
+{
+  if (sim.in_isr || !(SREG & 0x80)) {
+    sim.cycles += cycles; // 不嵌套派发。到期的中断在返回主程序后依次补上。
+  } else {
+    sim_run_until(sim.cycles + cycles);
+  }
+}
+
+
+void sim_idle()
+{
+  if (sim.in_isr) { return; }
+  sim_run_until(sim.cycles + sim.loop_cycles);
+  if (sim.idle) { sim.idle(); }
+}
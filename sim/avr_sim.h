@@ -0,0 +1,104 @@
+/*
+  avr_sim.h - ATmega2560 外设和虚拟时钟的主机仿真
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+#ifndef avr_sim_h
+#define avr_sim_h
+
+#include <stdint.h>
+
+// 输入端口编号，与 avr/io.h 中 PINx 宏传给 sim_pin_read() 的参数一致。
+#define SIM_PORT_A 0
+#define SIM_PORT_B 1
+#define SIM_PORT_C 2
+#define SIM_PORT_D 3
+#define SIM_PORT_E 4
+#define SIM_PORT_F 5
+#define SIM_PORT_G 6
+#define SIM_PORT_H 7
+#define SIM_PORT_J 8
+#define SIM_PORT_K 9
+#define SIM_PORT_L 10
+#define SIM_N_PORT 11
+
+#define SIM_RX_QUEUE_SIZE 1024 // 主机发往 Grbl、尚未移入 UDR0 的字节队列
+#define SIM_AUX_RX_QUEUE_SIZE 64 // 副串口设备发往 Grbl、尚未移入 UDR1 的字节队列
+
+// 仿真器状态。所有时间均以 CPU 周期（F_CPU）为单位。
+typedef struct
+{
+  uint64_t cycles;      // 虚拟时钟
+  uint32_t loop_cycles; // 主程序每到达一次 sim_idle() 检查点所消耗的周期
+  uint8_t in_isr;       // 正在派发中断。此时延时只推进时钟，不嵌套派发。
+
+  // 定时器与 USART 的下一个事件时间。armed 为零表示事件未排程。
+  uint8_t t1_armed;
+  uint64_t t1_next;
+  uint8_t t0_armed;
+  uint64_t t0_next;
+  uint8_t t5_armed;
+  uint64_t t5_next;
+  uint64_t rx_next;
+  uint64_t tx_free; // 发送移位寄存器空闲的时间
+  uint64_t aux_rx_next;
+  uint64_t aux_tx_free;
+
+  // 主机 -> Grbl 接收队列
+  uint8_t rx_queue[SIM_RX_QUEUE_SIZE];
+  uint16_t rx_head;
+  uint16_t rx_tail;
+
+  // 副串口设备 -> Grbl 接收队列（USART1）
+  uint8_t aux_rx_queue[SIM_AUX_RX_QUEUE_SIZE];
+  uint16_t aux_rx_head;
+  uint16_t aux_rx_tail;
+
+  // 中断派发计数
+  uint32_t n_timer1;
+  uint32_t n_timer0;
+  uint32_t n_timer5;
+  uint32_t n_rx;
+  uint32_t n_tx;
+  uint32_t n_aux_rx;
+  uint32_t n_aux_tx;
+
+  // 主机回调。serial_out 和 serial_aux_out 分别接收 Grbl 在 USART0 和 USART1 上发送的每个字节；idle 在每次 sim_idle() 推进时钟后调用；
+  // step_isr 在每次步进中断返回后调用，参数为中断触发时间，此时 STEP_PORT 保持着本次脉冲。
+  void (*serial_out)(uint8_t data);
+  void (*serial_aux_out)(uint8_t data);
+  void (*idle)(void);
+  void (*step_isr)(uint64_t cycles);
+} sim_t;
+extern sim_t sim;
+
+// 初始化寄存器和虚拟时钟。必须在调用固件 main() 之前执行。
+void sim_init(uint32_t loop_us);
+
+// 推进虚拟时钟至 end_cycles，按时间顺序派发期间到期的全部中断。
+void sim_run_until(uint64_t end_cycles);
+
+// 主机向 Grbl 发送字节。返回实际入队的字节数。
+uint16_t sim_serial_send(const char *data, uint16_t len);
+
+// 主机接收队列中尚未送达 Grbl 的字节数。
+uint16_t sim_serial_rx_pending();
+
+// 副串口设备向 Grbl 发送字节（USART1）。返回实际入队的字节数。
+uint16_t sim_serial_aux_send(const char *data, uint16_t len);
+
+// 以秒为单位的虚拟时间。
+double sim_seconds();
+
+#endif
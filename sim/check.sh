@@ -0,0 +1,58 @@
+#!/bin/sh
+#  check.sh - 运行 tests/ 下的 G 代码程序，与保存的期望结果比较
+#  Grbl 的一部分
+#
+#  用法：./check.sh [-u]（由 make check 和 make check-update 调用）
+#
+#  每个测试用 grbl_sim 运行一个程序，比较两项结果：
+#    tests/<名称>.out  Grbl 的全部回复和 grbl_sim 的统计（去掉主机实际用时）
+#    tests/<名称>.sum  步进跟踪的摘要（trace_diff -s），包括位置散列和时间散列
+#  grbl_sim 的统计中包括规划器入口速度违反约束的次数，期望结果中应为 0。
+#  跟踪文件本身留在 build/check/ 下。摘要不同时，可在已知正确的提交上运行同一测试，再用
+#  trace_diff 比较两个跟踪文件找出第一个不一致的步。
+#  -u 用本次结果覆盖期望结果。只在确认行为变化符合预期时使用，并在提交说明中写明原因。
+
+UPDATE=0
+[ "$1" = "-u" ] && UPDATE=1
+OUT=build/check
+mkdir -p $OUT
+
+# 名称                文件              grbl_sim 选项
+TESTS="
+conformance          conformance.nc
+conformance_frames   conformance.nc    -b
+conformance_window   conformance.nc    -w 8
+errors               errors.nc
+drill                drill.nc
+spline               spline.nc
+spline_g93           spline_g93.nc
+arcs                 arcs.nc
+chord                chord.nc
+path_control         path_control.nc
+macro_arc            macro_arc.nc
+override_summary     override_summary.nc -o 1:91,1.02:91,1.5:92,1.51:92,1.52:92,2:91,2.5:90,3:92,3.2:92,3.4:91,4:90,4.5:92,5:91
+merge_summary        merge_summary.nc
+"
+
+rm -f $OUT/failed
+echo "$TESTS" | while read name file opts; do
+  [ -z "$name" ] && continue
+  ./grbl_sim -m 3000 -s $OUT/$name.trc $opts tests/$file 2>&1 | sed 's/，实际用时.*//' > $OUT/$name.out
+  ./trace_diff -s $OUT/$name.trc > $OUT/$name.sum
+  if [ $UPDATE = 1 ]; then
+    cp $OUT/$name.out $OUT/$name.sum tests/
+    echo "更新 $name"
+  elif cmp -s $OUT/$name.out tests/$name.out && cmp -s $OUT/$name.sum tests/$name.sum; then
+    echo "通过 $name"
+  else
+    echo "失败 $name"
+    diff tests/$name.out $OUT/$name.out | head -20
+    diff tests/$name.sum $OUT/$name.sum
+    touch $OUT/failed
+  fi
+done
+
+if [ -f $OUT/failed ]; then
+  rm -f $OUT/failed
+  exit 1
+fi
@@ -0,0 +1,67 @@
+/*
+  eeprom_sim.c - 主机仿真用的 EEPROM，替代 eeprom.c
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+// eeprom.c 依靠 EECR/EEDR 的硬件副作用完成读写，普通变量无法模拟，因此仿真构建
+// 改用内存数组。初始内容为擦除状态（0xFF），固件启动时会恢复默认设置。
+// 校验和算法必须与 eeprom.c 保持逐位一致。
+
+#include "grbl.h"
+
+#define EEPROM_SIZE 4096 // ATmega2560
+
+static unsigned char eeprom[EEPROM_SIZE];
+static uint8_t eeprom_initialized;
+
+static void eeprom_init()
+{
+  if (!eeprom_initialized) {
+    memset(eeprom, 0xff, EEPROM_SIZE);
+    eeprom_initialized = true;
+  }
+}
+
+unsigned char eeprom_get_char(unsigned int addr)
+{
+  eeprom_init();
+  return (eeprom[addr % EEPROM_SIZE]);
+}
+
+void eeprom_put_char(unsigned int addr, unsigned char new_value)
+{
+  eeprom_init();
+  eeprom[addr % EEPROM_SIZE] = new_value;
+}
+
+void memcpy_to_eeprom_with_checksum(unsigned int destination, char *source, unsigned int size) {
+  unsigned char checksum = 0;
+  for(; size > 0; size--) {
+    checksum = ((checksum << 1) != 0) || ((checksum >> 7) != 0); // 与 eeprom.c 相同的逻辑或（不是循环移位），保持校验和兼容
+    checksum += *source;
+    eeprom_put_char(destination++, *(source++));
+  }
+  eeprom_put_char(destination, checksum);
+}
+
+int memcpy_from_eeprom_with_checksum(char *destination, unsigned int source, unsigned int size) {
+  unsigned char data, checksum = 0;
+  for(; size > 0; size--) {
+    data = eeprom_get_char(source++);
+    checksum = ((checksum << 1) != 0) || ((checksum >> 7) != 0); // 与 eeprom.c 相同的逻辑或（不是循环移位），保持校验和兼容
+    checksum += data;
+    *(destination++) = data;
+  }
+  return(checksum == eeprom_get_char(source));
+}
@@ -0,0 +1,193 @@
+/*
+  estimate.c - 基于仿真的加工时间估算
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+    G 代码经固件完整的 gc_execute_line() -> mc_line() -> plan_buffer_line() -> st_prep_buffer()
+  流程在虚拟时钟上执行，因此估算值包含前瞻规划、BLOCK_BUFFER_SIZE 限制、加减速、串口传输和
+  规划器饥饿的全部影响，使用的是 EEPROM 中的 $ 设置。
+    每个时间片记到步进程序正在执行的规划块的行号，与状态报告的 Ln 字段相同。段缓冲区使实际
+  执行比该块最多滞后 SEGMENT_BUFFER_SIZE 个段，相邻行之间会有几十毫秒的偏移，行范围的合计
+  不受影响。规划器为空时的时间（等待串口、暂停 G4、主轴延时等）另计为“无运动”时间。
+    换刀流程需要真实的刀库开关和对刀仪，仿真中无法执行。T 字在发送前被去掉，每次换刀按 -c
+  指定的固定时间计入新刀具。
+*/
+
+#include <stdlib.h>
+#include <ctype.h>
+#include "grbl.h"
+#include "avr_sim.h"
+#include "estimate.h"
+
+#define MAX_TOOL_NUMBER 8 // 与 gcode.c 一致
+#define ESTIMATE_N_TOOL (MAX_TOOL_NUMBER + 1)
+
+typedef struct {
+  uint64_t cycles;      // 记到该行的全部时间
+  uint64_t wait_cycles; // 其中规划器为空的时间
+  uint8_t tool;         // 执行该行时的刀具
+  uint8_t tool_change;  // 该行触发了换刀
+} estimate_line_t;
+
+static struct {
+  estimate_line_t *line;
+  uint32_t n_line;
+  uint32_t size;
+  uint32_t range_lines;
+  float tool_change_s;
+  uint8_t tool;
+  uint64_t last_cycles;
+  uint64_t startup_cycles; // 第一行发送之前的开机时间，不计入作业
+} est;
+
+
+void estimate_init(uint32_t range_lines, float tool_change_s)
+{
+  memset(&est, 0, sizeof(est));
+  est.range_lines = range_lines;
+  est.tool_change_s = tool_change_s;
+  est.tool = (settings.tool <= MAX_TOOL_NUMBER) ? settings.tool : 0;
+  est.last_cycles = sim.cycles;
+}
+
+
+static estimate_line_t *estimate_line(uint32_t src_line)
+{
+  while (src_line > est.size) {
+    est.size = est.size ? 2 * est.size : 1024;
+    est.line = realloc(est.line, est.size * sizeof(estimate_line_t));
+    if (est.line == NULL) { fprintf(stderr, "内存不足\n"); exit(2); }
+  }
+  while (est.n_line < src_line) { memset(&est.line[est.n_line++], 0, sizeof(estimate_line_t)); }
+  return (&est.line[src_line - 1]);
+}
+
+
+uint16_t estimate_prepare_line(const char *line, uint32_t src_line, char *out)
+{
+  estimate_line_t *info = estimate_line(src_line);
+  const char *p = line;
+  char *q = out;
+  char comment = 0;
+
+  while (isspace((unsigned char)*p)) { p++; }
+  info->tool = est.tool;
+  // 系统命令和空行原样发送
+  if ((*p == '$') || (*p == '%') || (*p == 0)) {
+    strcpy(out, line);
+    return (strlen(out));
+  }
+  q += sprintf(q, "N%lu", (unsigned long)src_line);
+
+  for (p = line; *p; p++) {
+    char c = *p;
+    if (comment) {
+      if ((comment == '(') && (c == ')')) { comment = 0; }
+    } else if ((c == '(') || (c == ';')) {
+      comment = c;
+    } else if ((toupper((unsigned char)c) == 'N') || (toupper((unsigned char)c) == 'T')) {
+      char *end;
+      long value = strtol(p + 1, &end, 10);
+      while ((*end == '.') || isdigit((unsigned char)*end)) { end++; }
+      // 与 gc_execute_line() 相同：刀号未变时不换刀
+      if ((toupper((unsigned char)c) == 'T') && (value >= 0) && (value <= MAX_TOOL_NUMBER) && (value != est.tool)) {
+        est.tool = value;
+        info->tool_change = true;
+      }
+      p = end - 1;
+      continue;
+    }
+    if (c == '\n') { comment = 0; }
+    *q++ = c;
+  }
+  *q = 0;
+  info->tool = est.tool;
+  return (q - out);
+}
+
+
+void estimate_update(uint32_t wait_line)
+{
+  uint64_t dt = sim.cycles - est.last_cycles;
+  est.last_cycles = sim.cycles;
+
+  plan_block_t *block = plan_get_current_block();
+  if (block && (block->line_number > 0) && ((uint32_t)block->line_number <= est.n_line)) {
+    est.line[block->line_number - 1].cycles += dt;
+  } else if (wait_line) {
+    estimate_line_t *info = estimate_line(wait_line);
+    info->cycles += dt;
+    if (!block) { info->wait_cycles += dt; }
+  } else {
+    est.startup_cycles += dt;
+  }
+}
+
+
+static void estimate_print_time(FILE *out, double seconds)
+{
+  unsigned long s = seconds + 0.5;
+  fprintf(out, "%10.3f 秒  %lu:%02lu:%02lu", seconds, s / 3600, (s / 60) % 60, s % 60);
+}
+
+
+void estimate_report(FILE *out)
+{
+  double tool_seconds[ESTIMATE_N_TOOL] = { 0 };
+  uint32_t tool_changes[ESTIMATE_N_TOOL] = { 0 };
+  double total = 0, wait = 0;
+  uint32_t n_change = 0, idx;
+
+  for (idx = 0; idx < est.n_line; idx++) {
+    estimate_line_t *info = &est.line[idx];
+    double seconds = (double)info->cycles / F_CPU;
+    if (info->tool_change) {
+      seconds += est.tool_change_s;
+      tool_changes[info->tool]++;
+      n_change++;
+    }
+    tool_seconds[info->tool] += seconds;
+    total += seconds;
+    wait += (double)info->wait_cycles / F_CPU;
+  }
+
+  fprintf(out, "预计加工时间");
+  estimate_print_time(out, total);
+  fprintf(out, "\n  其中无运动 %.3f 秒，换刀 %lu 次共 %.3f 秒；开机 %.3f 秒未计入\n", wait,
+          (unsigned long)n_change, n_change * est.tool_change_s, (double)est.startup_cycles / F_CPU);
+
+  fprintf(out, "\n刀具   换刀次数        时间                  占比\n");
+  for (idx = 0; idx < ESTIMATE_N_TOOL; idx++) {
+    if ((tool_seconds[idx] == 0) && (tool_changes[idx] == 0)) { continue; }
+    fprintf(out, "T%-5lu %8lu  ", (unsigned long)idx, (unsigned long)tool_changes[idx]);
+    estimate_print_time(out, tool_seconds[idx]);
+    fprintf(out, "  %5.1f%%\n", (total > 0) ? 100.0 * tool_seconds[idx] / total : 0.0);
+  }
+
+  if (!est.range_lines) { return; }
+  fprintf(out, "\n行范围                  时间                 无运动(秒)   占比\n");
+  for (idx = 0; idx < est.n_line; idx += est.range_lines) {
+    uint32_t end = (idx + est.range_lines < est.n_line) ? idx + est.range_lines : est.n_line;
+    double seconds = 0, range_wait = 0;
+    uint32_t k;
+    for (k = idx; k < end; k++) {
+      seconds += (double)est.line[k].cycles / F_CPU + (est.line[k].tool_change ? est.tool_change_s : 0);
+      range_wait += (double)est.line[k].wait_cycles / F_CPU;
+    }
+    fprintf(out, "%7lu-%-7lu ", (unsigned long)idx + 1, (unsigned long)end);
+    estimate_print_time(out, seconds);
+    fprintf(out, "  %10.3f  %5.1f%%\n", range_wait, (total > 0) ? 100.0 * seconds / total : 0.0);
+  }
+}
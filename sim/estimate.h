@@ -0,0 +1,37 @@
+/*
+  estimate.h - 基于仿真的加工时间估算
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+#ifndef estimate_h
+#define estimate_h
+
+#include <stdint.h>
+#include <stdio.h>
+
+// 开始估算。range_lines 为按行号分段统计的行数，tool_change_s 为每次换刀计入的固定时间。
+void estimate_init(uint32_t range_lines, float tool_change_s);
+
+// 改写即将发送的源文件第 src_line 行（从 1 开始），结果写入 out 并返回长度。
+// 去掉原有的 N 字和 T 字，并以源行号作为 N 字前缀，使规划块的行号指向源文件。
+uint16_t estimate_prepare_line(const char *line, uint32_t src_line, char *out);
+
+// 把上次调用以来的虚拟时间记到当前执行的规划块所属的行。规划器为空时记到 wait_line，
+// 即正在等待解析或应答的行；wait_line 为 0 表示作业尚未开始。
+void estimate_update(uint32_t wait_line);
+
+// 输出按刀具和行范围统计的预计时间。
+void estimate_report(FILE *out);
+
+#endif
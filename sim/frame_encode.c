@@ -0,0 +1,169 @@
+/*
+  frame_encode.c - 上位机端：把简单的直线运动行编码为二进制运动帧
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+    编码器跟踪 G90/G91、G20/G21 和当前运动模式，并以 0.001 为单位记录每个轴的工作坐标。位置
+  已知且增量在 int16 范围内时发送增量帧，否则发送绝对帧。固件逐帧把增量累加到浮点位置上，
+  为避免舍入误差累积，每 FRAME_ENCODE_RESYNC 帧发送一次绝对帧。
+    任何按 ASCII 发送的行只要含轴字、G28/G30/G92/G10 等，都会使对应位置变为未知。
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include "grbl.h"
+#include "frame_encode.h"
+
+#define FRAME_ENCODE_RESYNC 32
+
+static const char axis_letter[N_AXIS] = { 'X', 'Y', 'Z', 'A', 'B', 'C', 'D' };
+
+static struct {
+  uint8_t incremental; // G91
+  uint8_t inches;      // G20，不编码
+  int8_t motion;       // 0 为 G0，1 为 G1，-1 为其他运动模式
+  uint8_t known;       // 位置已知的轴掩码
+  int32_t position[N_AXIS];
+  uint8_t since_resync;
+} enc;
+
+
+void frame_encode_init()
+{
+  memset(&enc, 0, sizeof(enc));
+}
+
+
+static void frame_put_uint16(uint8_t **ptr, uint16_t value)
+{
+  *(*ptr)++ = value & 0xff;
+  *(*ptr)++ = value >> 8;
+}
+
+
+static void frame_put_int32(uint8_t **ptr, int32_t value)
+{
+  frame_put_uint16(ptr, (uint32_t)value & 0xffff);
+  frame_put_uint16(ptr, (uint32_t)value >> 16);
+}
+
+
+uint16_t frame_encode_line(const char *line, uint8_t *out)
+{
+  double value[26];
+  uint8_t present[26] = { 0 };
+  uint8_t simple = true;
+  int8_t motion = enc.motion;
+  uint8_t incremental = enc.incremental, inches = enc.inches;
+  const char *p = line;
+  uint8_t idx;
+
+  while (isspace((unsigned char)*p)) { p++; }
+  if (*p == '$') { return (0); }
+
+  // 与 protocol_main_loop() 相同地去掉空白和注释，逐字解析。
+  while (*p) {
+    char c = toupper((unsigned char)*p);
+    if (c == '(') { while (*p && (*p != ')')) { p++; } if (*p) { p++; } continue; }
+    if (c == ';') { break; }
+    if (!isalpha((unsigned char)c)) { p++; continue; }
+    char *end;
+    double v = strtod(p + 1, &end);
+    if (end == p + 1) { return (0); } // $ 命令等，不是 G 代码字
+    p = end;
+    if (c == 'G') {
+      if (v == 0) { motion = 0; }
+      else if (v == 1) { motion = 1; }
+      else if (v == 90) { incremental = false; }
+      else if (v == 91) { incremental = true; }
+      else if (v == 20) { inches = true; simple = false; }
+      else if (v == 21) { inches = false; simple = false; }
+      else {
+        if (((v >= 2) && (v <= 3)) || ((v >= 5) && (v < 6)) || ((v >= 38) && (v < 39)) || (v == 73) || ((v >= 80) && (v <= 83))) { motion = -1; }
+        // G28/G30/G92/G10/G53/G43 等改变或绕过坐标，位置变为未知
+        if ((v == 28) || (v == 30) || ((v >= 92) && (v < 93)) || (v == 10) || (v == 53) || ((v >= 43) && (v < 50)) ||
+            ((v >= 54) && (v < 60))) { enc.known = 0; }
+        simple = false;
+      }
+    } else if ((c == 'X') || (c == 'Y') || (c == 'Z') || (c == 'A') || (c == 'B') || (c == 'C') || (c == 'D') ||
+               (c == 'F') || (c == 'S') || (c == 'N')) {
+      if (present[c - 'A']) { simple = false; }
+      present[c - 'A'] = true;
+      value[c - 'A'] = v;
+    } else {
+      simple = false;
+    }
+  }
+
+  uint8_t axis_words = 0;
+  for (idx = 0; idx < N_AXIS; idx++) {
+    if (present[axis_letter[idx] - 'A']) { axis_words |= bit(idx); }
+  }
+  if (!simple || inches || (motion < 0) || !axis_words) {
+    // 按 ASCII 发送。含轴字的其他运动会移动到编码器无法跟踪的位置。
+    enc.motion = motion;
+    enc.incremental = incremental;
+    enc.inches = inches;
+    if (axis_words) { enc.known &= ~axis_words; }
+    return (0);
+  }
+  enc.motion = motion;
+  enc.incremental = incremental;
+
+  int32_t target[N_AXIS];
+  uint8_t use_delta = (enc.since_resync < FRAME_ENCODE_RESYNC);
+  for (idx = 0; idx < N_AXIS; idx++) {
+    if (!(axis_words & bit(idx))) { continue; }
+    int32_t v = lround(value[axis_letter[idx] - 'A'] * 1000);
+    if (incremental) {
+      if (!(enc.known & bit(idx))) { return (0); } // 增量移动需要已知的起点
+      v += enc.position[idx];
+    }
+    target[idx] = v;
+    if (!(enc.known & bit(idx)) || (labs(v - enc.position[idx]) > 32767)) { use_delta = false; }
+  }
+
+  uint8_t flags = (motion == 0) ? FRAME_FLAG_RAPID : 0;
+  if (use_delta) { flags |= FRAME_FLAG_DELTA; }
+  if (present['F' - 'A']) { flags |= FRAME_FLAG_FEED; }
+  if (present['S' - 'A']) { flags |= FRAME_FLAG_SPINDLE; }
+  if (present['N' - 'A']) { flags |= FRAME_FLAG_LINE_NUMBER; }
+
+  uint8_t *ptr = out + 2;
+  *ptr++ = axis_words;
+  *ptr++ = flags;
+  for (idx = 0; idx < N_AXIS; idx++) {
+    if (!(axis_words & bit(idx))) { continue; }
+    if (use_delta) { frame_put_uint16(&ptr, (uint16_t)(int16_t)(target[idx] - enc.position[idx])); }
+    else { frame_put_int32(&ptr, target[idx]); }
+    enc.position[idx] = target[idx];
+  }
+  enc.known |= axis_words;
+  enc.since_resync = use_delta ? enc.since_resync + 1 : 0;
+  if (flags & FRAME_FLAG_FEED) { frame_put_uint16(&ptr, fmin(lround(value['F' - 'A']), 65535)); }
+  if (flags & FRAME_FLAG_SPINDLE) { frame_put_uint16(&ptr, fmin(lround(value['S' - 'A']), 65535)); }
+  if (flags & FRAME_FLAG_LINE_NUMBER) { frame_put_int32(&ptr, lround(value['N' - 'A'])); }
+
+  uint8_t checksum = 0;
+  uint8_t *q;
+  for (q = out + 2; q < ptr; q++) { checksum += *q; }
+  *ptr++ = checksum;
+  out[0] = CMD_MOTION_FRAME;
+  out[1] = ptr - out - 2;
+  return (ptr - out);
+}
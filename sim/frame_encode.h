@@ -0,0 +1,31 @@
+/*
+  frame_encode.h - 上位机端：把简单的直线运动行编码为二进制运动帧
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+#ifndef frame_encode_h
+#define frame_encode_h
+
+#include <stdint.h>
+
+#define FRAME_ENCODE_MAX 48 // 不小于固件的 FRAME_MAX_LENGTH + 2
+
+// 开始一个新的程序。此时假设解析器处于默认模态且位置未知。
+void frame_encode_init();
+
+// 把一行 G 代码编码为运动帧写入 out，返回帧长度。只含 G0/G1、G90/G91、轴字、F、S、N 的
+// 行可以编码；其他行返回 0，应按 ASCII 发送，并据此更新跟踪的模态和位置。
+uint16_t frame_encode_line(const char *line, uint8_t *out);
+
+#endif
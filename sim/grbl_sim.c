@@ -0,0 +1,467 @@
+/*
+  grbl_sim.c - 在主机上以虚拟时钟运行完整的 Grbl 固件
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  用法：grbl_sim [-t 主循环微秒] [-m 最长虚拟秒数] [-s 跟踪文件] [-r 行数] [-c 换刀秒数] [-b] [-w 行数] [-p 赫兹] [-f] [-o 秒:字节,...] [-q] [文件.nc]
+
+    从文件（或标准输入）读取 G 代码，像上位机一样按字符计数协议经 USART0 流式发送给固件，
+  Grbl 的全部回复打印到标准输出。作业完成（所有行已应答、规划器为空且机器空闲）后
+  在标准错误输出虚拟用时和中断统计并退出。
+    -t  主程序每个实时检查点消耗的虚拟时间，默认 100 微秒。
+    -m  虚拟时间上限，超过后以状态 2 退出，用于防止作业卡死。
+    -s  把步进中断产生的每个步进脉冲和方向变化记录到二进制跟踪文件（格式见 trace.h），
+        可用 trace_diff 比较优化前后的两次运行。
+    -r  估算加工时间：结束后输出按刀具和每 N 行分段统计的预计时间（见 estimate.c）。
+        N 为 0 时只按刀具统计。
+    -c  估算时每次换刀计入的时间，默认 0 秒。
+    -b  把只含 G0/G1 直线运动的行编码为二进制运动帧发送（见 frame.h 和 frame_encode.c），
+        其余行仍按 ASCII 发送。
+    -w  用 $W 启用窗口应答，每行加上递增的 N 字作为序号，按 "ok:<N>" 释放已发送的行。
+    -p  模拟接在副串口（USART1）上的 HMI，按给定频率发送 '?' 轮询状态。副串口的回复加上
+        "aux: " 前缀打印。
+    -f  与 -p 一起使用：用 CMD_STATUS_FRAME_DELTA 请求增量二进制状态帧代替 '?'（格式见 report.h）。
+        主机按增量累加机器位置，作业结束时等到累加结果与固件的 sys_position 一致才退出。
+    -o  在给定的虚拟时刻发送实时命令字节（十六进制），例如 "-o 1.5:91,2:92" 在 1.5 秒提高进给覆盖、
+        2 秒降低进给覆盖。时刻须按从小到大排列。
+    -q  不打印 Grbl 的回复。
+  每次虚拟时钟推进后检查规划器缓冲区中的入口速度（见 plan_check_entry_speeds()），结束时输出违反约束的
+  检查次数，正确的规划应为 0。
+  开机时先发送 "$X" 解除归位锁定，因为仿真中没有真实的限位开关可供归位。
+*/
+
+#include <stdio.h>
+#include <ctype.h>
+#include <time.h>
+#include <unistd.h>
+#include "grbl.h"
+#include "avr_sim.h"
+#include "trace.h"
+#include "estimate.h"
+#include "frame_encode.h"
+
+int grbl_main(void); // 固件 main()，在 Makefile 中重命名
+
+#define HOST_MAX_IN_FLIGHT 256 // 已发送未应答的行数上限，每行至少一个字节
+
+static FILE *host_file;
+static uint8_t host_quiet;
+static double host_max_seconds;
+static struct timespec host_start;
+static trace_t host_trace;
+static uint8_t host_estimate;
+static uint8_t host_binary;
+static uint32_t host_frames_sent;
+static uint8_t host_window;
+static uint8_t host_synced; // 窗口应答时最后发送的是同步空行
+static uint64_t host_aux_period; // 副串口轮询间隔（周期），0 为不轮询
+static uint64_t host_aux_next;
+static uint32_t host_aux_reports;
+static char host_aux_response[LINE_BUFFER_SIZE];
+static uint16_t host_aux_response_len;
+static uint32_t host_aux_bytes;
+static uint8_t host_aux_frames; // 用二进制状态帧轮询
+static uint8_t host_aux_frame[258];
+static uint16_t host_aux_frame_len; // 正在接收的状态帧已收到的字节数
+static int32_t host_aux_position[N_AXIS]; // 由状态帧累加的机器位置
+static uint8_t host_aux_position_known;
+static uint32_t host_aux_frame_errors;
+#define HOST_MAX_RT_COMMANDS 32
+static double host_rt_time[HOST_MAX_RT_COMMANDS]; // -o 指定的实时命令，按时刻排列
+static char host_rt_byte[HOST_MAX_RT_COMMANDS];
+static uint8_t host_rt_count;
+static uint8_t host_rt_next;
+static uint32_t host_plan_violations; // 规划器入口速度违反约束的检查次数
+
+static uint8_t host_ready;  // 已收到 Grbl 欢迎信息
+static uint8_t host_eof;    // 输入已读完
+static char host_pending[LINE_BUFFER_SIZE + 2]; // 已读入但尚未发送的行
+static uint16_t host_pending_len;
+static uint8_t host_pending_prepared; // host_pending 已按估算和二进制帧要求改写
+static uint16_t host_in_flight[HOST_MAX_IN_FLIGHT]; // 已发送行的长度，先进先出
+static uint32_t host_in_flight_line[HOST_MAX_IN_FLIGHT]; // 已发送行的源文件行号，0 为主机自己发送的命令
+static uint8_t host_in_flight_sequenced[HOST_MAX_IN_FLIGHT]; // 该行以 N 字开头，窗口应答时按序号释放
+static uint16_t host_in_flight_head;
+static uint16_t host_in_flight_tail;
+static uint16_t host_in_flight_bytes;
+static uint32_t host_lines_sent;
+static uint32_t host_errors;
+
+static char host_response[LINE_BUFFER_SIZE];
+static uint16_t host_response_len;
+
+
+static uint16_t host_in_flight_count()
+{
+  return ((host_in_flight_head + HOST_MAX_IN_FLIGHT - host_in_flight_tail) % HOST_MAX_IN_FLIGHT);
+}
+
+
+static void host_send_line(const char *line, uint16_t len, uint32_t src_line)
+{
+  sim_serial_send(line, len);
+  host_in_flight[host_in_flight_head] = len;
+  host_in_flight_line[host_in_flight_head] = src_line;
+  host_in_flight_sequenced[host_in_flight_head] = host_window && src_line && (line[0] != '$');
+  host_synced = (len == 1) && (line[0] == '\n');
+  host_in_flight_head = (host_in_flight_head + 1) % HOST_MAX_IN_FLIGHT;
+  host_in_flight_bytes += len;
+}
+
+
+static void host_release_line()
+{
+  host_in_flight_bytes -= host_in_flight[host_in_flight_tail];
+  host_in_flight_tail = (host_in_flight_tail + 1) % HOST_MAX_IN_FLIGHT;
+}
+
+
+// 处理 Grbl 回复的一行。"ok" 和 "error:" 各应答最早发送的一行；窗口应答 "ok:<N>" 和
+// "error:<代码>:<N>" 应答序号不大于 N 的全部行。
+static void host_process_response(const char *line)
+{
+  if (!host_quiet) { printf("%s\n", line); }
+  if ((strncmp(line, "ok", 2) == 0) || (strncmp(line, "error", 5) == 0)) {
+    if (line[0] == 'e') { host_errors++; }
+    const char *sequence = strchr(line + ((line[0] == 'e') ? 6 : 0), ':');
+    if (sequence) {
+      uint32_t n = strtoul(sequence + 1, NULL, 10);
+      while (host_in_flight_count() && host_in_flight_sequenced[host_in_flight_tail] &&
+             (host_in_flight_line[host_in_flight_tail] <= n)) {
+        host_release_line();
+      }
+    } else if (host_in_flight_count()) {
+      host_release_line();
+    }
+  } else if (strncmp(line, "Grbl ", 5) == 0) {
+    // 上电或复位。复位会清空接收缓冲区，所有未应答的行作废。
+    host_in_flight_tail = host_in_flight_head;
+    host_in_flight_bytes = 0;
+    if (!host_ready) {
+      host_ready = true;
+      host_send_line("$X\n", 3, 0);
+      if (host_window) {
+        char command[16];
+        host_send_line(command, sprintf(command, "$W=%u\n", host_window), 0);
+      }
+    }
+  }
+}
+
+
+static void host_serial_out(uint8_t data)
+{
+  if (data == '\n') {
+    host_response[host_response_len] = 0;
+    host_process_response(host_response);
+    host_response_len = 0;
+  } else if ((data != '\r') && (host_response_len < (LINE_BUFFER_SIZE - 1))) {
+    host_response[host_response_len++] = data;
+  }
+}
+
+
+// 解码一个二进制状态帧，更新累加的机器位置。
+static void host_decode_status_frame()
+{
+  static const uint8_t field_size[STATUS_FRAME_N_FIELD] = { 2, 4, 4, 3, 2, 2, 2 };
+  uint8_t length = host_aux_frame[1];
+  uint8_t *p = &host_aux_frame[2];
+  uint8_t checksum = 0, field_mask, idx;
+  for (idx = 0; idx < length - 1; idx++) { checksum += p[idx]; }
+  if (checksum != p[length - 1]) { host_aux_frame_errors++; return; }
+
+  if (host_aux_frame[0] == CMD_STATUS_FRAME) {
+    field_mask = (1 << STATUS_FRAME_N_FIELD) - 1;
+    for (idx = 0; idx < N_AXIS; idx++, p += 4) {
+      host_aux_position[idx] = (int32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24));
+    }
+    host_aux_position_known = true;
+  } else {
+    field_mask = *p++;
+    uint8_t axis_mask = *p++;
+    for (idx = 0; idx < N_AXIS; idx++) {
+      if (!(axis_mask & bit(idx))) { continue; }
+      if (!host_aux_position_known) { host_aux_frame_errors++; return; }
+      host_aux_position[idx] += (int16_t)(p[0] | (p[1] << 8));
+      p += 2;
+    }
+  }
+  uint8_t state = 0xff;
+  for (idx = 0; idx < STATUS_FRAME_N_FIELD; idx++) {
+    if (!(field_mask & bit(idx))) { continue; }
+    if (idx == 0) { state = p[0]; }
+    p += field_size[idx];
+  }
+  if (p != &host_aux_frame[length + 1]) { host_aux_frame_errors++; }
+  host_aux_reports++;
+  if (!host_quiet) {
+    printf("aux: [%c%u]", (host_aux_frame[0] == CMD_STATUS_FRAME) ? 'F' : 'D', length + 2);
+    if (state != 0xff) { printf(" state=%u", state); }
+    for (idx = 0; idx < N_AXIS; idx++) { printf(" %ld", (long)host_aux_position[idx]); }
+    printf("\n");
+  }
+}
+
+
+static void host_serial_aux_out(uint8_t data)
+{
+  host_aux_bytes++;
+  if (host_aux_frame_len ||
+      ((host_aux_response_len == 0) && ((data == CMD_STATUS_FRAME) || (data == CMD_STATUS_FRAME_DELTA)))) {
+    host_aux_frame[host_aux_frame_len++] = data;
+    if ((host_aux_frame_len > 2) && (host_aux_frame_len == host_aux_frame[1] + 2)) {
+      host_decode_status_frame();
+      host_aux_frame_len = 0;
+    }
+    return;
+  }
+  if (data == '\n') {
+    host_aux_response[host_aux_response_len] = 0;
+    if (host_aux_response[0] == '<') { host_aux_reports++; }
+    if (!host_quiet) { printf("aux: %s\n", host_aux_response); }
+    host_aux_response_len = 0;
+  } else if ((data != '\r') && (host_aux_response_len < (LINE_BUFFER_SIZE - 1))) {
+    host_aux_response[host_aux_response_len++] = data;
+  }
+}
+
+
+// 去掉行中原有的 N 字，在行首加上 N<序号>。系统命令和空行原样复制。
+static uint16_t host_number_line(const char *line, uint32_t sequence, char *out)
+{
+  const char *p = line;
+  char *q = out;
+  char comment = 0;
+
+  while (isspace((unsigned char)*p)) { p++; }
+  if ((*p == '$') || (*p == '%') || (*p == 0)) {
+    strcpy(out, line);
+    return (strlen(out));
+  }
+  q += sprintf(q, "N%lu", (unsigned long)sequence);
+  for (p = line; *p; p++) {
+    if (comment) {
+      if ((comment == '(') && (*p == ')')) { comment = 0; }
+    } else if ((*p == '(') || (*p == ';')) {
+      comment = *p;
+    } else if (toupper((unsigned char)*p) == 'N') {
+      for (p++; (*p == '.') || isdigit((unsigned char)*p); p++) {}
+      p--;
+      continue;
+    }
+    if (*p == '\n') { comment = 0; }
+    *q++ = *p;
+  }
+  *q = 0;
+  return (q - out);
+}
+
+
+// 读取下一行到 host_pending。行尾统一为 '\n'。
+static void host_read_line()
+{
+  if (host_eof || host_pending_len) { return; }
+  if (fgets(host_pending, LINE_BUFFER_SIZE, host_file) == NULL) {
+    host_eof = true;
+    return;
+  }
+  host_pending_len = strcspn(host_pending, "\r\n");
+  host_pending[host_pending_len++] = '\n';
+  host_pending[host_pending_len] = 0;
+}
+
+
+// 步进中断返回后记录本次输出的步进脉冲和方向。引脚反转按设置去除，位按轴编号重排。
+static void host_step_trace(uint64_t cycles)
+{
+  uint8_t step_bits = 0, dir_bits = 0, idx;
+  uint8_t step_port = STEP_PORT, dir_port = DIRECTION_PORT;
+  for (idx = 0; idx < N_AXIS; idx++) {
+    uint8_t step = (step_port & get_step_pin_mask(idx)) != 0;
+    uint8_t dir = (dir_port & get_direction_pin_mask(idx)) != 0;
+    if (bit_istrue(settings.step_invert_mask, bit(idx))) { step = !step; }
+    if (bit_istrue(settings.dir_invert_mask, bit(idx))) { dir = !dir; }
+    if (step) { step_bits |= bit(idx); }
+    if (dir) { dir_bits |= bit(idx); }
+  }
+  trace_write(&host_trace, cycles, step_bits, dir_bits);
+}
+
+
+static double host_wall_seconds()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((now.tv_sec - host_start.tv_sec) + 1e-9 * (now.tv_nsec - host_start.tv_nsec));
+}
+
+
+static void host_finish(int status)
+{
+  trace_close(&host_trace);
+  if (host_estimate) {
+    estimate_update(host_lines_sent);
+    estimate_report(stdout);
+  }
+  fflush(stdout);
+  double wall = host_wall_seconds();
+  fprintf(stderr, "虚拟时间 %.3f 秒，实际用时 %.3f 秒（%.1f 倍速）\n",
+          sim_seconds(), wall, (wall > 0) ? sim_seconds() / wall : 0.0);
+  fprintf(stderr, "发送 %lu 行（其中运动帧 %lu），错误 %lu 行\n", (unsigned long)host_lines_sent,
+          (unsigned long)host_frames_sent, (unsigned long)host_errors);
+  fprintf(stderr, "段缓冲区欠载 %u 次\n", st_get_underrun_count());
+  fprintf(stderr, "规划器入口速度违反约束 %lu 次\n", (unsigned long)host_plan_violations);
+  #ifdef ENABLE_SEGMENT_MERGING
+    fprintf(stderr, "规划器合并线段 %lu 次\n", (unsigned long)plan_get_merge_count());
+  #endif
+  if (host_aux_period) {
+    fprintf(stderr, "副串口状态报告 %lu 次，共 %lu 字节", (unsigned long)host_aux_reports, (unsigned long)host_aux_bytes);
+    if (host_aux_frames) { fprintf(stderr, "，状态帧错误 %lu 个", (unsigned long)host_aux_frame_errors); }
+    fprintf(stderr, "\n");
+  }
+  fprintf(stderr, "中断次数：TIMER1_COMPA %lu，TIMER0_OVF %lu，USART0_RX %lu，USART0_UDRE %lu\n",
+          (unsigned long)sim.n_timer1, (unsigned long)sim.n_timer0, (unsigned long)sim.n_rx, (unsigned long)sim.n_tx);
+  if (host_aux_period) {
+    fprintf(stderr, "          USART1_RX %lu，USART1_UDRE %lu\n", (unsigned long)sim.n_aux_rx, (unsigned long)sim.n_aux_tx);
+  }
+  exit(status);
+}
+
+
+// 每次虚拟时钟推进后调用：按字符计数协议补充发送，并检查作业是否结束。
+static void host_idle()
+{
+  if (host_estimate) {
+    estimate_update(host_in_flight_count() ? host_in_flight_line[host_in_flight_tail] : host_lines_sent);
+  }
+
+  if (plan_check_entry_speeds()) { host_plan_violations++; }
+
+  while (host_ready && (host_rt_next < host_rt_count) && (sim_seconds() >= host_rt_time[host_rt_next])) {
+    sim_serial_send(&host_rt_byte[host_rt_next++], 1);
+  }
+
+  if (host_aux_period && host_ready && (sim.cycles >= host_aux_next)) {
+    char request = host_aux_frames ? CMD_STATUS_FRAME_DELTA : CMD_STATUS_REPORT;
+    sim_serial_aux_send(&request, 1);
+    host_aux_next = sim.cycles + host_aux_period;
+  }
+
+  while (host_ready) {
+    host_read_line();
+    if (!host_pending_len) { break; }
+    if (!host_pending_prepared) {
+      if (host_estimate || host_window) {
+        // 估算时的行号同样可作为窗口应答的序号
+        char line[sizeof(host_pending) + 16];
+        host_pending_len = host_estimate ? estimate_prepare_line(host_pending, host_lines_sent + 1, line) :
+                                           host_number_line(host_pending, host_lines_sent + 1, line);
+        strcpy(host_pending, line);
+      }
+      if (host_binary) {
+        uint8_t frame[FRAME_ENCODE_MAX];
+        uint16_t len = frame_encode_line(host_pending, frame);
+        if (len) {
+          memcpy(host_pending, frame, len);
+          host_pending_len = len;
+          host_frames_sent++;
+        }
+      }
+      host_pending_prepared = true;
+    }
+    if (host_in_flight_count() && ((host_in_flight_bytes + host_pending_len > RX_BUFFER_SIZE) ||
+                                   (host_in_flight_count() == HOST_MAX_IN_FLIGHT - 1))) {
+      break; // 接收缓冲区可能放不下，等待应答。
+    }
+    host_send_line(host_pending, host_pending_len, host_lines_sent + 1);
+    host_pending_prepared = false;
+    host_pending_len = 0;
+    host_lines_sent++;
+  }
+
+  // 窗口应答时发送暂停（输入已读完或接收缓冲区已满），发送一个空行取回窗口内剩余行的应答。
+  if (host_window && host_ready && !host_synced && host_in_flight_count() &&
+      (host_in_flight_bytes < RX_BUFFER_SIZE) && (host_in_flight_count() < HOST_MAX_IN_FLIGHT - 1)) {
+    host_send_line("\n", 1, 0);
+  }
+
+  if (host_eof && !host_pending_len && !host_in_flight_count() && !sim_serial_rx_pending() &&
+      !(UCSR0B & (1 << UDRIE0)) && !(UCSR1B & (1 << UDRIE1)) && (plan_get_current_block() == NULL) &&
+      (!host_aux_frames || !memcmp(host_aux_position, sys_position, sizeof(sys_position)))) {
+    if (sys.state == STATE_IDLE || sys.state == STATE_CHECK_MODE) { host_finish(0); }
+    if (sys.state == STATE_ALARM) { host_finish(1); }
+  }
+  if ((host_max_seconds > 0) && (sim_seconds() > host_max_seconds)) {
+    fprintf(stderr, "超过虚拟时间上限\n");
+    host_finish(2);
+  }
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t loop_us = 100;
+  int opt;
+  const char *trace_path = NULL;
+  uint32_t range_lines = 0;
+  float tool_change_s = 0;
+  while ((opt = getopt(argc, argv, "t:m:s:r:c:bw:p:fo:q")) != -1) {
+    switch (opt) {
+      case 't': loop_us = atol(optarg); break;
+      case 'm': host_max_seconds = atof(optarg); break;
+      case 's': trace_path = optarg; break;
+      case 'r': host_estimate = true; range_lines = atol(optarg); break;
+      case 'c': tool_change_s = atof(optarg); break;
+      case 'b': host_binary = true; frame_encode_init(); break;
+      case 'w': host_window = atoi(optarg); break;
+      case 'p': host_aux_period = (atof(optarg) > 0) ? (uint64_t)(F_CPU / atof(optarg)) : 0; break;
+      case 'f': host_aux_frames = true; break;
+      case 'o':
+        for (char *p = strtok(optarg, ","); p && (host_rt_count < HOST_MAX_RT_COMMANDS); p = strtok(NULL, ",")) {
+          char *colon = strchr(p, ':');
+          if (colon == NULL) { fprintf(stderr, "-o %s：应为 秒:字节\n", p); return (2); }
+          host_rt_time[host_rt_count] = atof(p);
+          host_rt_byte[host_rt_count++] = (char)strtoul(colon + 1, NULL, 16);
+        }
+        break;
+      case 'q': host_quiet = true; break;
+      default:
+        fprintf(stderr, "用法：%s [-t 主循环微秒] [-m 最长虚拟秒数] [-s 跟踪文件] [-r 行数] [-c 换刀秒数] [-b] [-w 行数] [-p 赫兹] [-f] [-o 秒:字节,...] [-q] [文件.nc]\n", argv[0]);
+        return (2);
+    }
+  }
+  host_file = stdin;
+  if ((optind < argc) && strcmp(argv[optind], "-")) {
+    host_file = fopen(argv[optind], "r");
+    if (host_file == NULL) { perror(argv[optind]); return (2); }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &host_start);
+  sim_init(loop_us);
+  sim.serial_out = host_serial_out;
+  sim.serial_aux_out = host_serial_aux_out;
+  sim.idle = host_idle;
+  if (trace_path) {
+    if (!trace_create(&host_trace, trace_path, F_CPU, N_AXIS)) { perror(trace_path); return (2); }
+    sim.step_isr = host_step_trace;
+  }
+  // 像已烧录过的控制板一样预先写入默认设置。空白 EEPROM 会让 settings_init() 在开中断之前
+  // 打印全部设置，超出发送缓冲区后永远等待。
+  settings_restore(SETTINGS_RESTORE_ALL);
+  if (host_estimate) { estimate_init(range_lines, tool_change_s); }
+  grbl_main(); // 不返回。作业结束时由 host_idle() 退出。
+  return (0);
+}
@@ -0,0 +1,374 @@
+/*
+  isr_bench.c - 在 simavr 中测量固件中断服务程序的周期数
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  用法：isr_bench grbl.elf [场景名 ...]
+
+    用 avr-gcc 编译的 ATmega2560 固件映像在 simavr 中逐条指令执行，周期数与控制板一致。
+  每个场景从上电开始，经 USART0 按字符计数协议发送一段 G 代码，统计每个中断向量每次执行的
+  周期数：从跳转到向量表开始，到对应的 RETI 执行完为止，不含硬件响应中断的 5 个周期。步进
+  中断内部开中断后嵌套执行的串口中断从外层扣除，因此表中是各自独占的周期数。
+    TIMER1_COMPA 的最大值对应装载新段（以及新块）的路径，与 stepper.c 中 30kHz 的预算
+  （F_CPU/30000 = 533 周期）比较，超出的次数单独列出。
+    引脚按 defaults.h 的默认设置（$5 限位反转、$6 探针反转）保持在未触发电平。EEPROM 空白时
+  固件会在开中断前打印全部设置而卡在发送缓冲区，所以先做一次准备运行：检测到卡住后强制开中断
+  让固件写入默认设置，之后每个场景都从这份 EEPROM 启动。
+    未验证：本工具还没有在装有 avr-gcc 和 simavr 的机器上编译和运行过，没有测得的周期数可供引用。
+  向量号、中断返回的判断和准备运行的卡住检测都只按数据手册和 simavr 的接口编写，第一次使用时
+  应先用已知周期数的简单中断核对。
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_irq.h"
+#include "avr_uart.h"
+#include "avr_ioport.h"
+#include "avr_eeprom.h"
+
+#define BENCH_F_CPU 16000000
+#define BENCH_ISR_BUDGET (BENCH_F_CPU / 30000) // stepper.c 中的最高步进频率
+#define BENCH_EEPROM_SIZE 4096
+#define BENCH_RX_BUFFER_SIZE 255 // 与 serial.h 一致
+#define BENCH_N_VECTOR 57
+#define BENCH_VECTOR_SIZE 4      // ATmega2560 每个向量是一条 JMP 指令
+#define BENCH_MAX_NEST 8
+#define BENCH_TIMEOUT_SECONDS 120
+
+// ATmega2560 的中断向量号，与 avr-libc 的 *_vect 一致。
+#define VECT_PCINT0 9
+#define VECT_PCINT2 11
+#define VECT_TIMER1_COMPA 17
+#define VECT_TIMER0_OVF 23
+#define VECT_USART0_RX 25
+#define VECT_USART0_UDRE 26
+
+static const struct {
+  uint8_t vector;
+  const char *name;
+} bench_vectors[] = {
+  { VECT_TIMER1_COMPA, "TIMER1_COMPA（步进）" },
+  { VECT_TIMER0_OVF, "TIMER0_OVF（脉冲复位）" },
+  { VECT_USART0_RX, "USART0_RX（串口接收）" },
+  { VECT_USART0_UDRE, "USART0_UDRE（串口发送）" },
+  { VECT_PCINT0, "PCINT0（限位）" },
+  { VECT_PCINT2, "PCINT2（控制按键）" },
+};
+#define BENCH_N_REPORT (sizeof(bench_vectors) / sizeof(bench_vectors[0]))
+
+typedef struct {
+  const char *name;
+  const char *description;
+  const char *gcode;
+  uint16_t limit_ms; // 非零时，在开始发送后该毫秒数触发 X 限位
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+  { "axes1", "单轴快速移动", "G91 G0 X40\n" },
+  { "axes2", "两轴快速移动", "G91 G0 X40 Y40\n" },
+  { "axes3", "三轴快速移动", "G91 G0 X40 Y40 Z20\n" },
+  { "axes4", "四轴快速移动", "G91 G0 X40 Y40 Z20 A90\n" },
+  { "axes5", "五轴快速移动", "G91 G0 X40 Y40 Z20 A90 B90\n" },
+  { "axes6", "六轴快速移动", "G91 G0 X40 Y40 Z20 A90 B90 C90\n" },
+  { "axes7", "七轴快速移动", "G91 G0 X40 Y40 Z20 A90 B90 C90 D90\n" },
+  { "amass", "低速和加减速，AMASS 等级反复切换",
+    "G91 G1 X2 F20\nX2 F100\nX5 F500\nX20 F2000\nX-20 Y10 F3000\nG0 X-9 Y-10\n" },
+  { "segment", "0.05mm 微段，频繁装载新段和新块",
+    "G91 G1 F3000\n"
+    "X0.05\nY0.05\nX-0.05\nY-0.05\nX0.05 Y0.05\nX-0.05 Y-0.05\nX0.05 Z-0.01\nX-0.05 Z0.01\n"
+    "X0.05\nY0.05\nX-0.05\nY-0.05\nX0.05 Y0.05\nX-0.05 Y-0.05\nX0.05 Z-0.01\nX-0.05 Z0.01\n"
+    "X0.05\nY0.05\nX-0.05\nY-0.05\nX0.05 Y0.05\nX-0.05 Y-0.05\nX0.05 Z-0.01\nX-0.05 Z0.01\n"
+    "X0.05\nY0.05\nX-0.05\nY-0.05\nX0.05 Y0.05\nX-0.05 Y-0.05\nX0.05 Z-0.01\nX-0.05 Z0.01\n" },
+  { "probe", "探测运动，每次步进中断监视探针", "G91 G38.3 Z-10 F500\n" },
+  { "limit", "运动中触发硬限位", "G91 G0 X100\n", 200 },
+};
+#define BENCH_N_SCENARIO (sizeof(scenarios) / sizeof(scenario_t))
+
+typedef struct {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+  uint32_t over_budget;
+} isr_stats_t;
+
+static struct {
+  avr_t *avr;
+  avr_irq_t *uart_in;
+  uint8_t xon;
+
+  // 中断嵌套栈
+  uint8_t depth;
+  struct {
+    uint8_t vector;
+    avr_cycle_count_t start;
+    avr_cycle_count_t nested; // 嵌套中断占用的周期
+  } stack[BENCH_MAX_NEST];
+  isr_stats_t stats[BENCH_N_VECTOR];
+
+  // 主机流式发送
+  const char *gcode;
+  uint8_t ready;
+  uint8_t done;
+  uint8_t alarm;
+  uint16_t in_flight[64];
+  uint8_t in_flight_head;
+  uint8_t in_flight_tail;
+  uint16_t in_flight_bytes;
+  char tx[BENCH_RX_BUFFER_SIZE + 1];
+  uint16_t tx_len;
+  uint16_t tx_pos;
+  char response[128];
+  uint8_t response_len;
+} bench;
+
+
+static void bench_uart_xon(struct avr_irq_t *irq, uint32_t value, void *param) { bench.xon = 1; }
+static void bench_uart_xoff(struct avr_irq_t *irq, uint32_t value, void *param) { bench.xon = 0; }
+
+
+// 处理固件回复的一行。
+static void bench_response(const char *line)
+{
+  if (!strncmp(line, "ok", 2) || !strncmp(line, "error", 5)) {
+    if (bench.in_flight_head != bench.in_flight_tail) {
+      bench.in_flight_bytes -= bench.in_flight[bench.in_flight_tail];
+      bench.in_flight_tail = (bench.in_flight_tail + 1) % 64;
+    }
+  } else if (!strncmp(line, "ALARM", 5)) {
+    bench.alarm = 1;
+  } else if (!strncmp(line, "Grbl ", 5)) {
+    bench.ready = 1;
+  }
+}
+
+
+static void bench_uart_out(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+  if (value == '\n') {
+    bench.response[bench.response_len] = 0;
+    bench_response(bench.response);
+    bench.response_len = 0;
+  } else if ((value != '\r') && (bench.response_len < sizeof(bench.response) - 1)) {
+    bench.response[bench.response_len++] = value;
+  }
+}
+
+
+// 把下一行放入发送缓冲，受字符计数协议限制。
+static void bench_next_line()
+{
+  if (bench.tx_pos < bench.tx_len) { return; }
+  if (!bench.gcode || !*bench.gcode) { return; }
+  const char *end = strchr(bench.gcode, '\n');
+  uint16_t len = end ? (end - bench.gcode + 1) : strlen(bench.gcode);
+  if ((bench.in_flight_bytes + len > BENCH_RX_BUFFER_SIZE) ||
+      ((bench.in_flight_head + 1) % 64 == bench.in_flight_tail)) { return; }
+  memcpy(bench.tx, bench.gcode, len);
+  bench.tx_len = len;
+  bench.tx_pos = 0;
+  bench.gcode += len;
+  bench.in_flight[bench.in_flight_head] = len;
+  bench.in_flight_head = (bench.in_flight_head + 1) % 64;
+  bench.in_flight_bytes += len;
+}
+
+
+static void bench_set_pin(avr_t *avr, char port, uint8_t bit, uint8_t level)
+{
+  avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(port), bit), level);
+}
+
+
+static avr_t *bench_boot(elf_firmware_t *firmware, uint8_t *eeprom)
+{
+  avr_t *avr = avr_make_mcu_by_name("atmega2560");
+  if (!avr) {
+    fprintf(stderr, "simavr 不支持 atmega2560\n");
+    exit(2);
+  }
+  avr_init(avr);
+  avr->frequency = BENCH_F_CPU;
+  avr_load_firmware(avr, firmware);
+  if (eeprom) {
+    avr_eeprom_desc_t desc = { .ee = eeprom, .offset = 0, .size = BENCH_EEPROM_SIZE };
+    avr_ioctl(avr, AVR_IOCTL_EEPROM_SET, &desc);
+  }
+
+  // 串口不回显到终端，按 simavr 的流控逐字节送入
+  uint32_t flags = 0;
+  avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &flags);
+  flags &= ~AVR_UART_FLAG_STDIO;
+  avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &flags);
+  bench.uart_in = avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_INPUT);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT), bench_uart_out, NULL);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUT_XON), bench_uart_xon, NULL);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUT_XOFF), bench_uart_xoff, NULL);
+  bench.xon = 1;
+
+  // 开关保持未触发：限位和探针在默认设置下反转，低电平为未触发；控制按键和刀库开关为上拉高电平。
+  uint8_t bit;
+  for (bit = 0; bit < 7; bit++) { bench_set_pin(avr, 'B', bit, 0); }
+  bench_set_pin(avr, 'J', 0, 0);
+  for (bit = 0; bit < 4; bit++) { bench_set_pin(avr, 'K', bit, 1); }
+  bench_set_pin(avr, 'L', 6, 1);
+  bench_set_pin(avr, 'L', 7, 1);
+  bench_set_pin(avr, 'D', 7, 1);
+  return (avr);
+}
+
+
+// 执行一条指令并维护中断嵌套栈。
+static int bench_step(avr_t *avr)
+{
+  uint16_t opcode = avr->flash[avr->pc] | (avr->flash[avr->pc + 1] << 8);
+  int state = avr_run(avr);
+
+  if ((opcode == 0x9518) && bench.depth) { // RETI
+    bench.depth--;
+    avr_cycle_count_t total = avr->cycle - bench.stack[bench.depth].start;
+    uint32_t cycles = total - bench.stack[bench.depth].nested;
+    isr_stats_t *stats = &bench.stats[bench.stack[bench.depth].vector];
+    if (!stats->count || (cycles < stats->min)) { stats->min = cycles; }
+    if (cycles > stats->max) { stats->max = cycles; }
+    if (cycles > BENCH_ISR_BUDGET) { stats->over_budget++; }
+    stats->total += cycles;
+    stats->count++;
+    if (bench.depth) { bench.stack[bench.depth - 1].nested += total; }
+  }
+  if (avr->pc && (avr->pc < BENCH_N_VECTOR * BENCH_VECTOR_SIZE) && !(avr->pc % BENCH_VECTOR_SIZE) &&
+      (bench.depth < BENCH_MAX_NEST)) {
+    bench.stack[bench.depth].vector = avr->pc / BENCH_VECTOR_SIZE;
+    bench.stack[bench.depth].start = avr->cycle;
+    bench.stack[bench.depth].nested = 0;
+    bench.depth++;
+  }
+  return (state);
+}
+
+
+// 空白 EEPROM 准备运行，返回固件写入默认设置后的 EEPROM 映像。
+static void bench_provision(elf_firmware_t *firmware, uint8_t *eeprom)
+{
+  memset(&bench, 0, sizeof(bench));
+  avr_t *avr = bench_boot(firmware, NULL);
+  uint8_t forced = 0;
+  while (!bench.ready) {
+    int state = avr_run(avr);
+    if ((state == cpu_Done) || (state == cpu_Crashed) || (avr->cycle > 10ULL * BENCH_F_CPU)) {
+      fprintf(stderr, "固件未能启动\n");
+      exit(2);
+    }
+    if (!forced && (avr->cycle > BENCH_F_CPU / 2) && !avr->sreg[S_I]) {
+      avr->sreg[S_I] = 1; // 见文件开头的说明
+      forced = 1;
+    }
+  }
+  avr_eeprom_desc_t desc = { .ee = NULL, .offset = 0, .size = BENCH_EEPROM_SIZE };
+  avr_ioctl(avr, AVR_IOCTL_EEPROM_GET, &desc);
+  memcpy(eeprom, desc.ee, BENCH_EEPROM_SIZE);
+  avr_terminate(avr);
+}
+
+
+static void bench_scenario(const scenario_t *scenario, elf_firmware_t *firmware, uint8_t *eeprom)
+{
+  memset(&bench, 0, sizeof(bench));
+  avr_t *avr = bench_boot(firmware, eeprom);
+  avr_cycle_count_t start = 0;
+  uint8_t unlocked = 0, synced = 0;
+
+  for (;;) {
+    int state = bench_step(avr);
+    if ((state == cpu_Done) || (state == cpu_Crashed)) {
+      fprintf(stderr, "%s：固件停止运行\n", scenario->name);
+      break;
+    }
+    if (avr->cycle > (avr_cycle_count_t)BENCH_TIMEOUT_SECONDS * BENCH_F_CPU) {
+      fprintf(stderr, "%s：超时\n", scenario->name);
+      break;
+    }
+    if (!bench.ready) { continue; }
+    if (!unlocked) {
+      bench.gcode = "$X\n"; // 归位锁定
+      unlocked = 1;
+    } else if (!start && (bench.in_flight_head == bench.in_flight_tail) && !*bench.gcode) {
+      bench.gcode = scenario->gcode;
+      start = avr->cycle;
+    }
+    if (scenario->limit_ms && start && (avr->cycle - start >= (avr_cycle_count_t)scenario->limit_ms * (BENCH_F_CPU / 1000))) {
+      bench_set_pin(avr, 'B', 4, 1); // X 限位触发
+    }
+    if (bench.alarm) { break; }
+    // G 代码发完后以 G4 P0 同步，应答时全部运动已执行完
+    if (start && !*bench.gcode && (bench.in_flight_head == bench.in_flight_tail)) {
+      if (synced) { break; }
+      bench.gcode = "G4 P0\n";
+      synced = 1;
+    }
+    bench_next_line();
+    if (bench.xon && (bench.tx_pos < bench.tx_len)) { avr_raise_irq(bench.uart_in, bench.tx[bench.tx_pos++]); }
+  }
+
+  printf("%s：%s，%.3f 秒\n", scenario->name, scenario->description, (double)(avr->cycle - start) / BENCH_F_CPU);
+  uint8_t idx;
+  for (idx = 0; idx < BENCH_N_REPORT; idx++) {
+    isr_stats_t *stats = &bench.stats[bench_vectors[idx].vector];
+    if (!stats->count) { continue; }
+    printf("  %-28s %9lu %6lu %8.1f %6lu", bench_vectors[idx].name, (unsigned long)stats->count,
+           (unsigned long)stats->min, (double)stats->total / stats->count, (unsigned long)stats->max);
+    if (bench_vectors[idx].vector == VECT_TIMER1_COMPA) {
+      printf("  超出预算 %lu 次", (unsigned long)stats->over_budget);
+    }
+    printf("\n");
+  }
+  avr_terminate(avr);
+}
+
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2) {
+    fprintf(stderr, "用法：%s grbl.elf [场景名 ...]\n", argv[0]);
+    return (2);
+  }
+  elf_firmware_t firmware;
+  memset(&firmware, 0, sizeof(firmware));
+  if (elf_read_firmware(argv[1], &firmware)) {
+    fprintf(stderr, "无法读取 %s\n", argv[1]);
+    return (2);
+  }
+  strcpy(firmware.mmcu, "atmega2560");
+  firmware.frequency = BENCH_F_CPU;
+
+  static uint8_t eeprom[BENCH_EEPROM_SIZE];
+  bench_provision(&firmware, eeprom);
+
+  printf("中断周期数（不含 5 周期中断响应），步进中断预算 %d 周期\n", BENCH_ISR_BUDGET);
+  printf("  %-28s %9s %6s %8s %6s\n", "向量", "次数", "最小", "平均", "最大");
+  uint8_t idx;
+  for (idx = 0; idx < BENCH_N_SCENARIO; idx++) {
+    uint8_t selected = (argc == 2);
+    int arg;
+    for (arg = 2; arg < argc; arg++) {
+      if (!strcmp(argv[arg], scenarios[idx].name)) { selected = 1; }
+    }
+    if (selected) { bench_scenario(&scenarios[idx], &firmware, eeprom); }
+  }
+  return (0);
+}
@@ -0,0 +1,212 @@
+/*
+  parse_bench.c - G 代码解析器的性能基准
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  用法：parse_bench [-r 重复次数] [语料名 ...]
+
+    每个语料先生成为与 protocol_main_loop() 过滤后相同的行（大写、无空白和注释），再按主循环的
+  方式逐字符调用 gc_tokenize_char()，行尾调用 gc_execute_tokens()。解析器处于检查模式（$C），
+  运动不进入规划器，所以计时只包含分词、数值转换、错误检查和模态更新。语料中没有圆弧，因为
+  检查模式下 mc_arc() 仍然展开圆弧。
+    结果为每行平均耗时和每秒处理的字数。与 plan_bench 一样，主机耗时只用于不同提交之间的相对
+  比较：主机有硬件浮点，ATmega2560 上软件浮点运算的代价要大得多。
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include "grbl.h"
+#include "avr_sim.h"
+
+#define BENCH_MAX_LINES 20000
+
+typedef struct {
+  const char *name;
+  const char *description;
+  void (*generate)(void);
+} corpus_t;
+
+static struct {
+  uint32_t n_line;
+  uint32_t n_word;
+  char *line[BENCH_MAX_LINES];
+} bench;
+
+
+static uint64_t bench_now_ns()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return ((uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+
+// 加入一行并统计其中的字数（字母个数）。
+static void bench_add(const char *line)
+{
+  if (bench.n_line == BENCH_MAX_LINES) { return; }
+  bench.line[bench.n_line++] = strdup(line);
+  for (; *line; line++) {
+    if ((*line >= 'A') && (*line <= 'Z')) { bench.n_word++; }
+  }
+}
+
+
+// 三维曲面精加工：之字形行切，每行 X/Y/Z 三个坐标字，3 位小数，与常见 CAM 输出相同。
+static void corpus_surface()
+{
+  char line[LINE_BUFFER_SIZE];
+  uint16_t row, col;
+  bench_add("G21G90G94");
+  bench_add("G1F1500");
+  for (row = 0; row < 40; row++) {
+    float y = 0.5 * row;
+    for (col = 0; col <= 400; col++) {
+      float x = (row & 1) ? 40 - 0.1 * col : 0.1 * col;
+      sprintf(line, "X%.3fY%.3fZ%.3f", x, y, -1 + 0.5 * sin(x / 5) * cos(y / 7));
+      bench_add(line);
+    }
+  }
+}
+
+
+// 四轴缠绕：带 G1 和行号，X/Z/A 坐标 4 位小数。
+static void corpus_wrap()
+{
+  char line[LINE_BUFFER_SIZE];
+  uint32_t n;
+  bench_add("G21G90G94F1000");
+  for (n = 1; n <= 12000; n++) {
+    float a = 3.0 * n;
+    sprintf(line, "N%luG1X%.4fZ%.4fA%.4f", (unsigned long)n, 0.02 * n, -1 + 0.2 * sin(a * M_PI / 45), a);
+    bench_add(line);
+  }
+}
+
+
+// 程序控制：每行有多个 G/M 命令字以及 F、S、T 等数值字，命令字占多数。
+static void corpus_program()
+{
+  char line[LINE_BUFFER_SIZE];
+  uint16_t n;
+  for (n = 0; n < 2000; n++) {
+    sprintf(line, "G90G54G17G0X%dY%d", n % 50, n % 30);
+    bench_add(line);
+    sprintf(line, "G1G94Z-%d.5F%dS%dM3", n % 3, 200 + (n % 7) * 100, 1000 + (n % 5) * 500);
+    bench_add(line);
+    sprintf(line, "G4P0.%02dM8", n % 100);
+    bench_add(line);
+    bench_add("G91G0Z5M9");
+  }
+}
+
+
+static const corpus_t corpora[] = {
+  { "surface", "三维曲面坐标字", corpus_surface },
+  { "wrap", "带行号的四轴坐标字", corpus_wrap },
+  { "program", "G/M 命令字为主", corpus_program },
+};
+#define N_CORPUS (sizeof(corpora) / sizeof(corpus_t))
+
+
+// 复位解析器并进入检查模式。
+static void bench_reset()
+{
+  memset(&sys, 0, sizeof(system_t));
+  sys.state = STATE_CHECK_MODE;
+  sys.f_override = DEFAULT_FEED_OVERRIDE;
+  sys.r_override = DEFAULT_RAPID_OVERRIDE;
+  sys.spindle_speed_ovr = DEFAULT_SPINDLE_SPEED_OVERRIDE;
+  memset(sys_position, 0, sizeof(sys_position));
+  gc_init();
+  plan_reset();
+  gc_sync_position();
+  gc_tokenize_reset();
+}
+
+
+static void bench_free()
+{
+  uint32_t n;
+  for (n = 0; n < bench.n_line; n++) { free(bench.line[n]); }
+  bench.n_line = 0;
+  bench.n_word = 0;
+}
+
+
+static void bench_run(const corpus_t *corpus, uint16_t repeat)
+{
+  double best_ns = 0;
+  uint32_t n_error = 0, n, k;
+
+  corpus->generate();
+  for (n = 0; n < repeat; n++) {
+    bench_reset();
+    n_error = 0;
+    uint64_t start = bench_now_ns();
+    for (k = 0; k < bench.n_line; k++) {
+      char *c;
+      for (c = bench.line[k]; *c; c++) { gc_tokenize_char(*c); }
+      if (gc_execute_tokens(bench.line[k])) { n_error++; }
+      gc_tokenize_reset();
+    }
+    double elapsed = bench_now_ns() - start;
+    if ((n == 0) || (elapsed < best_ns)) { best_ns = elapsed; }
+  }
+
+  printf("%-8s %6lu %7lu %9.1f %11.0f %5lu  %s\n", corpus->name, (unsigned long)bench.n_line,
+         (unsigned long)bench.n_word, best_ns / bench.n_line, bench.n_word / (best_ns * 1e-9),
+         (unsigned long)n_error, corpus->description);
+  bench_free();
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint16_t repeat = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "r:")) != -1) {
+    switch (opt) {
+      case 'r': repeat = atoi(optarg); break;
+      default:
+        fprintf(stderr, "用法：%s [-r 重复次数] [语料名 ...]\n", argv[0]);
+        return (2);
+    }
+  }
+  if (repeat < 1) { repeat = 1; }
+
+  // 与 main() 相同的上电初始化，但不进入协议主循环。
+  sim_init(100);
+  settings_restore(SETTINGS_RESTORE_ALL);
+  serial_init();
+  stepper_init();
+  system_init();
+  sei();
+  settings.flags &= ~BITFLAG_SOFT_LIMIT_ENABLE; // 语料不受机床行程约束
+
+  printf("语料        行数    字数    ns/行       字/秒  错误\n");
+  uint8_t idx;
+  for (idx = 0; idx < N_CORPUS; idx++) {
+    uint8_t selected = (optind == argc);
+    int arg;
+    for (arg = optind; arg < argc; arg++) {
+      if (strcmp(argv[arg], corpora[idx].name) == 0) { selected = true; }
+    }
+    if (selected) { bench_run(&corpora[idx], repeat); }
+  }
+  return (0);
+}
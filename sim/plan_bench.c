@@ -0,0 +1,328 @@
+/*
+  plan_bench.c - 规划器在典型刀路上的性能基准
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  用法：plan_bench [-r 重复次数] [语料名 ...]
+
+    每个语料经 mc_line()/mc_arc() 生成规划块，分两个阶段运行：
+    1. 计时阶段：测量每次 plan_buffer_line()（含 planner_recalculate()）的主机耗时。每加入一块后
+       若缓冲区已满就丢弃最早的块，使规划器始终在 BLOCK_BUFFER_SIZE-1 块的满缓冲区上重新规划，
+       与控制板流式加工时的稳态一致。
+    2. 执行阶段：在虚拟时钟上让步进程序实际执行全部运动，得到实际平均进给，与编程进给（按轴
+       最大速率限制后的 F 或快速移动速率）比较。比例明显低于 100% 说明加减速或前瞻长度不足。
+       “合并”为执行阶段中规划器合并的线段数（ENABLE_SEGMENT_MERGING）。
+    主机耗时不等于 ATmega2560 上的周期数，只用于不同提交之间的相对比较；控制板上的周期数可用
+  isr_bench 测量（尚未运行验证）。平均值和最坏值受主机调度干扰，-r 可多次重复取最小平均值和最小最坏值。
+*/
+
+#include <stdio.h>
+#include <stddef.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include "grbl.h"
+#include "avr_sim.h"
+
+#define BENCH_MAX_SAMPLES 65536
+
+typedef struct {
+  const char *name;
+  const char *description;
+  void (*generate)(void);
+} corpus_t;
+
+static struct {
+  uint8_t plan_only;     // 计时阶段：满缓冲区时丢弃最早的块，不执行运动
+  float position[N_AXIS];  // 当前刀具位置，供 mc_arc() 使用
+  float planned[N_AXIS];   // 最后一次成功规划的目标
+  uint32_t n_block;
+  double millimeters;
+  double programmed_minutes;
+  uint32_t n_sample;
+  uint32_t sample_ns[BENCH_MAX_SAMPLES];
+} bench;
+
+uint8_t __real_plan_buffer_line(float *target, plan_line_data_t *pl_data);
+
+
+static uint64_t bench_now_ns()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+
+// 链接时以 -Wl,--wrap=plan_buffer_line 替换 mc_line() 对规划器的调用。
+uint8_t __wrap_plan_buffer_line(float *target, plan_line_data_t *pl_data)
+{
+  uint64_t start = bench_now_ns();
+  uint8_t planned = __real_plan_buffer_line(target, pl_data);
+  uint64_t elapsed = bench_now_ns() - start;
+
+  if (planned == PLAN_OK) {
+    float unit_vec[N_AXIS];
+    uint8_t idx;
+    for (idx = 0; idx < N_AXIS; idx++) { unit_vec[idx] = target[idx] - bench.planned[idx]; }
+    float millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+    #ifdef ENABLE_NATIVE_ARCS
+      if (pl_data->arc_travel != 0.0) {
+        // 圆弧块按螺旋线长度计，速率限制与规划器相同，取两个平面轴都沿切向移动的最坏情况。
+        float plane_mm = fabs(pl_data->arc_travel) * hypot(pl_data->arc_offset[0], pl_data->arc_offset[1]);
+        float mm_sqr = plane_mm * plane_mm;
+        for (idx = 0; idx < N_AXIS; idx++) {
+          unit_vec[idx] = target[idx] - bench.planned[idx];
+          if ((idx != pl_data->arc_axis_0) && (idx != pl_data->arc_axis_1)) { mm_sqr += unit_vec[idx] * unit_vec[idx]; }
+        }
+        millimeters = sqrt(mm_sqr);
+        for (idx = 0; idx < N_AXIS; idx++) { unit_vec[idx] /= millimeters; }
+        unit_vec[pl_data->arc_axis_0] = unit_vec[pl_data->arc_axis_1] = plane_mm / millimeters;
+      }
+    #endif
+    float rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+    if (!(pl_data->condition & PL_COND_FLAG_RAPID_MOTION) && (pl_data->feed_rate < rate)) { rate = pl_data->feed_rate; }
+    memcpy(bench.planned, target, sizeof(bench.planned));
+    bench.n_block++;
+    bench.millimeters += millimeters;
+    bench.programmed_minutes += millimeters / rate;
+    if (bench.plan_only && (bench.n_sample < BENCH_MAX_SAMPLES)) { bench.sample_ns[bench.n_sample++] = elapsed; }
+  }
+  if (bench.plan_only && plan_check_full_buffer()) { plan_discard_current_block(); }
+  return (planned);
+}
+
+
+static void bench_line(float x, float y, float z, float a, float feed_rate)
+{
+  plan_line_data_t plan_data;
+  memset(&plan_data, 0, sizeof(plan_line_data_t));
+  if (feed_rate > 0) { plan_data.feed_rate = feed_rate; }
+  else { plan_data.condition = PL_COND_FLAG_RAPID_MOTION; }
+  bench.position[X_AXIS] = x;
+  bench.position[Y_AXIS] = y;
+  bench.position[Z_AXIS] = z;
+  bench.position[A_AXIS] = a;
+  float target[N_AXIS];
+  memcpy(target, bench.position, sizeof(target));
+  mc_line(target, &plan_data);
+}
+
+
+// XY 平面圆弧，圆心为当前位置加 (i, j)。
+static void bench_arc(float x, float y, float i, float j, uint8_t is_clockwise_arc, float feed_rate)
+{
+  plan_line_data_t plan_data;
+  memset(&plan_data, 0, sizeof(plan_line_data_t));
+  plan_data.feed_rate = feed_rate;
+  float target[N_AXIS], offset[N_AXIS] = { 0 };
+  memcpy(target, bench.position, sizeof(target));
+  target[X_AXIS] = x;
+  target[Y_AXIS] = y;
+  offset[X_AXIS] = i;
+  offset[Y_AXIS] = j;
+  mc_arc(target, &plan_data, bench.position, offset, hypot(i, j), X_AXIS, Y_AXIS, Z_AXIS, is_clockwise_arc);
+  mc_arc_finish();
+  memcpy(bench.position, target, sizeof(target));
+}
+
+
+// 三维曲面精加工：40x40 毫米之字形行切，行距 0.5 毫米，每段 0.1 毫米。
+static void corpus_surface()
+{
+  uint16_t row, col;
+  bench_line(0, 0, 1, 0, 0);
+  for (row = 0; row < 80; row++) {
+    float y = 0.5 * row;
+    for (col = 0; col <= 400; col++) {
+      float x = (row & 1) ? 40 - 0.1 * col : 0.1 * col;
+      bench_line(x, y, -1 + 0.5 * sin(x / 5) * cos(y / 7), 0, 1500);
+    }
+  }
+}
+
+
+// 圆弧：半径 2-20 毫米的整圆和顺逆交替的半圆，由 mc_arc() 按 $12 展开为直线段。
+static void corpus_arcs()
+{
+  uint8_t n;
+  bench_line(0, 0, -1, 0, 0);
+  for (n = 0; n < 20; n++) {
+    float r = 2 + n;
+    bench_line(r, 0, -1, 0, 800);
+    bench_arc(r, 0, -r, 0, true, 800);
+  }
+  bench_line(0, 0, -1, 0, 800);
+  for (n = 0; n < 40; n++) {
+    bench_arc(bench.position[X_AXIS] + 10, 0, 5, 0, n & 1, 800);
+  }
+}
+
+
+// 四轴缠绕：A 轴每段转 3 度，X 随之前进 0.02 毫米，Z 随 A 起伏，共 100 圈。
+static void corpus_wrap()
+{
+  uint32_t n;
+  bench_line(0, 0, -1, 0, 0);
+  for (n = 1; n <= 12000; n++) {
+    float a = 3.0 * n;
+    bench_line(0.02 * n, 0, -1 + 0.2 * sin(a * M_PI / 45), a, 1000);
+  }
+}
+
+
+// CAM 微段：沿缓变曲线每 0.02 毫米一段，坐标按 3 位小数取整，共 6000 段。
+static void corpus_micro()
+{
+  uint16_t n;
+  bench_line(0, 0, -1, 0, 0);
+  for (n = 1; n <= 6000; n++) {
+    float x = 0.02 * n;
+    bench_line(x, round(20000 * sin(x / 30)) / 1000, -1, 0, 2000);
+  }
+}
+
+
+// 长距离快速移动：在 +-200 毫米范围内的固定伪随机点之间定位。
+static void corpus_rapids()
+{
+  uint32_t seed = 12345;
+  uint16_t n;
+  for (n = 0; n < 200; n++) {
+    float p[3];
+    uint8_t idx;
+    for (idx = 0; idx < 3; idx++) {
+      seed = seed * 1103515245 + 12345;
+      p[idx] = ((seed >> 8) % 40001) / 100.0 - 200;
+    }
+    bench_line(p[0], p[1], p[2] / 4, 0, 0);
+  }
+}
+
+
+static const corpus_t corpora[] = {
+  { "surface", "三维曲面 0.1mm 微段", corpus_surface },
+  { "arcs", "G2/G3 圆弧（mc_arc）", corpus_arcs },
+  { "wrap", "四轴 A 缠绕", corpus_wrap },
+  { "rapids", "长距离快速移动", corpus_rapids },
+  { "micro", "CAM 0.02mm 近似共线微段", corpus_micro },
+};
+#define N_CORPUS (sizeof(corpora) / sizeof(corpus_t))
+
+
+// 与 main() 中每次复位后的初始化相同，并把机器放在原点。
+static void bench_reset()
+{
+  memset(&sys, 0, sizeof(system_t));
+  sys.state = STATE_IDLE;
+  sys.f_override = DEFAULT_FEED_OVERRIDE;
+  sys.r_override = DEFAULT_RAPID_OVERRIDE;
+  sys.spindle_speed_ovr = DEFAULT_SPINDLE_SPEED_OVERRIDE;
+  sys_rt_exec_state = 0;
+  sys_rt_exec_alarm = 0;
+  memset(sys_position, 0, sizeof(sys_position));
+  gc_init();
+  plan_reset();
+  st_reset();
+  plan_sync_position();
+  gc_sync_position();
+  memset(&bench, 0, offsetof(typeof(bench), sample_ns));
+}
+
+
+static int bench_compare(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return ((x > y) - (x < y));
+}
+
+
+static void bench_run(const corpus_t *corpus, uint16_t repeat)
+{
+  double best_mean = 0;
+  uint32_t best_p99 = 0, best_max = 0, n;
+
+  for (n = 0; n < repeat; n++) {
+    bench_reset();
+    bench.plan_only = true;
+    corpus->generate();
+    uint64_t total = 0;
+    uint32_t k;
+    for (k = 0; k < bench.n_sample; k++) { total += bench.sample_ns[k]; }
+    qsort(bench.sample_ns, bench.n_sample, sizeof(uint32_t), bench_compare);
+    double mean = bench.n_sample ? (double)total / bench.n_sample : 0;
+    uint32_t p99 = bench.n_sample ? bench.sample_ns[(bench.n_sample * 99) / 100] : 0;
+    uint32_t max = bench.n_sample ? bench.sample_ns[bench.n_sample - 1] : 0;
+    if ((n == 0) || (mean < best_mean)) { best_mean = mean; }
+    if ((n == 0) || (p99 < best_p99)) { best_p99 = p99; }
+    if ((n == 0) || (max < best_max)) { best_max = max; }
+  }
+
+  bench_reset();
+  uint64_t start = sim.cycles;
+  corpus->generate();
+  protocol_buffer_synchronize();
+  double minutes = (double)(sim.cycles - start) / F_CPU / 60;
+
+  double programmed = (bench.programmed_minutes > 0) ? bench.millimeters / bench.programmed_minutes : 0;
+  double achieved = (minutes > 0) ? bench.millimeters / minutes : 0;
+  #ifdef ENABLE_SEGMENT_MERGING
+    uint32_t merged = plan_get_merge_count();
+  #else
+    uint32_t merged = 0;
+  #endif
+  printf("%-8s %7lu %9.1f %8lu %8lu %9.1f %9.1f %6.1f%% %6lu  %s\n", corpus->name, (unsigned long)bench.n_block,
+         best_mean, (unsigned long)best_p99, (unsigned long)best_max, programmed, achieved,
+         (programmed > 0) ? 100 * achieved / programmed : 0.0, (unsigned long)merged, corpus->description);
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint16_t repeat = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "r:")) != -1) {
+    switch (opt) {
+      case 'r': repeat = atoi(optarg); break;
+      default:
+        fprintf(stderr, "用法：%s [-r 重复次数] [语料名 ...]\n", argv[0]);
+        return (2);
+    }
+  }
+  if (repeat < 1) { repeat = 1; }
+
+  // 与 main() 相同的上电初始化，但不进入协议主循环。
+  sim_init(100);
+  settings_restore(SETTINGS_RESTORE_ALL);
+  serial_init();
+  stepper_init();
+  system_init();
+  sei();
+  settings.flags &= ~BITFLAG_SOFT_LIMIT_ENABLE; // 语料不受机床行程约束
+
+  printf("BLOCK_BUFFER_SIZE %d（每块 %d 字节），$1x 加速度 %.0f mm/s^2，$11 结点偏差 %.3f mm，$12 圆弧公差 %.3f mm\n",
+         BLOCK_BUFFER_SIZE, (int)sizeof(plan_block_t), settings.acceleration[X_AXIS] / (60 * 60), settings.junction_deviation, settings.arc_tolerance);
+  printf("语料        块数   平均ns/块   p99 ns   最大ns  编程进给  实际进给   比例    合并\n");
+  uint8_t idx;
+  for (idx = 0; idx < N_CORPUS; idx++) {
+    uint8_t selected = (optind == argc);
+    int arg;
+    for (arg = optind; arg < argc; arg++) {
+      if (strcmp(argv[arg], corpora[idx].name) == 0) { selected = true; }
+    }
+    if (selected) { bench_run(&corpora[idx], repeat); }
+  }
+  return (0);
+}
@@ -0,0 +1,15 @@
+G21G90G94G17
+G0X0Y0Z0
+G1X10F1500
+G2X10Y0I10J0
+G3X30Y0I10J0
+G2X50Y0R10
+G3X50Y0Z-2I-5J0
+G18G2X60Z-2I5K0
+G19G3Y10Z-2J5K0
+G17G1X60Y20F3000
+G2X62Y22I2J0
+G3X64Y24I0J2
+G2X66Y26I2J0
+G93G2X80Y20I7J-3F6
+G94G0X0Y0Z0
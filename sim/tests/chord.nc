@@ -0,0 +1,3006 @@
+$120=20
+$121=20
+$110=10000
+$111=10000
+G21G90G94
+G1F8000
+X-0.003Y0.500
+X-0.012Y1.000
+X-0.028Y1.500
+X-0.050Y1.999
+X-0.078Y2.498
+X-0.112Y2.997
+X-0.153Y3.496
+X-0.200Y3.993
+X-0.253Y4.491
+X-0.312Y4.987
+X-0.378Y5.483
+X-0.449Y5.978
+X-0.527Y6.471
+X-0.611Y6.964
+X-0.701Y7.456
+X-0.797Y7.947
+X-0.900Y8.436
+X-1.008Y8.924
+X-1.123Y9.411
+X-1.244Y9.896
+X-1.370Y10.380
+X-1.503Y10.862
+X-1.642Y11.342
+X-1.787Y11.821
+X-1.937Y12.298
+X-2.094Y12.772
+X-2.257Y13.245
+X-2.425Y13.716
+X-2.599Y14.185
+X-2.780Y14.651
+X-2.966Y15.115
+X-3.158Y15.577
+X-3.355Y16.036
+X-3.558Y16.493
+X-3.767Y16.947
+X-3.982Y17.399
+X-4.202Y17.847
+X-4.428Y18.294
+X-4.660Y18.737
+X-4.897Y19.177
+X-5.139Y19.614
+X-5.387Y20.049
+X-5.640Y20.480
+X-5.899Y20.907
+X-6.163Y21.332
+X-6.432Y21.753
+X-6.707Y22.171
+X-6.987Y22.586
+X-7.271Y22.997
+X-7.561Y23.404
+X-7.857Y23.808
+X-8.157Y24.207
+X-8.462Y24.604
+X-8.772Y24.996
+X-9.087Y25.384
+X-9.406Y25.769
+X-9.731Y26.149
+X-10.060Y26.525
+X-10.394Y26.898
+X-10.732Y27.266
+X-11.076Y27.629
+X-11.423Y27.989
+X-11.775Y28.344
+X-12.132Y28.694
+X-12.493Y29.040
+X-12.858Y29.382
+X-13.227Y29.719
+X-13.601Y30.051
+X-13.978Y30.379
+X-14.360Y30.702
+X-14.746Y31.020
+X-15.136Y31.333
+X-15.529Y31.641
+X-15.927Y31.945
+X-16.328Y32.243
+X-16.733Y32.537
+X-17.141Y32.825
+X-17.553Y33.108
+X-17.969Y33.386
+X-18.388Y33.659
+X-18.810Y33.926
+X-19.236Y34.189
+X-19.665Y34.445
+X-20.097Y34.697
+X-20.532Y34.943
+X-20.971Y35.184
+X-21.412Y35.419
+X-21.856Y35.648
+X-22.303Y35.872
+X-22.753Y36.091
+X-23.205Y36.303
+X-23.661Y36.511
+X-24.118Y36.712
+X-24.578Y36.908
+X-25.041Y37.097
+X-25.506Y37.282
+X-25.973Y37.460
+X-26.442Y37.632
+X-26.914Y37.799
+X-27.387Y37.959
+X-27.863Y38.114
+X-28.340Y38.263
+X-28.819Y38.406
+X-29.300Y38.542
+X-29.783Y38.673
+X-30.267Y38.798
+X-30.753Y38.916
+X-31.240Y39.029
+X-31.728Y39.135
+X-32.218Y39.236
+X-32.709Y39.330
+X-33.201Y39.418
+X-33.695Y39.500
+X-34.189Y39.576
+X-34.684Y39.645
+X-35.180Y39.709
+X-35.677Y39.766
+X-36.174Y39.817
+X-36.672Y39.861
+X-37.171Y39.900
+X-37.669Y39.932
+X-38.169Y39.958
+X-38.668Y39.978
+X-39.168Y39.991
+X-39.668Y39.999
+X-40.168Y40.000
+X-40.668Y39.994
+X-41.168Y39.983
+X-41.668Y39.965
+X-42.167Y39.941
+X-42.666Y39.911
+X-43.165Y39.875
+X-43.663Y39.832
+X-44.161Y39.783
+X-44.658Y39.728
+X-45.154Y39.667
+X-45.649Y39.599
+X-46.144Y39.525
+X-46.637Y39.445
+X-47.130Y39.359
+X-47.621Y39.267
+X-48.111Y39.169
+X-48.600Y39.064
+X-49.088Y38.954
+X-49.574Y38.837
+X-50.059Y38.715
+X-50.542Y38.586
+X-51.024Y38.451
+X-51.503Y38.310
+X-51.981Y38.163
+X-52.457Y38.011
+X-52.932Y37.852
+X-53.404Y37.687
+X-53.874Y37.517
+X-54.342Y37.341
+X-54.807Y37.158
+X-55.271Y36.970
+X-55.731Y36.777
+X-56.190Y36.577
+X-56.646Y36.372
+X-57.099Y36.161
+X-57.550Y35.944
+X-57.998Y35.722
+X-58.443Y35.494
+X-58.885Y35.261
+X-59.324Y35.022
+X-59.761Y34.778
+X-60.194Y34.528
+X-60.624Y34.273
+X-61.051Y34.013
+X-61.474Y33.747
+X-61.894Y33.476
+X-62.311Y33.200
+X-62.724Y32.918
+X-63.134Y32.632
+X-63.540Y32.340
+X-63.942Y32.043
+X-64.341Y31.741
+X-64.736Y31.435
+X-65.127Y31.123
+X-65.514Y30.806
+X-65.897Y30.485
+X-66.276Y30.159
+X-66.651Y29.828
+X-67.022Y29.493
+X-67.388Y29.153
+X-67.751Y28.808
+X-68.109Y28.459
+X-68.462Y28.105
+X-68.811Y27.747
+X-69.156Y27.385
+X-69.496Y27.019
+X-69.831Y26.648
+X-70.162Y26.273
+X-70.488Y25.894
+X-70.809Y25.511
+X-71.126Y25.123
+X-71.437Y24.732
+X-71.744Y24.338
+X-72.046Y23.939
+X-72.342Y23.536
+X-72.634Y23.130
+X-72.921Y22.721
+X-73.202Y22.307
+X-73.478Y21.891
+X-73.749Y21.470
+X-74.015Y21.047
+X-74.276Y20.620
+X-74.531Y20.190
+X-74.780Y19.757
+X-75.025Y19.321
+X-75.263Y18.881
+X-75.497Y18.439
+X-75.724Y17.994
+X-75.946Y17.546
+X-76.163Y17.095
+X-76.374Y16.642
+X-76.579Y16.186
+X-76.778Y15.727
+X-76.972Y15.266
+X-77.160Y14.803
+X-77.342Y14.337
+X-77.518Y13.870
+X-77.689Y13.400
+X-77.853Y12.927
+X-78.012Y12.453
+X-78.165Y11.977
+X-78.311Y11.499
+X-78.452Y11.019
+X-78.587Y10.538
+X-78.716Y10.055
+X-78.838Y9.570
+X-78.955Y9.084
+X-79.065Y8.596
+X-79.170Y8.107
+X-79.268Y7.617
+X-79.360Y7.125
+X-79.446Y6.633
+X-79.526Y6.139
+X-79.600Y5.645
+X-79.667Y5.149
+X-79.728Y4.653
+X-79.783Y4.156
+X-79.832Y3.659
+X-79.875Y3.160
+X-79.911Y2.662
+X-79.941Y2.163
+X-79.965Y1.663
+X-79.983Y1.164
+X-79.994Y0.664
+X-80.000Y0.164
+X-79.999Y-0.336
+X-79.991Y-0.836
+X-79.978Y-1.336
+X-79.958Y-1.836
+X-79.932Y-2.335
+X-79.899Y-2.834
+X-79.861Y-3.332
+X-79.816Y-3.830
+X-79.765Y-4.328
+X-79.708Y-4.825
+X-79.645Y-5.320
+X-79.575Y-5.816
+X-79.499Y-6.310
+X-79.417Y-6.803
+X-79.329Y-7.295
+X-79.235Y-7.786
+X-79.134Y-8.276
+X-79.028Y-8.765
+X-78.915Y-9.252
+X-78.797Y-9.737
+X-78.672Y-10.222
+X-78.541Y-10.704
+X-78.404Y-11.185
+X-78.262Y-11.664
+X-78.113Y-12.142
+X-77.958Y-12.617
+X-77.797Y-13.091
+X-77.631Y-13.562
+X-77.458Y-14.031
+X-77.280Y-14.498
+X-77.096Y-14.963
+X-76.906Y-15.426
+X-76.710Y-15.886
+X-76.509Y-16.344
+X-76.302Y-16.799
+X-76.089Y-17.251
+X-75.870Y-17.701
+X-75.646Y-18.148
+X-75.417Y-18.592
+X-75.181Y-19.033
+X-74.941Y-19.471
+X-74.695Y-19.907
+X-74.443Y-20.339
+X-74.186Y-20.768
+X-73.924Y-21.193
+X-73.656Y-21.616
+X-73.384Y-22.035
+X-73.106Y-22.450
+X-72.822Y-22.862
+X-72.534Y-23.271
+X-72.241Y-23.676
+X-71.942Y-24.077
+X-71.639Y-24.474
+X-71.330Y-24.868
+X-71.017Y-25.258
+X-70.699Y-25.643
+X-70.376Y-26.025
+X-70.048Y-26.403
+X-69.716Y-26.776
+X-69.379Y-27.146
+X-69.037Y-27.511
+X-68.691Y-27.871
+X-68.341Y-28.228
+X-67.985Y-28.580
+X-67.626Y-28.928
+X-67.262Y-29.271
+X-66.894Y-29.609
+X-66.522Y-29.943
+X-66.146Y-30.272
+X-65.765Y-30.597
+X-65.381Y-30.916
+X-64.992Y-31.231
+X-64.600Y-31.541
+X-64.204Y-31.846
+X-63.804Y-32.146
+X-63.400Y-32.441
+X-62.993Y-32.731
+X-62.582Y-33.016
+X-62.168Y-33.296
+X-61.750Y-33.570
+X-61.328Y-33.839
+X-60.904Y-34.103
+X-60.476Y-34.362
+X-60.045Y-34.615
+X-59.610Y-34.863
+X-59.173Y-35.105
+X-58.733Y-35.342
+X-58.290Y-35.574
+X-57.843Y-35.800
+X-57.395Y-36.020
+X-56.943Y-36.234
+X-56.489Y-36.443
+X-56.032Y-36.647
+X-55.573Y-36.844
+X-55.111Y-37.036
+X-54.647Y-37.222
+X-54.180Y-37.402
+X-53.712Y-37.576
+X-53.241Y-37.745
+X-52.768Y-37.907
+X-52.293Y-38.064
+X-51.817Y-38.215
+X-51.338Y-38.359
+X-50.858Y-38.498
+X-50.376Y-38.631
+X-49.892Y-38.758
+X-49.407Y-38.878
+X-48.920Y-38.993
+X-48.432Y-39.101
+X-47.942Y-39.204
+X-47.452Y-39.300
+X-46.960Y-39.390
+X-46.467Y-39.474
+X-45.973Y-39.552
+X-45.478Y-39.623
+X-44.983Y-39.688
+X-44.486Y-39.748
+X-43.989Y-39.801
+X-43.491Y-39.847
+X-42.993Y-39.888
+X-42.494Y-39.922
+X-41.995Y-39.950
+X-41.495Y-39.972
+X-40.995Y-39.988
+X-40.496Y-39.997
+X-39.996Y-40.000
+X-39.496Y-39.997
+X-38.996Y-39.987
+X-38.496Y-39.972
+X-37.996Y-39.950
+X-37.497Y-39.922
+X-36.998Y-39.887
+X-36.500Y-39.847
+X-36.002Y-39.800
+X-35.505Y-39.747
+X-35.009Y-39.687
+X-34.513Y-39.622
+X-34.018Y-39.550
+X-33.524Y-39.472
+X-33.031Y-39.388
+X-32.540Y-39.298
+X-32.049Y-39.202
+X-31.559Y-39.099
+X-31.071Y-38.991
+X-30.585Y-38.876
+X-30.100Y-38.755
+X-29.616Y-38.629
+X-29.134Y-38.496
+X-28.654Y-38.357
+X-28.175Y-38.212
+X-27.698Y-38.061
+X-27.223Y-37.905
+X-26.751Y-37.742
+X-26.280Y-37.573
+X-25.811Y-37.399
+X-25.345Y-37.219
+X-24.881Y-37.033
+X-24.419Y-36.841
+X-23.960Y-36.643
+X-23.503Y-36.440
+X-23.049Y-36.231
+X-22.597Y-36.016
+X-22.149Y-35.796
+X-21.703Y-35.570
+X-21.259Y-35.338
+X-20.819Y-35.101
+X-20.382Y-34.859
+X-19.948Y-34.611
+X-19.517Y-34.357
+X-19.089Y-34.099
+X-18.664Y-33.835
+X-18.243Y-33.565
+X-17.825Y-33.291
+X-17.411Y-33.011
+X-17.000Y-32.726
+X-16.593Y-32.436
+X-16.189Y-32.141
+X-15.789Y-31.841
+X-15.393Y-31.536
+X-15.001Y-31.226
+X-14.612Y-30.911
+X-14.228Y-30.591
+X-13.848Y-30.266
+X-13.471Y-29.937
+X-13.099Y-29.603
+X-12.731Y-29.265
+X-12.368Y-28.921
+X-12.008Y-28.574
+X-11.653Y-28.222
+X-11.303Y-27.865
+X-10.957Y-27.504
+X-10.615Y-27.139
+X-10.278Y-26.770
+X-9.946Y-26.396
+X-9.618Y-26.018
+X-9.295Y-25.636
+X-8.977Y-25.251
+X-8.664Y-24.861
+X-8.356Y-24.467
+X-8.052Y-24.070
+X-7.754Y-23.669
+X-7.461Y-23.264
+X-7.173Y-22.855
+X-6.889Y-22.443
+X-6.611Y-22.027
+X-6.339Y-21.608
+X-6.071Y-21.186
+X-5.809Y-20.760
+X-5.552Y-20.331
+X-5.301Y-19.899
+X-5.055Y-19.464
+X-4.814Y-19.025
+X-4.579Y-18.584
+X-4.350Y-18.140
+X-4.126Y-17.693
+X-3.907Y-17.243
+X-3.695Y-16.791
+X-3.488Y-16.335
+X-3.286Y-15.878
+X-3.091Y-15.418
+X-2.901Y-14.955
+X-2.717Y-14.490
+X-2.539Y-14.023
+X-2.366Y-13.554
+X-2.200Y-13.082
+X-2.039Y-12.609
+X-1.885Y-12.133
+X-1.736Y-11.656
+X-1.593Y-11.177
+X-1.456Y-10.696
+X-1.326Y-10.213
+X-1.201Y-9.729
+X-1.083Y-9.243
+X-0.970Y-8.756
+X-0.864Y-8.267
+X-0.763Y-7.778
+X-0.669Y-7.287
+X-0.581Y-6.794
+X-0.499Y-6.301
+X-0.424Y-5.807
+X-0.354Y-5.312
+X-0.291Y-4.816
+X-0.234Y-4.319
+X-0.183Y-3.822
+X-0.138Y-3.324
+X-0.100Y-2.825
+X-0.068Y-2.326
+X-0.042Y-1.827
+X-0.022Y-1.327
+X-0.009Y-0.827
+X-0.001Y-0.327
+X-0.000Y0.173
+X-0.006Y0.673
+X-0.017Y1.172
+X-0.035Y1.672
+X-0.059Y2.172
+X-0.089Y2.671
+X-0.126Y3.169
+X-0.168Y3.667
+X-0.217Y4.165
+X-0.273Y4.662
+X-0.334Y5.158
+X-0.402Y5.654
+X-0.475Y6.148
+X-0.555Y6.642
+X-0.641Y7.134
+X-0.734Y7.626
+X-0.832Y8.116
+X-0.936Y8.605
+X-1.047Y9.092
+X-1.164Y9.579
+X-1.287Y10.063
+X-1.415Y10.546
+X-1.550Y11.028
+X-1.691Y11.508
+X-1.838Y11.986
+X-1.991Y12.462
+X-2.149Y12.936
+X-2.314Y13.408
+X-2.485Y13.878
+X-2.661Y14.346
+X-2.843Y14.811
+X-3.031Y15.275
+X-3.225Y15.736
+X-3.425Y16.194
+X-3.630Y16.650
+X-3.841Y17.103
+X-4.058Y17.554
+X-4.280Y18.002
+X-4.508Y18.447
+X-4.741Y18.889
+X-4.980Y19.328
+X-5.224Y19.765
+X-5.474Y20.198
+X-5.729Y20.628
+X-5.990Y21.054
+X-6.255Y21.478
+X-6.526Y21.898
+X-6.803Y22.315
+X-7.084Y22.728
+X-7.371Y23.138
+X-7.663Y23.544
+X-7.960Y23.946
+X-8.261Y24.345
+X-8.568Y24.739
+X-8.880Y25.130
+X-9.196Y25.517
+X-9.518Y25.900
+X-9.844Y26.279
+X-10.175Y26.654
+X-10.510Y27.025
+X-10.850Y27.392
+X-11.195Y27.754
+X-11.544Y28.112
+X-11.898Y28.465
+X-12.256Y28.814
+X-12.618Y29.159
+X-12.985Y29.499
+X-13.356Y29.834
+X-13.731Y30.165
+X-14.110Y30.491
+X-14.493Y30.812
+X-14.880Y31.129
+X-15.271Y31.440
+X-15.666Y31.747
+X-16.065Y32.048
+X-16.467Y32.345
+X-16.873Y32.637
+X-17.283Y32.923
+X-17.696Y33.205
+X-18.113Y33.481
+X-18.533Y33.752
+X-18.957Y34.017
+X-19.384Y34.278
+X-19.814Y34.533
+X-20.247Y34.782
+X-20.683Y35.027
+X-21.123Y35.265
+X-21.565Y35.499
+X-22.010Y35.726
+X-22.458Y35.948
+X-22.909Y36.165
+X-23.362Y36.376
+X-23.818Y36.581
+X-24.277Y36.780
+X-24.738Y36.974
+X-25.201Y37.162
+X-25.667Y37.344
+X-26.135Y37.520
+X-26.605Y37.690
+X-27.077Y37.855
+X-27.551Y38.013
+X-28.027Y38.166
+X-28.505Y38.313
+X-28.985Y38.453
+X-29.466Y38.588
+X-29.950Y38.717
+X-30.434Y38.839
+X-30.921Y38.956
+X-31.408Y39.066
+X-31.897Y39.171
+X-32.387Y39.269
+X-32.879Y39.361
+X-33.371Y39.447
+X-33.865Y39.527
+X-34.360Y39.600
+X-34.855Y39.668
+X-35.351Y39.729
+X-35.848Y39.784
+X-36.346Y39.833
+X-36.844Y39.875
+X-37.343Y39.912
+X-37.842Y39.942
+X-38.341Y39.966
+X-38.841Y39.983
+X-39.341Y39.995
+X-39.841Y40.000
+X-40.341Y39.999
+X-40.841Y39.991
+X-41.340Y39.978
+X-41.840Y39.958
+X-42.339Y39.932
+X-42.838Y39.899
+X-43.337Y39.861
+X-43.835Y39.816
+X-44.332Y39.765
+X-44.829Y39.707
+X-45.325Y39.644
+X-45.820Y39.574
+X-46.314Y39.498
+X-46.807Y39.416
+X-47.300Y39.328
+X-47.791Y39.234
+X-48.280Y39.134
+X-48.769Y39.027
+X-49.256Y38.914
+X-49.742Y38.796
+X-50.226Y38.671
+X-50.709Y38.540
+X-51.189Y38.403
+X-51.669Y38.260
+X-52.146Y38.111
+X-52.621Y37.957
+X-53.095Y37.796
+X-53.566Y37.629
+X-54.035Y37.457
+X-54.503Y37.278
+X-54.967Y37.094
+X-55.430Y36.904
+X-55.890Y36.708
+X-56.348Y36.507
+X-56.803Y36.300
+X-57.255Y36.087
+X-57.705Y35.868
+X-58.152Y35.644
+X-58.596Y35.415
+X-59.037Y35.179
+X-59.475Y34.939
+X-59.911Y34.693
+X-60.343Y34.441
+X-60.772Y34.184
+X-61.197Y33.922
+X-61.620Y33.654
+X-62.039Y33.381
+X-62.454Y33.103
+X-62.866Y32.820
+X-63.275Y32.531
+X-63.679Y32.238
+X-64.080Y31.939
+X-64.478Y31.636
+X-64.871Y31.328
+X-65.261Y31.014
+X-65.647Y30.696
+X-66.028Y30.373
+X-66.406Y30.045
+X-66.779Y29.713
+X-67.149Y29.376
+X-67.514Y29.034
+X-67.875Y28.688
+X-68.231Y28.337
+X-68.583Y27.982
+X-68.931Y27.623
+X-69.274Y27.259
+X-69.612Y26.891
+X-69.946Y26.519
+X-70.275Y26.142
+X-70.599Y25.762
+X-70.919Y25.377
+X-71.234Y24.989
+X-71.544Y24.597
+X-71.849Y24.200
+X-72.149Y23.800
+X-72.444Y23.397
+X-72.734Y22.989
+X-73.018Y22.578
+X-73.298Y22.164
+X-73.573Y21.746
+X-73.842Y21.325
+X-74.106Y20.900
+X-74.364Y20.472
+X-74.617Y20.041
+X-74.865Y19.607
+X-75.108Y19.169
+X-75.344Y18.729
+X-75.576Y18.286
+X-75.802Y17.840
+X-76.022Y17.391
+X-76.236Y16.939
+X-76.445Y16.485
+X-76.648Y16.028
+X-76.846Y15.569
+X-77.038Y15.107
+X-77.224Y14.643
+X-77.404Y14.176
+X-77.578Y13.708
+X-77.746Y13.237
+X-77.909Y12.764
+X-78.065Y12.289
+X-78.216Y11.812
+X-78.361Y11.334
+X-78.499Y10.853
+X-78.632Y10.371
+X-78.759Y9.888
+X-78.879Y9.402
+X-78.994Y8.916
+X-79.102Y8.427
+X-79.204Y7.938
+X-79.301Y7.447
+X-79.391Y6.956
+X-79.474Y6.463
+X-79.552Y5.969
+X-79.624Y5.474
+X-79.689Y4.978
+X-79.748Y4.482
+X-79.801Y3.984
+X-79.848Y3.487
+X-79.888Y2.988
+X-79.922Y2.490
+X-79.950Y1.990
+X-79.972Y1.491
+X-79.988Y0.991
+X-79.997Y0.491
+X-80.000Y-0.009
+X-79.997Y-0.509
+X-79.987Y-1.009
+X-79.972Y-1.509
+X-79.950Y-2.008
+X-79.921Y-2.507
+X-79.887Y-3.006
+X-79.846Y-3.504
+X-79.799Y-4.002
+X-79.746Y-4.499
+X-79.687Y-4.996
+X-79.621Y-5.491
+X-79.550Y-5.986
+X-79.472Y-6.480
+X-79.388Y-6.973
+X-79.297Y-7.465
+X-79.201Y-7.955
+X-79.098Y-8.445
+X-78.990Y-8.933
+X-78.875Y-9.420
+X-78.754Y-9.905
+X-78.627Y-10.388
+X-78.495Y-10.870
+X-78.356Y-11.351
+X-78.211Y-11.829
+X-78.060Y-12.306
+X-77.903Y-12.781
+X-77.740Y-13.254
+X-77.572Y-13.724
+X-77.397Y-14.193
+X-77.217Y-14.659
+X-77.031Y-15.123
+X-76.839Y-15.585
+X-76.641Y-16.044
+X-76.438Y-16.501
+X-76.229Y-16.955
+X-76.014Y-17.407
+X-75.794Y-17.855
+X-75.568Y-18.301
+X-75.336Y-18.745
+X-75.099Y-19.185
+X-74.856Y-19.622
+X-74.609Y-20.056
+X-74.355Y-20.487
+X-74.096Y-20.915
+X-73.832Y-21.340
+X-73.563Y-21.761
+X-73.288Y-22.179
+X-73.008Y-22.593
+X-72.723Y-23.004
+X-72.433Y-23.411
+X-72.138Y-23.815
+X-71.838Y-24.215
+X-71.533Y-24.611
+X-71.223Y-25.003
+X-70.908Y-25.391
+X-70.588Y-25.775
+X-70.263Y-26.156
+X-69.934Y-26.532
+X-69.600Y-26.904
+X-69.262Y-27.272
+X-68.918Y-27.636
+X-68.571Y-27.995
+X-68.218Y-28.350
+X-67.862Y-28.700
+X-67.501Y-29.046
+X-67.136Y-29.388
+X-66.766Y-29.725
+X-66.393Y-30.057
+X-66.015Y-30.385
+X-65.633Y-30.707
+X-65.247Y-31.025
+X-64.857Y-31.339
+X-64.464Y-31.647
+X-64.066Y-31.950
+X-63.665Y-32.248
+X-63.260Y-32.542
+X-62.852Y-32.830
+X-62.439Y-33.113
+X-62.024Y-33.391
+X-61.605Y-33.664
+X-61.182Y-33.931
+X-60.756Y-34.193
+X-60.327Y-34.450
+X-59.895Y-34.701
+X-59.460Y-34.947
+X-59.021Y-35.188
+X-58.580Y-35.423
+X-58.136Y-35.652
+X-57.689Y-35.876
+X-57.239Y-36.095
+X-56.787Y-36.307
+X-56.331Y-36.514
+X-55.874Y-36.715
+X-55.414Y-36.911
+X-54.951Y-37.101
+X-54.486Y-37.285
+X-54.019Y-37.463
+X-53.549Y-37.635
+X-53.078Y-37.802
+X-52.604Y-37.962
+X-52.129Y-38.117
+X-51.652Y-38.265
+X-51.172Y-38.408
+X-50.691Y-38.545
+X-50.209Y-38.675
+X-49.725Y-38.800
+X-49.239Y-38.918
+X-48.752Y-39.031
+X-48.263Y-39.137
+X-47.773Y-39.237
+X-47.282Y-39.332
+X-46.790Y-39.419
+X-46.297Y-39.501
+X-45.802Y-39.577
+X-45.307Y-39.646
+X-44.811Y-39.710
+X-44.315Y-39.767
+X-43.817Y-39.817
+X-43.319Y-39.862
+X-42.821Y-39.900
+X-42.322Y-39.933
+X-41.822Y-39.958
+X-41.323Y-39.978
+X-40.823Y-39.992
+X-40.323Y-39.999
+X-39.823Y-40.000
+X-39.323Y-39.994
+X-38.823Y-39.983
+X-38.323Y-39.965
+X-37.824Y-39.941
+X-37.325Y-39.910
+X-36.826Y-39.874
+X-36.328Y-39.831
+X-35.831Y-39.782
+X-35.334Y-39.727
+X-34.837Y-39.665
+X-34.342Y-39.598
+X-33.847Y-39.524
+X-33.354Y-39.444
+X-32.861Y-39.358
+X-32.370Y-39.266
+X-31.880Y-39.167
+X-31.391Y-39.063
+X-30.903Y-38.952
+X-30.417Y-38.835
+X-29.932Y-38.712
+X-29.449Y-38.583
+X-28.968Y-38.449
+X-28.488Y-38.308
+X-28.010Y-38.161
+X-27.534Y-38.008
+X-27.060Y-37.849
+X-26.588Y-37.684
+X-26.118Y-37.514
+X-25.650Y-37.337
+X-25.185Y-37.155
+X-24.721Y-36.967
+X-24.260Y-36.773
+X-23.802Y-36.574
+X-23.346Y-36.368
+X-22.893Y-36.157
+X-22.442Y-35.941
+X-21.994Y-35.718
+X-21.549Y-35.490
+X-21.107Y-35.257
+X-20.668Y-35.018
+X-20.232Y-34.774
+X-19.798Y-34.524
+X-19.369Y-34.269
+X-18.942Y-34.008
+X-18.518Y-33.742
+X-18.098Y-33.471
+X-17.682Y-33.195
+X-17.268Y-32.913
+X-16.859Y-32.626
+X-16.453Y-32.335
+X-16.050Y-32.038
+X-15.652Y-31.736
+X-15.257Y-31.429
+X-14.866Y-31.117
+X-14.479Y-30.801
+X-14.096Y-30.479
+X-13.717Y-30.153
+X-13.342Y-29.822
+X-12.972Y-29.487
+X-12.605Y-29.147
+X-12.243Y-28.802
+X-11.885Y-28.453
+X-11.532Y-28.099
+X-11.183Y-27.741
+X-10.838Y-27.379
+X-10.498Y-27.012
+X-10.163Y-26.641
+X-9.832Y-26.266
+X-9.506Y-25.887
+X-9.185Y-25.504
+X-8.869Y-25.117
+X-8.557Y-24.725
+X-8.251Y-24.331
+X-7.949Y-23.932
+X-7.652Y-23.529
+X-7.361Y-23.123
+X-7.074Y-22.713
+X-6.793Y-22.300
+X-6.517Y-21.883
+X-6.246Y-21.463
+X-5.980Y-21.039
+X-5.720Y-20.612
+X-5.465Y-20.182
+X-5.215Y-19.749
+X-4.971Y-19.313
+X-4.733Y-18.873
+X-4.499Y-18.431
+X-4.272Y-17.986
+X-4.050Y-17.538
+X-3.833Y-17.087
+X-3.623Y-16.634
+X-3.417Y-16.178
+X-3.218Y-15.719
+X-3.025Y-15.258
+X-2.837Y-14.795
+X-2.655Y-14.329
+X-2.478Y-13.861
+X-2.308Y-13.391
+X-2.144Y-12.919
+X-1.985Y-12.445
+X-1.833Y-11.969
+X-1.686Y-11.491
+X-1.545Y-11.011
+X-1.411Y-10.529
+X-1.282Y-10.046
+X-1.160Y-9.561
+X-1.043Y-9.075
+X-0.933Y-8.587
+X-0.828Y-8.098
+X-0.730Y-7.608
+X-0.638Y-7.117
+X-0.552Y-6.624
+X-0.473Y-6.131
+X-0.399Y-5.636
+X-0.332Y-5.141
+X-0.271Y-4.644
+X-0.216Y-4.147
+X-0.167Y-3.650
+X-0.124Y-3.152
+X-0.088Y-2.653
+X-0.058Y-2.154
+X-0.034Y-1.654
+X-0.017Y-1.155
+X-0.005Y-0.655
+X-0.000Y-0.155
+X-0.001Y0.345
+X-0.009Y0.845
+X-0.023Y1.345
+X-0.043Y1.845
+X-0.069Y2.344
+X-0.101Y2.843
+X-0.140Y3.341
+X-0.185Y3.839
+X-0.236Y4.337
+X-0.293Y4.833
+X-0.357Y5.329
+X-0.426Y5.824
+X-0.502Y6.319
+X-0.584Y6.812
+X-0.673Y7.304
+X-0.767Y7.795
+X-0.867Y8.285
+X-0.974Y8.773
+X-1.087Y9.260
+X-1.205Y9.746
+X-1.330Y10.230
+X-1.461Y10.713
+X-1.598Y11.194
+X-1.741Y11.673
+X-1.890Y12.150
+X-2.045Y12.626
+X-2.206Y13.099
+X-2.372Y13.570
+X-2.545Y14.040
+X-2.723Y14.507
+X-2.908Y14.972
+X-3.098Y15.434
+X-3.293Y15.894
+X-3.495Y16.352
+X-3.702Y16.807
+X-3.915Y17.259
+X-4.134Y17.709
+X-4.358Y18.156
+X-4.587Y18.600
+X-4.823Y19.041
+X-5.063Y19.479
+X-5.310Y19.914
+X-5.561Y20.346
+X-5.818Y20.775
+X-6.081Y21.201
+X-6.348Y21.623
+X-6.621Y22.042
+X-6.899Y22.458
+X-7.183Y22.870
+X-7.471Y23.278
+X-7.765Y23.683
+X-8.063Y24.084
+X-8.367Y24.481
+X-8.675Y24.875
+X-8.989Y25.264
+X-9.307Y25.650
+X-9.630Y26.032
+X-9.958Y26.409
+X-10.290Y26.783
+X-10.627Y27.152
+X-10.969Y27.517
+X-11.315Y27.878
+X-11.666Y28.234
+X-12.021Y28.586
+X-12.380Y28.934
+X-12.744Y29.277
+X-13.112Y29.615
+X-13.485Y29.949
+X-13.861Y30.278
+X-14.241Y30.602
+X-14.626Y30.922
+X-15.015Y31.237
+X-15.407Y31.546
+X-15.803Y31.851
+X-16.203Y32.151
+X-16.607Y32.446
+X-17.014Y32.736
+X-17.425Y33.021
+X-17.840Y33.301
+X-18.258Y33.575
+X-18.679Y33.844
+X-19.104Y34.108
+X-19.532Y34.366
+X-19.963Y34.620
+X-20.397Y34.867
+X-20.835Y35.110
+X-21.275Y35.347
+X-21.718Y35.578
+X-22.164Y35.804
+X-22.613Y36.024
+X-23.065Y36.238
+X-23.519Y36.447
+X-23.976Y36.650
+X-24.436Y36.848
+X-24.897Y37.039
+X-25.361Y37.225
+X-25.828Y37.405
+X-26.297Y37.579
+X-26.767Y37.748
+X-27.240Y37.910
+X-27.715Y38.067
+X-28.192Y38.217
+X-28.671Y38.362
+X-29.151Y38.501
+X-29.633Y38.633
+X-30.117Y38.760
+X-30.602Y38.880
+X-31.089Y38.995
+X-31.577Y39.103
+X-32.066Y39.205
+X-32.557Y39.301
+X-33.049Y39.391
+X-33.542Y39.475
+X-34.036Y39.553
+X-34.531Y39.624
+X-35.026Y39.690
+X-35.523Y39.749
+X-36.020Y39.801
+X-36.518Y39.848
+X-37.016Y39.889
+X-37.515Y39.923
+X-38.014Y39.951
+X-38.514Y39.972
+X-39.013Y39.988
+X-39.513Y39.997
+X-40.013Y40.000
+X-40.513Y39.997
+X-41.013Y39.987
+X-41.513Y39.971
+X-42.012Y39.949
+X-42.512Y39.921
+X-43.010Y39.887
+X-43.509Y39.846
+X-44.007Y39.799
+X-44.504Y39.746
+X-45.000Y39.686
+X-45.496Y39.621
+X-45.991Y39.549
+X-46.485Y39.471
+X-46.977Y39.387
+X-47.469Y39.296
+X-47.960Y39.200
+X-48.449Y39.097
+X-48.937Y38.989
+X-49.424Y38.874
+X-49.909Y38.753
+X-50.393Y38.626
+X-50.875Y38.493
+X-51.355Y38.354
+X-51.834Y38.210
+X-52.310Y38.059
+X-52.785Y37.902
+X-53.258Y37.739
+X-53.728Y37.570
+X-54.197Y37.396
+X-54.663Y37.215
+X-55.127Y37.029
+X-55.589Y36.837
+X-56.048Y36.640
+X-56.505Y36.436
+X-56.959Y36.227
+X-57.411Y36.012
+X-57.859Y35.792
+X-58.305Y35.566
+X-58.749Y35.334
+X-59.189Y35.097
+X-59.626Y34.854
+X-60.060Y34.606
+X-60.491Y34.353
+X-60.919Y34.094
+X-61.343Y33.830
+X-61.765Y33.560
+X-62.182Y33.286
+X-62.597Y33.006
+X-63.007Y32.721
+X-63.415Y32.431
+X-63.818Y32.136
+X-64.218Y31.835
+X-64.614Y31.530
+X-65.006Y31.220
+X-65.395Y30.905
+X-65.779Y30.585
+X-66.159Y30.260
+X-66.535Y29.931
+X-66.907Y29.597
+X-67.275Y29.258
+X-67.639Y28.915
+X-67.998Y28.568
+X-68.353Y28.215
+X-68.704Y27.859
+X-69.050Y27.498
+X-69.391Y27.132
+X-69.728Y26.763
+X-70.060Y26.389
+X-70.388Y26.012
+X-70.710Y25.630
+X-71.028Y25.244
+X-71.341Y24.854
+X-71.650Y24.460
+X-71.953Y24.063
+X-72.251Y23.661
+X-72.544Y23.256
+X-72.833Y22.848
+X-73.116Y22.436
+X-73.393Y22.020
+X-73.666Y21.601
+X-73.933Y21.178
+X-74.195Y20.753
+X-74.452Y20.324
+X-74.704Y19.891
+X-74.949Y19.456
+X-75.190Y19.018
+X-75.425Y18.576
+X-75.654Y18.132
+X-75.878Y17.685
+X-76.096Y17.235
+X-76.309Y16.782
+X-76.516Y16.327
+X-76.717Y15.870
+X-76.913Y15.409
+X-77.102Y14.947
+X-77.286Y14.482
+X-77.464Y14.015
+X-77.637Y13.545
+X-77.803Y13.074
+X-77.964Y12.600
+X-78.118Y12.125
+X-78.267Y11.647
+X-78.409Y11.168
+X-78.546Y10.687
+X-78.676Y10.204
+X-78.801Y9.720
+X-78.919Y9.234
+X-79.032Y8.747
+X-79.138Y8.259
+X-79.238Y7.769
+X-79.332Y7.278
+X-79.420Y6.786
+X-79.502Y6.292
+X-79.578Y5.798
+X-79.647Y5.303
+X-79.710Y4.807
+X-79.767Y4.310
+X-79.818Y3.813
+X-79.862Y3.315
+X-79.901Y2.816
+X-79.933Y2.317
+X-79.959Y1.818
+X-79.978Y1.318
+X-79.992Y0.818
+X-79.999Y0.319
+X-80.000Y-0.181
+X-79.994Y-0.681
+X-79.983Y-1.181
+X-79.965Y-1.681
+X-79.941Y-2.180
+X-79.910Y-2.679
+X-79.874Y-3.178
+X-79.831Y-3.676
+X-79.782Y-4.174
+X-79.726Y-4.671
+X-79.665Y-5.167
+X-79.597Y-5.662
+X-79.523Y-6.157
+X-79.443Y-6.650
+X-79.357Y-7.143
+X-79.265Y-7.634
+X-79.166Y-8.125
+X-79.062Y-8.613
+X-78.951Y-9.101
+X-78.834Y-9.587
+X-78.711Y-10.072
+X-78.582Y-10.555
+X-78.447Y-11.036
+X-78.306Y-11.516
+X-78.159Y-11.994
+X-78.007Y-12.470
+X-77.848Y-12.944
+X-77.683Y-13.416
+X-77.512Y-13.886
+X-77.336Y-14.354
+X-77.153Y-14.820
+X-76.965Y-15.283
+X-76.771Y-15.744
+X-76.572Y-16.202
+X-76.366Y-16.658
+X-76.155Y-17.111
+X-75.939Y-17.562
+X-75.716Y-18.010
+X-75.488Y-18.455
+X-75.255Y-18.897
+X-75.016Y-19.336
+X-74.772Y-19.772
+X-74.522Y-20.205
+X-74.266Y-20.635
+X-74.006Y-21.062
+X-73.740Y-21.485
+X-73.469Y-21.905
+X-73.192Y-22.322
+X-72.911Y-22.735
+X-72.624Y-23.145
+X-72.332Y-23.551
+X-72.035Y-23.953
+X-71.733Y-24.352
+X-71.426Y-24.746
+X-71.115Y-25.137
+X-70.798Y-25.524
+X-70.476Y-25.907
+X-70.150Y-26.286
+X-69.819Y-26.661
+X-69.484Y-27.032
+X-69.144Y-27.398
+X-68.799Y-27.760
+X-68.450Y-28.118
+X-68.096Y-28.471
+X-67.738Y-28.820
+X-67.375Y-29.165
+X-67.009Y-29.505
+X-66.638Y-29.840
+X-66.263Y-30.171
+X-65.884Y-30.497
+X-65.500Y-30.818
+X-65.113Y-31.134
+X-64.722Y-31.446
+X-64.327Y-31.752
+X-63.928Y-32.054
+X-63.526Y-32.350
+X-63.119Y-32.642
+X-62.710Y-32.928
+X-62.296Y-33.210
+X-61.879Y-33.486
+X-61.459Y-33.757
+X-61.036Y-34.022
+X-60.609Y-34.282
+X-60.179Y-34.537
+X-59.745Y-34.787
+X-59.309Y-35.031
+X-58.869Y-35.270
+X-58.427Y-35.503
+X-57.982Y-35.730
+X-57.534Y-35.952
+X-57.083Y-36.169
+X-56.630Y-36.379
+X-56.174Y-36.584
+X-55.715Y-36.784
+X-55.254Y-36.977
+X-54.791Y-37.165
+X-54.325Y-37.347
+X-53.857Y-37.523
+X-53.387Y-37.693
+X-52.915Y-37.858
+X-52.441Y-38.016
+X-51.964Y-38.169
+X-51.486Y-38.315
+X-51.007Y-38.456
+X-50.525Y-38.590
+X-50.042Y-38.719
+X-49.557Y-38.842
+X-49.071Y-38.958
+X-48.583Y-39.068
+X-48.094Y-39.173
+X-47.604Y-39.271
+X-47.112Y-39.363
+X-46.620Y-39.448
+X-46.126Y-39.528
+X-45.632Y-39.602
+X-45.136Y-39.669
+X-44.640Y-39.730
+X-44.143Y-39.785
+X-43.645Y-39.834
+X-43.147Y-39.876
+X-42.648Y-39.912
+X-42.149Y-39.942
+X-41.650Y-39.966
+X-41.150Y-39.983
+X-40.650Y-39.995
+X-40.150Y-40.000
+X-39.650Y-39.998
+X-39.150Y-39.991
+X-38.651Y-39.977
+X-38.151Y-39.957
+X-37.652Y-39.931
+X-37.153Y-39.899
+X-36.654Y-39.860
+X-36.156Y-39.815
+X-35.659Y-39.764
+X-35.162Y-39.706
+X-34.666Y-39.643
+X-34.171Y-39.573
+X-33.677Y-39.497
+X-33.184Y-39.415
+X-32.692Y-39.327
+X-32.201Y-39.232
+X-31.711Y-39.132
+X-31.222Y-39.025
+X-30.735Y-38.912
+X-30.250Y-38.793
+X-29.765Y-38.669
+X-29.283Y-38.538
+X-28.802Y-38.401
+X-28.323Y-38.258
+X-27.846Y-38.109
+X-27.370Y-37.954
+X-26.897Y-37.793
+X-26.425Y-37.626
+X-25.956Y-37.454
+X-25.489Y-37.275
+X-25.024Y-37.091
+X-24.562Y-36.901
+X-24.102Y-36.705
+X-23.644Y-36.503
+X-23.189Y-36.296
+X-22.737Y-36.083
+X-22.287Y-35.864
+X-21.840Y-35.640
+X-21.396Y-35.410
+X-20.955Y-35.175
+X-20.517Y-34.934
+X-20.082Y-34.688
+X-19.650Y-34.436
+X-19.221Y-34.179
+X-18.795Y-33.917
+X-18.373Y-33.649
+X-17.954Y-33.376
+X-17.539Y-33.098
+X-17.127Y-32.815
+X-16.718Y-32.526
+X-16.313Y-32.233
+X-15.912Y-31.934
+X-15.515Y-31.631
+X-15.122Y-31.322
+X-14.732Y-31.009
+X-14.346Y-30.690
+X-13.965Y-30.367
+X-13.587Y-30.039
+X-13.214Y-29.707
+X-12.845Y-29.370
+X-12.480Y-29.028
+X-12.119Y-28.682
+X-11.763Y-28.331
+X-11.411Y-27.976
+X-11.063Y-27.616
+X-10.720Y-27.253
+X-10.382Y-26.884
+X-10.048Y-26.512
+X-9.719Y-26.136
+X-9.395Y-25.755
+X-9.075Y-25.371
+X-8.761Y-24.982
+X-8.451Y-24.590
+X-8.146Y-24.193
+X-7.846Y-23.793
+X-7.551Y-23.389
+X-7.261Y-22.982
+X-6.977Y-22.571
+X-6.697Y-22.156
+X-6.423Y-21.738
+X-6.154Y-21.317
+X-5.890Y-20.892
+X-5.631Y-20.464
+X-5.378Y-20.033
+X-5.130Y-19.599
+X-4.888Y-19.161
+X-4.651Y-18.721
+X-4.420Y-18.278
+X-4.194Y-17.832
+X-3.974Y-17.383
+X-3.760Y-16.931
+X-3.551Y-16.477
+X-3.348Y-16.020
+X-3.151Y-15.560
+X-2.959Y-15.099
+X-2.773Y-14.634
+X-2.593Y-14.168
+X-2.419Y-13.699
+X-2.251Y-13.228
+X-2.088Y-12.756
+X-1.932Y-12.281
+X-1.781Y-11.804
+X-1.637Y-11.325
+X-1.498Y-10.845
+X-1.366Y-10.363
+X-1.239Y-9.879
+X-1.119Y-9.394
+X-1.004Y-8.907
+X-0.896Y-8.419
+X-0.794Y-7.929
+X-0.698Y-7.439
+X-0.608Y-6.947
+X-0.524Y-6.454
+X-0.447Y-5.960
+X-0.375Y-5.465
+X-0.310Y-4.969
+X-0.251Y-4.473
+X-0.198Y-3.976
+X-0.151Y-3.478
+X-0.111Y-2.979
+X-0.077Y-2.481
+X-0.049Y-1.981
+X-0.027Y-1.482
+X-0.012Y-0.982
+X-0.003Y-0.482
+X-0.000Y0.018
+X-0.003Y0.518
+X-0.013Y1.018
+X-0.029Y1.517
+X-0.051Y2.017
+X-0.079Y2.516
+X-0.114Y3.015
+X-0.155Y3.513
+X-0.202Y4.011
+X-0.255Y4.508
+X-0.314Y5.005
+X-0.380Y5.500
+X-0.452Y5.995
+X-0.530Y6.489
+X-0.614Y6.982
+X-0.704Y7.474
+X-0.801Y7.964
+X-0.903Y8.454
+X-1.012Y8.942
+X-1.127Y9.428
+X-1.248Y9.913
+X-1.375Y10.397
+X-1.508Y10.879
+X-1.647Y11.359
+X-1.792Y11.838
+X-1.943Y12.314
+X-2.100Y12.789
+X-2.262Y13.262
+X-2.431Y13.733
+X-2.606Y14.201
+X-2.786Y14.667
+X-2.972Y15.131
+X-3.164Y15.593
+X-3.362Y16.052
+X-3.566Y16.509
+X-3.775Y16.963
+X-3.990Y17.415
+X-4.210Y17.863
+X-4.436Y18.309
+X-4.668Y18.752
+X-4.905Y19.193
+X-5.148Y19.630
+X-5.396Y20.064
+X-5.649Y20.495
+X-5.908Y20.923
+X-6.172Y21.347
+X-6.442Y21.768
+X-6.717Y22.186
+X-6.997Y22.600
+X-7.282Y23.011
+X-7.572Y23.418
+X-7.867Y23.822
+X-8.167Y24.222
+X-8.473Y24.618
+X-8.783Y25.010
+X-9.098Y25.398
+X-9.418Y25.782
+X-9.742Y26.163
+X-10.072Y26.539
+X-10.406Y26.911
+X-10.745Y27.279
+X-11.088Y27.642
+X-11.436Y28.001
+X-11.788Y28.356
+X-12.144Y28.707
+X-12.505Y29.053
+X-12.871Y29.394
+X-13.240Y29.731
+X-13.614Y30.063
+X-13.992Y30.390
+X-14.374Y30.713
+X-14.760Y31.031
+X-15.150Y31.344
+X-15.543Y31.652
+X-15.941Y31.956
+X-16.342Y32.254
+X-16.747Y32.547
+X-17.156Y32.835
+X-17.568Y33.118
+X-17.984Y33.396
+X-18.403Y33.668
+X-18.825Y33.936
+X-19.251Y34.198
+X-19.680Y34.454
+X-20.113Y34.706
+X-20.548Y34.952
+X-20.986Y35.192
+X-21.428Y35.427
+X-21.872Y35.656
+X-22.319Y35.880
+X-22.769Y36.098
+X-23.222Y36.311
+X-23.677Y36.518
+X-24.134Y36.719
+X-24.595Y36.914
+X-25.057Y37.104
+X-25.522Y37.288
+X-25.989Y37.466
+X-26.459Y37.638
+X-26.930Y37.805
+X-27.404Y37.965
+X-27.879Y38.119
+X-28.357Y38.268
+X-28.836Y38.411
+X-29.317Y38.547
+X-29.800Y38.678
+X-30.284Y38.802
+X-30.770Y38.920
+X-31.257Y39.033
+X-31.746Y39.139
+X-32.236Y39.239
+X-32.727Y39.333
+X-33.219Y39.421
+X-33.712Y39.503
+X-34.206Y39.578
+X-34.702Y39.648
+X-35.198Y39.711
+X-35.694Y39.768
+X-36.192Y39.818
+X-36.690Y39.863
+X-37.188Y39.901
+X-37.687Y39.933
+X-38.187Y39.959
+X-38.686Y39.978
+X-39.186Y39.992
+X-39.686Y39.999
+X-40.186Y40.000
+X-40.686Y39.994
+X-41.186Y39.982
+X-41.685Y39.964
+X-42.185Y39.940
+X-42.684Y39.910
+X-43.183Y39.873
+X-43.681Y39.830
+X-44.178Y39.781
+X-44.675Y39.726
+X-45.171Y39.664
+X-45.667Y39.597
+X-46.161Y39.523
+X-46.655Y39.443
+X-47.147Y39.356
+X-47.639Y39.264
+X-48.129Y39.165
+X-48.618Y39.061
+X-49.105Y38.950
+X-49.592Y38.833
+X-50.076Y38.710
+X-50.559Y38.581
+X-51.041Y38.446
+X-51.520Y38.305
+X-51.998Y38.158
+X-52.474Y38.005
+X-52.948Y37.846
+X-53.420Y37.681
+X-53.890Y37.511
+X-54.358Y37.334
+X-54.824Y37.152
+X-55.287Y36.964
+X-55.748Y36.770
+X-56.206Y36.570
+X-56.662Y36.365
+X-57.115Y36.153
+X-57.566Y35.937
+X-58.014Y35.714
+X-58.459Y35.486
+X-58.901Y35.253
+X-59.340Y35.014
+X-59.776Y34.769
+X-60.209Y34.519
+X-60.639Y34.264
+X-61.066Y34.003
+X-61.489Y33.737
+X-61.909Y33.466
+X-62.326Y33.190
+X-62.739Y32.908
+X-63.148Y32.621
+X-63.554Y32.329
+X-63.957Y32.032
+X-64.355Y31.730
+X-64.750Y31.424
+X-65.141Y31.112
+X-65.528Y30.795
+X-65.911Y30.474
+X-66.290Y30.147
+X-66.664Y29.816
+X-67.035Y29.481
+X-67.401Y29.141
+X-67.763Y28.796
+X-68.121Y28.446
+X-68.475Y28.093
+X-68.823Y27.735
+X-69.168Y27.372
+X-69.508Y27.005
+X-69.843Y26.634
+X-70.174Y26.259
+X-70.499Y25.880
+X-70.821Y25.497
+X-71.137Y25.110
+X-71.448Y24.719
+X-71.755Y24.323
+X-72.056Y23.925
+X-72.353Y23.522
+X-72.644Y23.116
+X-72.931Y22.706
+X-73.212Y22.293
+X-73.488Y21.876
+X-73.759Y21.455
+X-74.024Y21.032
+X-74.285Y20.605
+X-74.540Y20.175
+X-74.789Y19.741
+X-75.033Y19.305
+X-75.272Y18.866
+X-75.505Y18.423
+X-75.732Y17.978
+X-75.954Y17.530
+X-76.170Y17.079
+X-76.381Y16.626
+X-76.586Y16.170
+X-76.785Y15.711
+X-76.979Y15.250
+X-77.167Y14.787
+X-77.349Y14.321
+X-77.525Y13.853
+X-77.695Y13.383
+X-77.859Y12.911
+X-78.018Y12.436
+X-78.170Y11.960
+X-78.317Y11.482
+X-78.457Y11.002
+X-78.592Y10.521
+X-78.720Y10.037
+X-78.843Y9.553
+X-78.959Y9.066
+X-79.069Y8.579
+X-79.173Y8.090
+X-79.271Y7.599
+X-79.363Y7.108
+X-79.449Y6.615
+X-79.529Y6.122
+X-79.602Y5.627
+X-79.669Y5.132
+X-79.730Y4.636
+X-79.785Y4.139
+X-79.834Y3.641
+X-79.876Y3.143
+X-79.913Y2.644
+X-79.942Y2.145
+X-79.966Y1.645
+X-79.984Y1.146
+X-79.995Y0.646
+X-80.000Y0.146
+X-79.998Y-0.354
+X-79.991Y-0.854
+X-79.977Y-1.354
+X-79.957Y-1.853
+X-79.931Y-2.353
+X-79.898Y-2.852
+X-79.859Y-3.350
+X-79.814Y-3.848
+X-79.763Y-4.345
+X-79.706Y-4.842
+X-79.642Y-5.338
+X-79.572Y-5.833
+X-79.496Y-6.327
+X-79.414Y-6.821
+X-79.326Y-7.313
+X-79.231Y-7.804
+X-79.131Y-8.293
+X-79.024Y-8.782
+X-78.911Y-9.269
+X-78.792Y-9.755
+X-78.667Y-10.239
+X-78.536Y-10.721
+X-78.399Y-11.202
+X-78.256Y-11.681
+X-78.107Y-12.159
+X-77.952Y-12.634
+X-77.791Y-13.107
+X-77.625Y-13.579
+X-77.452Y-14.048
+X-77.274Y-14.515
+X-77.089Y-14.980
+X-76.899Y-15.442
+X-76.703Y-15.902
+X-76.501Y-16.360
+X-76.294Y-16.815
+X-76.081Y-17.267
+X-75.862Y-17.717
+X-75.638Y-18.164
+X-75.408Y-18.608
+X-75.173Y-19.049
+X-74.932Y-19.487
+X-74.686Y-19.922
+X-74.434Y-20.354
+X-74.177Y-20.783
+X-73.915Y-21.209
+X-73.647Y-21.631
+X-73.374Y-22.050
+X-73.096Y-22.465
+X-72.812Y-22.877
+X-72.524Y-23.285
+X-72.230Y-23.690
+X-71.931Y-24.091
+X-71.628Y-24.488
+X-71.319Y-24.882
+X-71.006Y-25.271
+X-70.688Y-25.657
+X-70.364Y-26.038
+X-70.037Y-26.416
+X-69.704Y-26.789
+X-69.367Y-27.159
+X-69.025Y-27.524
+X-68.679Y-27.884
+X-68.328Y-28.240
+X-67.973Y-28.592
+X-67.613Y-28.940
+X-67.249Y-29.283
+X-66.881Y-29.621
+X-66.509Y-29.955
+X-66.132Y-30.284
+X-65.752Y-30.608
+X-65.367Y-30.927
+X-64.979Y-31.242
+X-64.586Y-31.552
+X-64.190Y-31.857
+X-63.790Y-32.157
+X-63.386Y-32.452
+X-62.978Y-32.741
+X-62.567Y-33.026
+X-62.153Y-33.305
+X-61.735Y-33.580
+X-61.313Y-33.849
+X-60.889Y-34.113
+X-60.461Y-34.371
+X-60.029Y-34.624
+X-59.595Y-34.872
+X-59.158Y-35.114
+X-58.717Y-35.351
+X-58.274Y-35.582
+X-57.828Y-35.807
+X-57.379Y-36.028
+X-56.927Y-36.242
+X-56.473Y-36.451
+X-56.016Y-36.654
+X-55.556Y-36.851
+X-55.094Y-37.043
+X-54.630Y-37.228
+X-54.164Y-37.408
+X-53.695Y-37.583
+X-53.224Y-37.751
+X-52.751Y-37.913
+X-52.276Y-38.070
+X-51.800Y-38.220
+X-51.321Y-38.365
+X-50.841Y-38.503
+X-50.358Y-38.636
+X-49.875Y-38.762
+X-49.389Y-38.882
+X-48.903Y-38.997
+X-48.414Y-39.105
+X-47.925Y-39.207
+X-47.434Y-39.303
+X-46.942Y-39.393
+X-46.450Y-39.477
+X-45.956Y-39.554
+X-45.461Y-39.626
+X-44.965Y-39.691
+X-44.468Y-39.750
+X-43.971Y-39.802
+X-43.473Y-39.849
+X-42.975Y-39.889
+X-42.476Y-39.923
+X-41.977Y-39.951
+X-41.477Y-39.973
+X-40.978Y-39.988
+X-40.478Y-39.997
+X-39.978Y-40.000
+X-39.478Y-39.997
+X-38.978Y-39.987
+X-38.478Y-39.971
+X-37.979Y-39.949
+X-37.479Y-39.921
+X-36.981Y-39.886
+X-36.482Y-39.845
+X-35.985Y-39.798
+X-35.487Y-39.745
+X-34.991Y-39.685
+X-34.495Y-39.619
+X-34.001Y-39.548
+X-33.507Y-39.469
+X-33.014Y-39.385
+X-32.522Y-39.295
+X-32.031Y-39.198
+X-31.542Y-39.096
+X-31.054Y-38.987
+X-30.567Y-38.872
+X-30.082Y-38.751
+X-29.599Y-38.624
+X-29.117Y-38.491
+X-28.636Y-38.352
+X-28.158Y-38.207
+X-27.681Y-38.056
+X-27.207Y-37.899
+X-26.734Y-37.736
+X-26.263Y-37.567
+X-25.795Y-37.393
+X-25.328Y-37.212
+X-24.864Y-37.026
+X-24.403Y-36.834
+X-23.944Y-36.636
+X-23.487Y-36.432
+X-23.033Y-36.223
+X-22.581Y-36.008
+X-22.133Y-35.788
+X-21.687Y-35.562
+X-21.244Y-35.330
+X-20.803Y-35.093
+X-20.366Y-34.850
+X-19.932Y-34.602
+X-19.501Y-34.348
+X-19.074Y-34.089
+X-18.649Y-33.825
+X-18.228Y-33.556
+X-17.810Y-33.281
+X-17.396Y-33.001
+X-16.985Y-32.716
+X-16.578Y-32.426
+X-16.175Y-32.130
+X-15.775Y-31.830
+X-15.379Y-31.525
+X-14.987Y-31.214
+X-14.599Y-30.899
+X-14.214Y-30.579
+X-13.834Y-30.255
+X-13.458Y-29.925
+X-13.086Y-29.591
+X-12.718Y-29.252
+X-12.355Y-28.909
+X-11.995Y-28.561
+X-11.641Y-28.209
+X-11.290Y-27.852
+X-10.944Y-27.491
+X-10.603Y-27.126
+X-10.266Y-26.756
+X-9.934Y-26.383
+X-9.607Y-26.005
+X-9.284Y-25.623
+X-8.966Y-25.237
+X-8.653Y-24.847
+X-8.345Y-24.453
+X-8.042Y-24.056
+X-7.744Y-23.654
+X-7.450Y-23.249
+X-7.162Y-22.841
+X-6.879Y-22.428
+X-6.602Y-22.013
+X-6.329Y-21.593
+X-6.062Y-21.171
+X-5.800Y-20.745
+X-5.543Y-20.316
+X-5.292Y-19.884
+X-5.046Y-19.448
+X-4.806Y-19.010
+X-4.571Y-18.568
+X-4.342Y-18.124
+X-4.118Y-17.677
+X-3.900Y-17.227
+X-3.687Y-16.774
+X-3.480Y-16.319
+X-3.279Y-15.861
+X-3.084Y-15.401
+X-2.894Y-14.939
+X-2.710Y-14.474
+X-2.532Y-14.006
+X-2.360Y-13.537
+X-2.194Y-13.065
+X-2.034Y-12.592
+X-1.879Y-12.116
+X-1.731Y-11.639
+X-1.588Y-11.160
+X-1.452Y-10.679
+X-1.321Y-10.196
+X-1.197Y-9.712
+X-1.078Y-9.226
+X-0.966Y-8.739
+X-0.860Y-8.250
+X-0.760Y-7.760
+X-0.666Y-7.269
+X-0.578Y-6.777
+X-0.497Y-6.284
+X-0.421Y-5.789
+X-0.352Y-5.294
+X-0.289Y-4.798
+X-0.232Y-4.301
+X-0.181Y-3.804
+X-0.137Y-3.306
+X-0.099Y-2.807
+X-0.067Y-2.308
+X-0.041Y-1.809
+X-0.021Y-1.309
+X-0.008Y-0.810
+X-0.001Y-0.310
+X-0.000Y0.190
+X-0.006Y0.690
+X-0.018Y1.190
+X-0.036Y1.690
+X-0.060Y2.189
+X-0.090Y2.688
+X-0.127Y3.187
+X-0.170Y3.685
+X-0.219Y4.183
+X-0.275Y4.680
+X-0.336Y5.176
+X-0.404Y5.671
+X-0.478Y6.166
+X-0.558Y6.659
+X-0.645Y7.152
+X-0.737Y7.643
+X-0.836Y8.133
+X-0.940Y8.622
+X-1.051Y9.110
+X-1.168Y9.596
+X-1.291Y10.080
+X-1.420Y10.564
+X-1.555Y11.045
+X-1.696Y11.525
+X-1.843Y12.003
+X-1.996Y12.479
+X-2.155Y12.953
+X-2.320Y13.425
+X-2.491Y13.895
+X-2.667Y14.362
+X-2.850Y14.828
+X-3.038Y15.291
+X-3.232Y15.752
+X-3.432Y16.210
+X-3.637Y16.666
+X-3.849Y17.119
+X-4.065Y17.570
+X-4.288Y18.018
+X-4.516Y18.463
+X-4.749Y18.905
+X-4.988Y19.344
+X-5.233Y19.780
+X-5.483Y20.213
+X-5.738Y20.643
+X-5.999Y21.070
+X-6.265Y21.493
+X-6.536Y21.913
+X-6.813Y22.329
+X-7.094Y22.743
+X-7.381Y23.152
+X-7.673Y23.558
+X-7.970Y23.960
+X-8.272Y24.359
+X-8.579Y24.753
+X-8.891Y25.144
+X-9.208Y25.531
+X-9.529Y25.914
+X-9.856Y26.293
+X-10.187Y26.668
+X-10.522Y27.038
+X-10.863Y27.405
+X-11.207Y27.767
+X-11.557Y28.124
+X-11.910Y28.478
+X-12.269Y28.827
+X-12.631Y29.171
+X-12.998Y29.511
+X-13.369Y29.846
+X-13.744Y30.177
+X-14.123Y30.502
+X-14.507Y30.823
+X-14.894Y31.140
+X-15.285Y31.451
+X-15.680Y31.758
+X-16.079Y32.059
+X-16.482Y32.356
+X-16.888Y32.647
+X-17.298Y32.933
+X-17.711Y33.215
+X-18.128Y33.491
+X-18.548Y33.761
+X-18.972Y34.027
+X-19.399Y34.287
+X-19.829Y34.542
+X-20.262Y34.791
+X-20.699Y35.035
+X-21.138Y35.274
+X-21.581Y35.507
+X-22.026Y35.734
+X-22.474Y35.956
+X-22.925Y36.172
+X-23.378Y36.383
+X-23.834Y36.588
+X-24.293Y36.787
+X-24.754Y36.981
+X-25.218Y37.168
+X-25.683Y37.350
+X-26.151Y37.526
+X-26.621Y37.696
+X-27.094Y37.861
+X-27.568Y38.019
+X-28.044Y38.171
+X-28.522Y38.318
+X-29.002Y38.458
+X-29.484Y38.593
+X-29.967Y38.721
+X-30.452Y38.844
+X-30.938Y38.960
+X-31.426Y39.070
+X-31.915Y39.174
+X-32.405Y39.272
+X-32.896Y39.364
+X-33.389Y39.450
+X-33.883Y39.529
+X-34.377Y39.603
+X-34.873Y39.670
+X-35.369Y39.731
+X-35.866Y39.786
+X-36.364Y39.834
+X-36.862Y39.877
+X-37.360Y39.913
+X-37.860Y39.943
+X-38.359Y39.966
+X-38.859Y39.984
+X-39.359Y39.995
+X-39.858Y40.000
+X-40.358Y39.998
+X-40.858Y39.991
+X-41.358Y39.977
+X-41.858Y39.957
+X-42.357Y39.930
+X-42.856Y39.898
+X-43.355Y39.859
+X-43.853Y39.814
+X-44.350Y39.763
+X-44.847Y39.705
+X-45.342Y39.642
+X-45.838Y39.572
+X-46.332Y39.496
+X-46.825Y39.413
+X-47.317Y39.325
+X-47.808Y39.231
+X-48.298Y39.130
+X-48.786Y39.023
+X-49.273Y38.910
+X-49.759Y38.791
+X-50.243Y38.666
+X-50.726Y38.535
+X-51.206Y38.398
+X-51.686Y38.255
+X-52.163Y38.106
+X-52.638Y37.951
+X-53.112Y37.790
+X-53.583Y37.623
+X-54.052Y37.450
+X-54.519Y37.272
+X-54.984Y37.088
+X-55.446Y36.897
+X-55.906Y36.701
+X-56.364Y36.500
+X-56.819Y36.292
+X-57.271Y36.079
+X-57.721Y35.861
+X-58.168Y35.636
+X-58.612Y35.406
+X-59.053Y35.171
+X-59.491Y34.930
+X-59.926Y34.684
+X-60.358Y34.432
+X-60.787Y34.175
+X-61.212Y33.912
+X-61.635Y33.644
+X-62.053Y33.371
+X-62.469Y33.093
+X-62.881Y32.810
+X-63.289Y32.521
+X-63.694Y32.227
+X-64.095Y31.929
+X-64.492Y31.625
+X-64.885Y31.317
+X-65.275Y31.003
+X-65.660Y30.685
+X-66.042Y30.362
+X-66.419Y30.034
+X-66.793Y29.701
+X-67.162Y29.364
+X-67.527Y29.022
+X-67.887Y28.676
+X-68.244Y28.325
+X-68.595Y27.970
+X-68.943Y27.610
+X-69.286Y27.246
+X-69.624Y26.878
+X-69.958Y26.505
+X-70.287Y26.129
+X-70.611Y25.748
+X-70.930Y25.364
+X-71.245Y24.975
+X-71.555Y24.583
+X-71.859Y24.186
+X-72.159Y23.786
+X-72.454Y23.382
+X-72.744Y22.975
+X-73.028Y22.564
+X-73.308Y22.149
+X-73.582Y21.731
+X-73.851Y21.310
+X-74.115Y20.885
+X-74.373Y20.457
+X-74.626Y20.025
+X-74.874Y19.591
+X-75.116Y19.154
+X-75.353Y18.713
+X-75.584Y18.270
+X-75.809Y17.824
+X-76.029Y17.375
+X-76.244Y16.923
+X-76.453Y16.469
+X-76.656Y16.012
+X-76.853Y15.552
+X-77.044Y15.090
+X-77.230Y14.626
+X-77.410Y14.160
+X-77.584Y13.691
+X-77.752Y13.220
+X-77.915Y12.747
+X-78.071Y12.272
+X-78.221Y11.795
+X-78.366Y11.317
+X-78.504Y10.836
+X-78.637Y10.354
+X-78.763Y9.870
+X-78.883Y9.385
+X-78.998Y8.898
+X-79.106Y8.410
+X-79.208Y7.921
+X-79.304Y7.430
+X-79.394Y6.938
+X-79.477Y6.445
+X-79.555Y5.951
+X-79.626Y5.456
+X-79.691Y4.961
+X-79.750Y4.464
+X-79.803Y3.967
+X-79.849Y3.469
+X-79.890Y2.971
+X-79.924Y2.472
+X-79.951Y1.973
+X-79.973Y1.473
+X-79.988Y0.973
+X-79.997Y0.473
+X-80.000Y-0.027
+X-79.997Y-0.527
+X-79.987Y-1.027
+X-79.971Y-1.526
+X-79.949Y-2.026
+X-79.920Y-2.525
+X-79.886Y-3.024
+X-79.845Y-3.522
+X-79.797Y-4.020
+X-79.744Y-4.517
+X-79.685Y-5.013
+X-79.619Y-5.509
+X-79.547Y-6.004
+X-79.469Y-6.498
+X-79.384Y-6.991
+X-79.294Y-7.482
+X-79.197Y-7.973
+X-79.095Y-8.462
+X-78.986Y-8.950
+X-78.871Y-9.437
+X-78.750Y-9.922
+X-78.623Y-10.406
+X-78.490Y-10.888
+X-78.351Y-11.368
+X-78.206Y-11.846
+X-78.055Y-12.323
+X-77.898Y-12.798
+X-77.735Y-13.270
+X-77.566Y-13.741
+X-77.391Y-14.209
+X-77.211Y-14.676
+X-77.024Y-15.140
+X-76.832Y-15.601
+X-76.634Y-16.060
+X-76.431Y-16.517
+X-76.221Y-16.971
+X-76.006Y-17.423
+X-75.786Y-17.871
+X-75.560Y-18.317
+X-75.328Y-18.760
+X-75.091Y-19.200
+X-74.848Y-19.638
+X-74.600Y-20.072
+X-74.346Y-20.502
+X-74.087Y-20.930
+X-73.823Y-21.355
+X-73.553Y-21.776
+X-73.278Y-22.193
+X-72.998Y-22.608
+X-72.713Y-23.018
+X-72.423Y-23.425
+X-72.128Y-23.829
+X-71.827Y-24.229
+X-71.522Y-24.625
+X-71.212Y-25.017
+X-70.896Y-25.405
+X-70.577Y-25.789
+X-70.252Y-26.169
+X-69.922Y-26.545
+X-69.588Y-26.917
+X-69.249Y-27.285
+X-68.906Y-27.649
+X-68.558Y-28.008
+X-68.206Y-28.362
+X-67.849Y-28.713
+X-67.488Y-29.059
+X-67.123Y-29.400
+X-66.753Y-29.737
+X-66.379Y-30.069
+X-66.001Y-30.396
+X-65.619Y-30.719
+X-65.233Y-31.037
+X-64.844Y-31.350
+X-64.450Y-31.658
+X-64.052Y-31.961
+X-63.651Y-32.259
+X-63.246Y-32.552
+X-62.837Y-32.840
+X-62.425Y-33.123
+X-62.009Y-33.401
+X-61.590Y-33.673
+X-61.167Y-33.940
+X-60.741Y-34.202
+X-60.312Y-34.459
+X-59.880Y-34.710
+X-59.444Y-34.956
+X-59.006Y-35.196
+X-58.564Y-35.431
+X-58.120Y-35.660
+X-57.673Y-35.884
+X-57.223Y-36.102
+X-56.770Y-36.315
+X-56.315Y-36.521
+X-55.857Y-36.723
+X-55.397Y-36.918
+X-54.934Y-37.107
+X-54.469Y-37.291
+X-54.002Y-37.469
+X-53.533Y-37.641
+X-53.061Y-37.807
+X-52.588Y-37.968
+X-52.112Y-38.122
+X-51.635Y-38.271
+X-51.155Y-38.413
+X-50.674Y-38.549
+X-50.192Y-38.680
+X-49.707Y-38.804
+X-49.222Y-38.923
+X-48.734Y-39.035
+X-48.246Y-39.141
+X-47.756Y-39.241
+X-47.265Y-39.335
+X-46.772Y-39.423
+X-46.279Y-39.504
+X-45.785Y-39.579
+X-45.290Y-39.649
+X-44.794Y-39.712
+X-44.297Y-39.769
+X-43.799Y-39.819
+X-43.301Y-39.864
+X-42.803Y-39.902
+X-42.304Y-39.934
+X-41.805Y-39.959
+X-41.305Y-39.979
+X-40.805Y-39.992
+X-40.305Y-39.999
+X-39.805Y-40.000
+X-39.305Y-39.994
+X-38.805Y-39.982
+X-38.306Y-39.964
+X-37.806Y-39.940
+X-37.307Y-39.909
+X-36.809Y-39.872
+X-36.310Y-39.829
+X-35.813Y-39.780
+X-35.316Y-39.725
+X-34.820Y-39.663
+X-34.324Y-39.595
+X-33.830Y-39.521
+X-33.336Y-39.441
+X-32.844Y-39.355
+X-32.353Y-39.262
+X-31.862Y-39.163
+X-31.374Y-39.059
+X-30.886Y-38.948
+X-30.400Y-38.831
+X-29.915Y-38.708
+X-29.432Y-38.579
+X-28.951Y-38.444
+X-28.471Y-38.303
+X-27.993Y-38.155
+X-27.517Y-38.002
+X-27.043Y-37.843
+X-26.571Y-37.678
+X-26.101Y-37.508
+X-25.634Y-37.331
+X-25.168Y-37.149
+X-24.705Y-36.960
+X-24.244Y-36.766
+X-23.786Y-36.566
+X-23.330Y-36.361
+X-22.877Y-36.150
+X-22.426Y-35.933
+X-21.978Y-35.710
+X-21.533Y-35.482
+X-21.091Y-35.249
+X-20.652Y-35.009
+X-20.216Y-34.765
+X-19.783Y-34.515
+X-19.353Y-34.260
+X-18.927Y-33.999
+X-18.503Y-33.733
+X-18.083Y-33.461
+X-17.667Y-33.185
+X-17.254Y-32.903
+X-16.844Y-32.616
+X-16.438Y-32.324
+X-16.036Y-32.027
+X-15.638Y-31.725
+X-15.243Y-31.418
+X-14.852Y-31.106
+X-14.465Y-30.789
+X-14.083Y-30.468
+X-13.704Y-30.141
+X-13.329Y-29.810
+X-12.959Y-29.475
+X-12.592Y-29.134
+X-12.230Y-28.790
+X-11.873Y-28.440
+X-11.519Y-28.086
+X-11.170Y-27.728
+X-10.826Y-27.366
+X-10.486Y-26.999
+X-10.151Y-26.628
+X-9.821Y-26.253
+X-9.495Y-25.873
+X-9.174Y-25.490
+X-8.858Y-25.103
+X-8.546Y-24.712
+X-8.240Y-24.316
+X-7.938Y-23.918
+X-7.642Y-23.515
+X-7.350Y-23.109
+X-7.064Y-22.699
+X-6.783Y-22.285
+X-6.507Y-21.868
+X-6.236Y-21.448
+X-5.971Y-21.024
+X-5.711Y-20.597
+X-5.456Y-20.167
+X-5.207Y-19.734
+X-4.963Y-19.297
+X-4.724Y-18.858
+X-4.491Y-18.415
+X-4.264Y-17.970
+X-4.042Y-17.522
+X-3.826Y-17.071
+X-3.615Y-16.618
+X-3.410Y-16.162
+X-3.211Y-15.703
+X-3.018Y-15.242
+X-2.830Y-14.778
+X-2.648Y-14.313
+X-2.472Y-13.845
+X-2.302Y-13.374
+X-2.138Y-12.902
+X-1.980Y-12.428
+X-1.827Y-11.952
+X-1.681Y-11.474
+X-1.540Y-10.994
+X-1.406Y-10.512
+X-1.278Y-10.029
+X-1.155Y-9.544
+X-1.039Y-9.058
+X-0.929Y-8.570
+X-0.825Y-8.081
+X-0.727Y-7.591
+X-0.635Y-7.099
+X-0.549Y-6.607
+X-0.470Y-6.113
+X-0.397Y-5.618
+X-0.329Y-5.123
+X-0.268Y-4.627
+X-0.214Y-4.130
+X-0.165Y-3.632
+X-0.123Y-3.134
+X-0.087Y-2.635
+X-0.057Y-2.136
+X-0.033Y-1.637
+X-0.016Y-1.137
+X-0.005Y-0.637
+X-0.000Y-0.137
+X-0.002Y0.363
+X-0.009Y0.863
+X-0.023Y1.363
+X-0.043Y1.862
+X-0.070Y2.362
+X-0.102Y2.860
+X-0.141Y3.359
+X-0.186Y3.857
+X-0.238Y4.354
+X-0.295Y4.851
+X-0.359Y5.347
+X-0.429Y5.842
+X-0.505Y6.336
+X-0.587Y6.829
+X-0.676Y7.321
+X-0.770Y7.812
+X-0.871Y8.302
+X-0.978Y8.791
+X-1.091Y9.278
+X-1.210Y9.763
+X-1.335Y10.247
+X-1.466Y10.730
+X-1.603Y11.211
+X-1.746Y11.690
+X-1.895Y12.167
+X-2.050Y12.642
+X-2.211Y13.116
+X-2.378Y13.587
+X-2.551Y14.056
+X-2.730Y14.523
+X-2.914Y14.988
+X-3.104Y15.450
+X-3.300Y15.910
+X-3.502Y16.368
+X-3.710Y16.823
+X-3.923Y17.275
+X-4.141Y17.725
+X-4.366Y18.172
+X-4.596Y18.616
+X-4.831Y19.057
+X-5.072Y19.495
+X-5.319Y19.930
+X-5.570Y20.362
+X-5.828Y20.791
+X-6.090Y21.216
+X-6.358Y21.638
+X-6.631Y22.057
+X-6.909Y22.472
+X-7.193Y22.884
+X-7.481Y23.293
+X-7.775Y23.697
+X-8.074Y24.098
+X-8.378Y24.495
+X-8.686Y24.889
+X-9.000Y25.278
+X-9.318Y25.664
+X-9.641Y26.045
+X-9.969Y26.423
+X-10.302Y26.796
+X-10.639Y27.165
+X-10.981Y27.530
+X-11.327Y27.891
+X-11.678Y28.247
+X-12.034Y28.599
+X-12.393Y28.946
+X-12.757Y29.289
+X-13.125Y29.627
+X-13.498Y29.961
+X-13.874Y30.290
+X-14.255Y30.614
+X-14.640Y30.933
+X-15.028Y31.248
+X-15.421Y31.557
+X-15.817Y31.862
+X-16.217Y32.162
+X-16.621Y32.457
+X-17.029Y32.746
+X-17.440Y33.031
+X-17.855Y33.310
+X-18.273Y33.585
+X-18.694Y33.854
+X-19.119Y34.117
+X-19.547Y34.376
+X-19.978Y34.629
+X-20.413Y34.876
+X-20.850Y35.118
+X-21.291Y35.355
+X-21.734Y35.586
+X-22.180Y35.811
+X-22.629Y36.031
+X-23.081Y36.246
+X-23.535Y36.454
+X-23.992Y36.657
+X-24.452Y36.855
+X-24.914Y37.046
+X-25.378Y37.232
+X-25.845Y37.412
+X-26.313Y37.586
+X-26.784Y37.754
+X-27.257Y37.916
+X-27.732Y38.072
+X-28.209Y38.223
+X-28.688Y38.367
+X-29.168Y38.505
+X-29.650Y38.638
+X-30.134Y38.764
+X-30.619Y38.884
+X-31.106Y38.999
+X-31.594Y39.107
+X-32.084Y39.209
+X-32.574Y39.305
+X-33.066Y39.394
+X-33.559Y39.478
+X-34.053Y39.555
+X-34.548Y39.627
+X-35.044Y39.692
+X-35.540Y39.751
+X-36.038Y39.803
+X-36.535Y39.850
+X-37.034Y39.890
+X-37.533Y39.924
+X-38.032Y39.952
+X-38.531Y39.973
+X-39.031Y39.988
+X-39.531Y39.997
+X-40.031Y40.000
+X-40.531Y39.996
+X-41.031Y39.987
+X-41.531Y39.971
+X-42.030Y39.948
+X-42.529Y39.920
+X-43.028Y39.885
+X-43.527Y39.844
+X-44.024Y39.797
+X-44.521Y39.744
+X-45.018Y39.684
+X-45.513Y39.618
+X-46.008Y39.546
+X-46.502Y39.468
+X-46.995Y39.384
+X-47.487Y39.293
+X-47.977Y39.196
+X-48.467Y39.094
+X-48.955Y38.985
+X-49.441Y38.870
+X-49.926Y38.749
+X-50.410Y38.622
+X-50.892Y38.489
+X-51.372Y38.349
+X-51.851Y38.204
+X-52.327Y38.053
+X-52.802Y37.896
+X-53.274Y37.733
+X-53.745Y37.564
+X-54.214Y37.389
+X-54.680Y37.209
+X-55.144Y37.023
+X-55.605Y36.830
+X-56.065Y36.632
+X-56.521Y36.429
+X-56.975Y36.219
+X-57.427Y36.004
+X-57.875Y35.784
+X-58.321Y35.557
+X-58.764Y35.326
+X-59.204Y35.088
+X-59.641Y34.846
+X-60.075Y34.597
+X-60.506Y34.344
+X-60.934Y34.085
+X-61.358Y33.820
+X-61.779Y33.551
+X-62.197Y33.276
+X-62.611Y32.996
+X-63.022Y32.711
+X-63.429Y32.420
+X-63.833Y32.125
+X-64.232Y31.825
+X-64.628Y31.519
+X-65.020Y31.209
+X-65.408Y30.894
+X-65.792Y30.574
+X-66.173Y30.249
+X-66.549Y29.919
+X-66.921Y29.585
+X-67.288Y29.246
+X-67.652Y28.903
+X-68.011Y28.555
+X-68.366Y28.203
+X-68.716Y27.846
+X-69.062Y27.485
+X-69.403Y27.119
+X-69.740Y26.750
+X-70.072Y26.376
+X-70.399Y25.998
+X-70.722Y25.616
+X-71.039Y25.230
+X-71.352Y24.840
+X-71.660Y24.446
+X-71.964Y24.049
+X-72.262Y23.647
+X-72.555Y23.242
+X-72.843Y22.833
+X-73.126Y22.421
+X-73.403Y22.005
+X-73.676Y21.586
+X-73.943Y21.163
+X-74.205Y20.737
+X-74.461Y20.308
+X-74.712Y19.876
+X-74.958Y19.440
+X-75.198Y19.002
+X-75.433Y18.560
+X-75.662Y18.116
+X-75.886Y17.669
+X-76.104Y17.219
+X-76.317Y16.766
+X-76.523Y16.311
+X-76.724Y15.853
+X-76.920Y15.393
+X-77.109Y14.930
+X-77.293Y14.465
+X-77.471Y13.998
+X-77.643Y13.529
+X-77.809Y13.057
+X-77.969Y12.583
+X-78.123Y12.108
+X-78.272Y11.630
+X-78.414Y11.151
+X-78.551Y10.670
+X-78.681Y10.187
+X-78.805Y9.703
+X-78.924Y9.217
+X-79.036Y8.730
+X-79.142Y8.241
+X-79.242Y7.751
+X-79.336Y7.260
+X-79.423Y6.768
+X-79.505Y6.275
+X-79.580Y5.780
+X-79.649Y5.285
+X-79.712Y4.789
+X-79.769Y4.292
+X-79.820Y3.795
+X-79.864Y3.297
+X-79.902Y2.798
+X-79.934Y2.299
+X-79.959Y1.800
+X-79.979Y1.301
+X-79.992Y0.801
+X-79.999Y0.301
+X-80.000Y-0.199
+X-79.994Y-0.699
+X-79.982Y-1.199
+X-79.964Y-1.699
+X-79.940Y-2.198
+X-79.909Y-2.697
+X-79.872Y-3.196
+X-79.829Y-3.694
+X-79.780Y-4.192
+X-79.724Y-4.688
+X-79.663Y-5.185
+X-79.595Y-5.680
+X-79.521Y-6.174
+X-79.440Y-6.668
+X-79.354Y-7.160
+X-79.261Y-7.652
+X-79.163Y-8.142
+X-79.058Y-8.631
+X-78.947Y-9.118
+X-78.830Y-9.604
+X-78.707Y-10.089
+X-78.578Y-10.572
+X-78.442Y-11.053
+X-78.301Y-11.533
+X-78.154Y-12.011
+X-78.001Y-12.487
+X-77.842Y-12.961
+X-77.677Y-13.433
+X-77.506Y-13.903
+X-77.329Y-14.371
+X-77.147Y-14.836
+X-76.959Y-15.299
+X-76.764Y-15.760
+X-76.565Y-16.218
+X-76.359Y-16.674
+X-76.148Y-17.127
+X-75.931Y-17.578
+X-75.708Y-18.026
+X-75.480Y-18.470
+X-75.247Y-18.913
+X-75.007Y-19.352
+X-74.763Y-19.788
+X-74.513Y-20.221
+X-74.257Y-20.650
+X-73.996Y-21.077
+X-73.730Y-21.500
+X-73.459Y-21.920
+X-73.182Y-22.337
+X-72.901Y-22.750
+X-72.614Y-23.159
+X-72.322Y-23.565
+X-72.024Y-23.967
+X-71.722Y-24.366
+X-71.415Y-24.760
+X-71.103Y-25.151
+X-70.787Y-25.538
+X-70.465Y-25.921
+X-70.139Y-26.300
+X-69.807Y-26.674
+X-69.472Y-27.045
+X-69.131Y-27.411
+X-68.786Y-27.773
+X-68.437Y-28.131
+X-68.083Y-28.484
+X-67.725Y-28.833
+X-67.362Y-29.177
+X-66.996Y-29.517
+X-66.625Y-29.852
+X-66.249Y-30.182
+X-65.870Y-30.508
+X-65.487Y-30.829
+X-65.099Y-31.145
+X-64.708Y-31.457
+X-64.313Y-31.763
+X-63.914Y-32.064
+X-63.511Y-32.361
+X-63.105Y-32.652
+X-62.695Y-32.938
+X-62.282Y-33.219
+X-61.865Y-33.495
+X-61.444Y-33.766
+X-61.020Y-34.031
+X-60.593Y-34.292
+X-60.163Y-34.546
+X-59.730Y-34.796
+X-59.293Y-35.040
+X-58.854Y-35.278
+X-58.411Y-35.511
+X-57.966Y-35.738
+X-57.518Y-35.960
+X-57.067Y-36.176
+X-56.614Y-36.387
+X-56.157Y-36.591
+X-55.699Y-36.791
+X-55.238Y-36.984
+X-54.774Y-37.172
+X-54.308Y-37.353
+X-53.840Y-37.529
+X-53.370Y-37.699
+X-52.898Y-37.863
+X-52.424Y-38.022
+X-51.947Y-38.174
+X-51.469Y-38.320
+X-50.989Y-38.461
+X-50.508Y-38.595
+X-50.025Y-38.723
+X-49.540Y-38.846
+X-49.053Y-38.962
+X-48.566Y-39.072
+X-48.077Y-39.176
+X-47.586Y-39.274
+X-47.095Y-39.366
+X-46.602Y-39.451
+X-46.109Y-39.531
+X-45.614Y-39.604
+X-45.119Y-39.671
+X-44.622Y-39.732
+X-44.125Y-39.787
+X-43.628Y-39.835
+X-43.129Y-39.877
+X-42.631Y-39.913
+X-42.132Y-39.943
+X-41.632Y-39.967
+X-41.132Y-39.984
+X-40.633Y-39.995
+X-40.133Y-40.000
+X-39.633Y-39.998
+X-39.133Y-39.991
+X-38.633Y-39.977
+X-38.133Y-39.956
+X-37.634Y-39.930
+X-37.135Y-39.897
+X-36.637Y-39.858
+X-36.139Y-39.813
+X-35.641Y-39.762
+X-35.145Y-39.704
+X-34.649Y-39.640
+X-34.154Y-39.570
+X-33.659Y-39.494
+X-33.166Y-39.412
+X-32.674Y-39.323
+X-32.183Y-39.229
+X-31.694Y-39.128
+X-31.205Y-39.021
+X-30.718Y-38.908
+X-30.232Y-38.789
+X-29.748Y-38.664
+X-29.266Y-38.533
+X-28.785Y-38.396
+X-28.306Y-38.252
+X-27.829Y-38.103
+X-27.353Y-37.948
+X-26.880Y-37.787
+X-26.409Y-37.620
+X-25.940Y-37.447
+X-25.473Y-37.269
+X-25.008Y-37.084
+X-24.546Y-36.894
+X-24.086Y-36.698
+X-23.628Y-36.496
+X-23.173Y-36.289
+X-22.721Y-36.075
+X-22.271Y-35.857
+X-21.825Y-35.632
+X-21.381Y-35.402
+X-20.939Y-35.167
+X-20.501Y-34.926
+X-20.066Y-34.679
+X-19.634Y-34.427
+X-19.206Y-34.170
+X-18.780Y-33.908
+X-18.358Y-33.640
+X-17.939Y-33.366
+X-17.524Y-33.088
+X-17.112Y-32.805
+X-16.704Y-32.516
+X-16.299Y-32.222
+X-15.898Y-31.923
+X-15.501Y-31.620
+X-15.108Y-31.311
+X-14.718Y-30.997
+X-14.333Y-30.679
+X-13.951Y-30.356
+X-13.574Y-30.028
+X-13.201Y-29.695
+X-12.832Y-29.358
+X-12.467Y-29.016
+X-12.106Y-28.669
+X-11.750Y-28.319
+X-11.398Y-27.963
+X-11.051Y-27.604
+X-10.708Y-27.240
+X-10.370Y-26.871
+X-10.036Y-26.499
+X-9.708Y-26.122
+X-9.383Y-25.742
+X-9.064Y-25.357
+X-8.750Y-24.968
+X-8.440Y-24.576
+X-8.135Y-24.179
+X-7.835Y-23.779
+X-7.541Y-23.375
+X-7.251Y-22.968
+X-6.967Y-22.556
+X-6.687Y-22.142
+X-6.413Y-21.724
+X-6.144Y-21.302
+X-5.880Y-20.877
+X-5.622Y-20.449
+X-5.369Y-20.018
+X-5.122Y-19.583
+X-4.880Y-19.146
+X-4.643Y-18.705
+X-4.412Y-18.262
+X-4.187Y-17.816
+X-3.967Y-17.367
+X-3.752Y-16.915
+X-3.544Y-16.460
+X-3.341Y-16.003
+X-3.144Y-15.544
+X-2.952Y-15.082
+X-2.767Y-14.618
+X-2.587Y-14.151
+X-2.413Y-13.683
+X-2.245Y-13.212
+X-2.083Y-12.739
+X-1.926Y-12.264
+X-1.776Y-11.787
+X-1.632Y-11.308
+X-1.493Y-10.828
+X-1.361Y-10.346
+X-1.235Y-9.862
+X-1.114Y-9.376
+X-1.000Y-8.890
+X-0.892Y-8.401
+X-0.790Y-7.912
@@ -0,0 +1,410 @@
+G21G90G94
+G1X1Y2F100
+X2Y3Z-1
+X-1F-5
+X1X2
+N10000001X1
+N-1X2
+N5X3Y3
+F0X1
+G0X0Y0
+X5Y5Z2A10B5C3D1
+G1X1Y1F0
+G1X1F200
+S100X2
+M3S1000
+X3S2000
+X4
+X5S2000
+S3000
+X6Y6
+G20
+X0.1Y0.2F10
+G91X0.1Y-0.1
+G21G90
+G10L2P1X5Y5Z1
+X1Y1
+G55X1
+G54
+G92X0Y0
+X1Y2
+G92.1
+G43.1Z2
+X3Z3
+G49
+G93X1F100
+X2
+G94
+G1X3
+G0X4
+$32=1
+G1X5S500
+G0X6S600
+G1X7
+M5
+M4S100
+X8
+M8X9
+M7
+X10
+M9
+$32=0
+G2X0Y0I-5J0
+X1
+G0
+X2Y2
+G80
+X3
+G1X4F100
+G1X1T1
+X2L2
+X3P1
+X4I1
+%
+X5S800
+X6S900
+%
+G1X7
+N99999999X1
+X1.5.5
+X
+GX1
+N1.5X3
+X2N2
+G1G0X1
+G01X2F300
+G0.5X1
+G1X1G1
+G2X3
+G1X4
+G-1X2
+G00X5
+G1N3X1S10F99
+G4P0.1X1
+C-2.6542D-16.3715A-17.6800X-13.9660Z1.4353
+G1Y14.3387A-7.6607C3.2640Z-14.2298N7812
+Z-10.0629S4193D-2.0466A11.1932B-7.9900
+B-5.9929Y2.3230F2383
+G0D17.6259Y3.1178
+Z-2.0325X-10.0954Y14.8569
+G91D-14.9803Z13.2437A-8.7228B1.3836X-13.9481
+B-17.8970X-15.8585Z-17.3061C-13.9494F5581A-13.5079D-5.4556
+M5F2094B-15.9125C-9.4097
+C-5.3320D10.8775Y1.1244
+A-18.8408C7.7009Z0.7055B-8.8233
+G90Y4.9627X-12.1318F4705
+G21F2650A17.8466
+D-19.4303C1.9464Z13.0604
+G20C16.4007Y-9.9266B-3.2395Z-10.3784D-1.6736
+G21
+C-14.3376F2252
+M5Z-16.0902Y-12.3478B15.7605C-6.9755
+G91C-2.0989
+M3C15.3133X6.7789A8.6448
+A-12.1702B8.8860C2.1620F3357Y-2.7391
+D-14.0253Z-14.8178X-18.4165
+C-9.4220A-9.5779Y15.8114Z-19.3267D-19.5381
+C-2.1725Y-12.7542
+M5X0.2262A-2.1178
+M5Y15.2771X-10.8174N87192A19.5775D5.0179
+Z18.4715F3563C18.6267X-1.6219D-5.7366S2284Y-2.1670
+M5A18.3055Y-8.0142X3.4720C15.7120
+Y12.9943
+C-18.7536F5423N2469D-5.5717
+M5A1.0396Y17.3002
+B-18.1301A16.4187D3.9882
+A-11.2923D-1.3641
+G1Y-1.6412C-11.6065
+G1D-19.8564B15.9082X12.8087
+M3Y-7.0181B-19.5311D-17.4009N56105X-15.1636Z-4.0696
+M5Y-9.3709X17.4236A-5.0660
+G91X17.3386A14.7792F3699
+D16.2504A-11.6851Y2.2929Z-13.3067
+G90Y-9.6657X-16.3562
+G91Y0.1358B-9.1592C-4.0097X18.7074
+B-4.3392
+G20F2514Z13.0158X-13.9173D11.0745
+G21
+G90F3235Z-17.1859C-11.0567
+F2933B-12.2354Z-3.5276
+G21D10.6343A-8.3156F3905Z-4.1457C-0.1722
+G1B-4.2616F3611D-17.9264X-11.0670C18.9648
+G91A9.0151F2320X6.0987
+G90B16.7803F3682A-1.0614X12.8629C-5.4300
+Y9.8915A-9.1074D8.6654X16.8031N99044
+G21F5287A-9.9581
+G91C-13.6025X14.4497
+G0A-0.0610Z-16.6367D-3.3264
+Y9.5227Z-10.1028D-4.1572A-13.8671X2.6754
+G90C-12.4171B-8.2529
+A5.4983S1666C-18.5018D-18.2333
+G0Y-18.7413S1340F4187
+G91C10.6665Z9.8135
+D-19.4066
+G1C-4.6506B-13.1286A-6.0822
+G91Y16.1688X17.0467B11.4330C-3.8206
+M3X-14.0213A15.3545
+G90D4.7557
+M3F2533B12.0913S2570A-5.6570
+C19.2691Y14.2828
+G1D18.5731Z-7.0464
+M5D14.3316A-6.8870C10.7306B11.6850X-12.0423
+M5A10.5856Y19.6199D12.7930C9.7438
+G20X-14.0254C-10.9096F2010
+G21
+G21D5.5284Z4.9572C-14.0275X3.3436B17.4636
+S859N72210B16.1401C1.2611
+G20D5.0386
+G21
+G0D-18.4473X13.7773C-15.7887
+F4078C17.1428S2132
+Z-10.4333Y15.2066
+C16.4316D-18.9239F5804A-11.5214
+C12.7025S3144B3.6189
+G1D11.6787X17.9701A10.0571
+G20S4248X-8.6963Z-7.1669F3691
+G21
+G21F3424D10.0207B-2.5577
+M5C5.4613D11.5166Y17.7548X13.2734Z-11.4114
+G90Y-11.7553X15.5380B15.3591C-1.5637Z16.0486
+M5C-1.5193Z-2.4481
+G0D-4.6307C18.4954X-10.0968Y0.8872Z-6.8770A19.0059
+X-4.4664Y-4.0392F4472N31756
+G91D-2.6988C-12.7398
+Z-3.0568
+G91X-0.4064Z1.7344D2.9824A11.2717
+A0.5517
+A-9.3937B9.6588X-3.2567
+G90Z5.6880Y11.9357C6.6415
+A-19.8922X14.0268C-10.2013D-0.8180Y-4.9541Z-2.9558
+C-19.5408A13.2531
+G90F5693X-1.9216Z-3.9006
+M5F4019D-10.6330
+G91B13.6307
+B-18.1652S3966Z-5.5850
+G90Z14.4676D-2.5924A-1.0187
+G91D-7.3162Z0.2570
+G21A-7.9837B-12.4024
+G1A-18.4210X6.9480D6.5448
+G21C2.6533B-18.6304Y-7.6262
+G91D10.7955S3868Z7.1985
+G90C9.3423Y18.6539A-19.2889Z14.7820X7.3504D-17.9945
+G21A-18.7213B15.3333
+G0X-5.2974C5.7955B11.8944
+G91D-13.9552X4.8739
+G1X-4.9520B-9.2791C16.8238Z-1.9492
+G91D-17.6976A11.5076
+A3.1836Y12.2630
+G20D-15.7553B-18.2162Y2.5772X8.0426
+G21
+D-16.1157C17.0198Y-11.8142
+G0Y-18.8992X19.7846Z-5.2147
+Y16.8354D17.6685S4528B-10.5949A13.9878X-10.6717
+G90Y9.9289D-4.3981X-19.7689
+G90N9850Y-18.5595A17.3591D-2.1102F5804
+G90D-18.9832Y9.4425X-5.3587C-3.2695Z-1.9449
+D-5.4288B-0.9018Z15.8015C-9.6883Y19.1449
+A-14.3943X9.0589Z12.2809B13.2898D-2.5900Y19.1452
+C-14.5184
+G21A12.4259F5728X9.3086B13.6763
+G0Z3.7958Y-13.4605A0.7929D8.5836
+G0D18.6971
+M5B13.4933Z17.0525
+M5X-9.0795B-15.1383
+G1D-5.4698X17.9278Y5.3997C18.8197
+D-2.6784A-3.1146C1.2319S1142
+G21C0.8122Z1.6902X5.6630Y7.1376
+G0A3.6099
+G0X-16.4861D8.4144
+G20Y1.8366S178D15.1349B18.0831A16.9677C-6.9809X-6.6533
+G21
+G0D7.0138Z-10.9933C-6.5194X-2.4041
+G21A14.8330B10.6271
+Y-1.9087D-7.1202B-4.3726
+C18.7580A-10.7225
+G1X2.5974
+M5X7.0491Z-17.2692A-3.6192F2770
+M3Z-7.2769D15.7804
+S3370N364A-12.7036X-8.4029D19.7500
+G20B5.8725Z-0.0855
+G21
+Y-15.9959D-19.5003Z0.8998
+G1D10.5622F2223C-11.1981A-12.3339X5.1479
+X14.6795A15.4733C7.0913
+G0B2.4614F2504Y-13.0613C1.3500Z-12.5379D-3.8722
+M5B1.7946X-2.5769Y-18.9886A-14.8054
+G20A-0.9618B14.3356
+G21
+B10.8698X4.3281C6.3009N23205Z0.5211Y14.8956
+G1C-3.8649B8.6677Y0.0146A-10.9430Z-17.3636
+G91F2471Z-3.4972D5.1531C13.8686
+B13.5786Y-7.8770A5.5326X-13.5195Z-18.4306
+M5C-7.2579
+G20X9.9025Z-16.4027
+G21
+G20B10.4769X7.9302C8.1096
+G21
+G21Y-6.1108A7.4493X18.5443F4832Z5.4602
+Y12.6157B6.6613
+D-13.2762Y-8.7647F2044Z8.0650X-11.7427B-7.0212
+C-8.5611B-5.6282
+Y-4.1891F4944Z-5.2845
+G0B-17.6911Y-10.7910Z16.7885N28369C12.1114
+G21A5.4702Z-10.9000
+G91D-2.4523A6.4650
+Z-12.1834X-2.2738A-7.0522
+M5Y6.3374B6.2599C14.6105
+Y3.2307X6.4193D15.5997C-15.4299
+G90A2.9083D-3.6789B0.5274Y-0.4289F3800
+M5D-10.5239Y-13.1498C11.0466S4868
+X16.3414Y19.5448B-5.3207S2094Z-15.4116
+G20Z4.1221B-5.8258D19.5493A16.4092Y-5.7704
+G21
+G20C19.8907N19783
+G21
+G1Z4.8168Y13.4863
+M3F4372X-11.3474B-1.2896D-5.8527A-13.2109
+N26115A2.7584Y-9.0665X6.8390F4296
+A10.5333
+M3
+G21B-7.9404A-13.2432C9.0662
+Z10.9776N21569X3.2192C-0.6194
+G1Z0.0766B-14.8394N35472A-10.3306X-2.0833C-17.0622
+X9.9730D5.0524B-17.7021
+M3Z-3.3946X-7.3243D1.1793C-19.2559
+G20Z4.7470C5.8923
+G21
+G20A12.3679C5.1562Y-9.8834
+G21
+G91B9.5099A-14.0274Z17.5899D-18.8383
+A5.8184D2.5680Y16.1400Z9.3354
+C2.7809Y-11.8718X-2.6482D14.5228B19.7725
+G90Z7.3109
+Z-19.0230C9.4406X14.5587A18.9735B16.4643S2781D-13.2503
+M3D15.1429B-19.2026F3996A-2.7801Z0.1912
+C-11.3945Z-5.8571
+G91X-17.2432Y0.3501B-19.5764
+G0Z-13.9505
+G20C4.8333D8.6564
+G21
+G91D1.8472
+G20X-17.4353Z6.3840B11.8927
+G21
+G1F4710C-5.3683B-11.8063A10.2903
+M5F3620B12.1285A-15.8879Z-13.8462
+G0C-4.7547Z7.2072A0.8278S1461B-5.1690D-11.9659
+G91Y5.4457D-18.2440A-3.0742
+C18.8551Z-4.5857
+Y1.0326C3.7111
+G91S2408
+M3A-16.4700Y-11.1717N90572Z12.6992D7.2393
+G0X-6.6266A-9.5063N39910B-9.7990Z19.5472
+N8865Z-1.4310X-17.9157C12.0580S2574D16.7751
+S3553Y8.4222
+M5A8.8511C-11.1678X15.1974
+X-15.9655C16.2351F2232Y11.3701
+G91B-9.6784D17.8223
+G1D-5.9273B-6.6727A-14.0431X-8.3576
+A-8.8000D-1.1818X11.2583B3.3564
+B9.6941X17.7760S4518C11.5090D-17.2230Z-6.6746
+G0X3.1695C9.1050N649
+M5C1.4187B-1.2874X-16.2395Z-0.1548
+A17.7325
+G21C6.5556D-10.2576B2.7925
+Z-7.8557X-16.0770A10.3662S2005Y10.9142C-7.3009
+M3Y19.0391X-11.2143
+M5X-5.3755
+G0
+G20B11.3262
+G21
+B11.3537X-0.2952
+G1D-15.5761Z3.7946C-0.4379
+G91A-6.5671Y-4.2452C15.5822
+A-11.0320Y-9.1408
+X-19.6377Z-10.1651
+M3D6.4466A4.9607
+G1Z13.3926Y19.0479
+G91Z-12.4936Y17.4624D3.5829
+G20D16.1138Z18.0008
+G21
+G90X-14.4046D18.6770B-7.5211A9.5338C-8.0947
+Z-7.2150C17.0320
+G90X10.2831C-5.4903
+M3B-10.2650C1.9418A17.5969Y13.0658
+M3D-0.0075Z-3.8467X8.9168
+B-19.8757Y-11.4779D-2.6979
+G21C-8.5006Y-15.0023Z-18.6611X13.9870
+Y7.0404D-19.8628B7.9774C13.5438X-11.0453
+D2.2641A17.4509
+G1A5.2004Y0.1868
+A-1.8412Y19.4501Z-0.8849
+B-9.3757A8.1495
+X-3.2834
+G20Y15.9594B-15.7320X-12.9931C11.0988
+G21
+Z-9.9224A16.3548
+C11.2148X-15.5548A12.5281D2.9134
+G91A-12.0038N94958Y-15.8393X16.2318
+N31273F4039
+G20B-16.2481F2199X11.5221
+G21
+G20A10.2848B18.9261F4097Z-13.8635D12.2826
+G21
+G20Y2.4650
+G21
+G0C-2.8381N95705D19.0582Y13.1865B6.0023
+C7.6985X10.4968B-17.0002Y4.2571
+G1Z7.2345D17.7099
+G91Y-13.4826X-4.7083
+G91C-13.5478N15972A10.8401Y1.7589D14.0559Z12.6427B-6.2951
+C10.2029
+G21C14.6497Z17.9231B18.4237A-4.3633
+A-17.0207X-4.3548Y9.1839
+M3D-11.7579Z19.5722X-4.2087
+G0D-0.7443C-9.4781X4.9955Z-16.4206S2080
+G1Z8.9057A11.5192D-10.0683B-5.3508Y18.5231X14.1020
+X15.7149Z-4.9035A-8.7264D2.2119Y-19.6984
+G91Y-1.2333B-11.1038X-17.2838
+G90N36782A-16.6768F3855Y-13.1740B16.9638
+X0.3815D5.9371
+X15.4789D-1.6606Y-18.3299
+G0A-13.3927Y-7.4390B-0.6316C-5.0515Z-17.3507
+B6.7467A-3.7208Z18.4485F4488D13.1211C-5.0421
+M5D-3.0862F5356Y-3.3590B-7.1513
+G90Z-19.2997Y16.5910A-8.4412
+M3X6.3249C-16.9591
+G90A9.6512X-5.3493S3894
+G1Z-2.7744B-3.6353
+G90Z-14.5602X-11.0972Y-9.3589C3.2941
+A-15.3143D-10.0571C2.0093
+N622C-19.3998
+Y-10.8012B-15.4309Z8.4440S2858F3373
+B14.7244Y-9.3777Z-17.9069D4.2070C0.0704
+X-17.1138Z-13.9100
+Y13.5978X17.3436D-17.7167S4200
+X-7.5545Z-13.7062A10.8530
+G21Z-10.5462C11.4006B-18.7909Y-8.2615A5.1775
+M3Z-7.2704D-2.1262Y6.7413X-0.6589
+M5C6.3051B7.3624Y14.3282
+G90Y-8.4788B-13.4407X18.5409F2711A-15.7380
+M5Y-9.6172
+G21F4100X11.4957
+G0N4918Z-12.4991X-13.0876F5126
+M5Z-8.6416Y4.7132B7.0315
+G1A-10.4080Y0.1820Z-2.5203X-13.9786D15.8354F3309
+D15.4646C-17.4393S3031N8868
+G90A5.5453D-6.2015Z-0.9341
+Y18.2306Z-11.6632
+Z0.9472C-11.1069
+G21B1.8747A9.2882X8.3942F5918Z-7.9294
+X16.9593Y-19.0631
+G20D-19.7731Z-8.9595
+G21
+G90Y4.1169X0.6672A3.4204
+C-1.6012Z-17.2146
+G90C-8.1546X14.7711Y-2.5608Z5.3998B3.5893
+G1C-2.9933Z8.0536D7.6281Y-13.2324
+G1C6.0958F4811
+G21G90
+$#
+$G
@@ -0,0 +1,19 @@
+G21G90G94G17
+G0X0Y0Z10
+F300
+G98G81X10Y10R2Z-5
+X20
+Y20
+G99G82X30Y30R1Z-4P0.2
+G83X40Y10R2Z-6Q2.5
+G73X50Y10R2Z-3Q1
+G91G98G81X5Y0R-8Z-4L3
+G90G80
+G0Z10
+$G
+G81X1Y1
+G81X1Y1R1Z2
+G81X1A1R1Z-2
+G83X1Y1R1Z-2
+G80X1
+M2
@@ -0,0 +1,23 @@
+G21 G90 G94
+G1X1.2.3F100
+G1X-
+G1X--1
+G1 X+1 F100
+G0X.5
+G0X.
+G1X1Y
+1X
+G1 X1 X2
+N5G1X2F200
+G4P0.01
+$G
+G0 X0 Y0
+G0 G90 G21 G17 G40 G49 G94 G54 M5 M9 X1 Y1 Z1 A1 B1 C1 D1 F100 N7 G0 G90 G21 G17 G40 G49 G94 G54 M5 M9 X1 Y1 Z1 A1 B1 C1
+G0 G90 G21 G17 G40 G49 G94 G54 M5 M9 X1 Y1 Z1 A1 B1 C1 D1 F100 N7 G0 G90 G21 G17 G40 G49 G94 G54 M5 M9 X1 Y1 Z1 A1 B1 C1 (x
+G90 G21 G17 G40 G49 G94 G54 M5 M9 X2 Y1 Z1 A1 B1 C1 D1 F100 N8 S100 (comment) G1 ; tail
+G1 X3 Y-0.0001 F+100.5
+g1 x1.5 y.25
+G1X1Q
+G1X1%
+G4P0
+$J=G91X1F100
@@ -0,0 +1,5 @@
+$M0=G90G2X100Y0I50J0F3000|G1Y20
+M98P0
+G1X0Y0
+$M0=
+M2
@@ -0,0 +1,1505 @@
+$120=50
+$121=50
+$11=0.2
+G21G90G94
+F1500
+G1X1.000Y-0.000
+G1X1.100Y-0.001
+G1X1.645Y-0.839
+G1X1.673Y-0.881
+G1X1.727Y-0.965
+G1X1.886Y-1.219
+G1X0.617Y-3.938
+G1X0.652Y-4.031
+G1X1.747Y-6.824
+G1X2.109Y-7.757
+G1X2.144Y-7.850
+G1X2.163Y-7.896
+G1X2.183Y-7.942
+G1X2.309Y-8.215
+G1X3.545Y-10.948
+G1X3.586Y-11.039
+G1X3.998Y-11.950
+G1X5.236Y-14.683
+G1X5.648Y-15.594
+G1X6.836Y-18.349
+G1X6.959Y-18.623
+G1X6.994Y-18.659
+G1X7.687Y-19.379
+G1X8.389Y-20.092
+G1X11.189Y-21.168
+G1X11.282Y-21.204
+G1X11.328Y-21.223
+G1X14.109Y-22.349
+G1X16.891Y-23.473
+G1X19.696Y-24.536
+G1X20.635Y-24.880
+G1X23.470Y-25.862
+G1X26.305Y-26.842
+G1X27.258Y-27.146
+G1X27.353Y-27.176
+G1X27.639Y-27.268
+G1X30.471Y-28.257
+G1X31.417Y-28.582
+G1X31.512Y-28.613
+G1X31.559Y-28.629
+G1X31.844Y-28.722
+G1X31.885Y-28.693
+G1X31.931Y-28.713
+G1X32.207Y-28.832
+G1X32.482Y-28.950
+G1X32.756Y-29.073
+G1X33.028Y-29.200
+G1X33.298Y-29.330
+G1X33.566Y-29.466
+G1X33.655Y-29.511
+G1X36.307Y-30.914
+G1X37.202Y-31.360
+G1X37.246Y-31.383
+G1X37.333Y-31.432
+G1X38.205Y-31.921
+G1X40.800Y-33.427
+G1X40.844Y-33.452
+G1X41.104Y-33.601
+G1X41.364Y-33.751
+G1X41.406Y-33.777
+G1X41.667Y-33.926
+G1X41.753Y-33.977
+G1X41.796Y-34.003
+G1X44.390Y-35.508
+G1X47.021Y-36.951
+G1X49.675Y-38.348
+G1X49.940Y-38.490
+G1X50.884Y-38.821
+G1X51.827Y-39.152
+G1X52.110Y-39.251
+G1X52.393Y-39.352
+G1X52.563Y-39.599
+G1X52.620Y-39.682
+G1X52.647Y-39.723
+G1X52.820Y-39.969
+G1X54.588Y-42.393
+G1X54.649Y-42.472
+G1X54.618Y-42.567
+G1X54.590Y-42.663
+G1X53.720Y-45.534
+G1X53.631Y-45.821
+G1X52.701Y-48.673
+G1X52.402Y-49.627
+G1X52.387Y-49.675
+G1X52.086Y-50.628
+G1X52.057Y-50.724
+G1X51.776Y-51.684
+G1X51.240Y-54.636
+G1X51.055Y-54.871
+G1X50.453Y-55.670
+G1X50.422Y-55.709
+G1X50.390Y-55.748
+G1X50.340Y-55.751
+G1X47.352Y-56.014
+G1X47.252Y-56.020
+G1X47.202Y-56.023
+G1X44.210Y-56.245
+G1X43.911Y-56.264
+G1X43.811Y-56.269
+G1X43.761Y-56.270
+G1X40.765Y-56.425
+G1X39.766Y-56.471
+G1X37.929Y-58.843
+G1X37.866Y-58.921
+G1X36.015Y-61.282
+G1X35.830Y-61.518
+G1X35.645Y-61.754
+G1X35.458Y-61.989
+G1X35.451Y-62.038
+G1X35.438Y-62.137
+G1X35.395Y-62.434
+G1X35.011Y-65.410
+G1X34.969Y-65.707
+G1X34.572Y-68.680
+G1X34.506Y-68.756
+G1X34.473Y-68.793
+G1X34.438Y-68.829
+G1X33.763Y-69.567
+G1X33.730Y-69.605
+G1X33.698Y-69.643
+G1X33.634Y-69.719
+G1X33.447Y-69.954
+G1X31.604Y-72.321
+G1X31.544Y-72.401
+G1X31.367Y-72.644
+G1X29.617Y-75.080
+G1X29.560Y-75.162
+G1X29.502Y-75.244
+G1X29.517Y-75.343
+G1X29.638Y-76.335
+G1X30.011Y-79.312
+G1X30.018Y-79.362
+G1X30.053Y-79.660
+G1X30.186Y-80.651
+G1X30.219Y-80.949
+G1X30.230Y-81.048
+G1X30.360Y-82.040
+G1X30.366Y-82.090
+G1X30.628Y-85.078
+G1X30.736Y-86.072
+G1X30.747Y-86.172
+G1X30.862Y-87.165
+G1X30.900Y-87.463
+G1X30.944Y-87.759
+G1X30.951Y-87.809
+G1X30.993Y-88.106
+G1X31.008Y-88.205
+G1X31.499Y-91.164
+G1X31.673Y-92.149
+G1X32.251Y-95.093
+G1X32.270Y-95.191
+G1X32.848Y-98.135
+G1X33.054Y-99.113
+G1X33.120Y-99.406
+G1X33.827Y-102.322
+G1X33.837Y-102.370
+G1X33.903Y-102.663
+G1X33.923Y-102.761
+G1X33.933Y-102.810
+G1X34.158Y-103.785
+G1X34.403Y-104.754
+G1X34.427Y-104.851
+G1X34.451Y-104.948
+G1X34.692Y-105.919
+G1X34.767Y-106.209
+G1X34.780Y-106.257
+G1X35.570Y-109.151
+G1X37.097Y-111.734
+G1X37.146Y-111.821
+G1X37.296Y-112.081
+G1X37.808Y-112.940
+G1X37.860Y-113.025
+G1X37.886Y-113.068
+G1X38.414Y-113.917
+G1X38.442Y-113.959
+G1X40.099Y-116.459
+G1X40.155Y-116.542
+G1X40.253Y-116.826
+G1X41.251Y-119.655
+G1X41.565Y-120.604
+G1X41.660Y-120.889
+G1X41.986Y-121.835
+G1X42.332Y-122.773
+G1X42.428Y-123.057
+G1X43.425Y-125.886
+G1X44.485Y-128.693
+G1X44.590Y-128.974
+G1X45.629Y-131.788
+G1X45.976Y-132.726
+G1X46.087Y-133.005
+G1X46.106Y-133.051
+G1X46.222Y-133.328
+G1X46.260Y-133.420
+G1X46.381Y-133.695
+G1X47.629Y-136.423
+G1X48.591Y-136.697
+G1X48.687Y-136.724
+G1X48.783Y-136.753
+G1X51.638Y-137.672
+G1X51.688Y-137.679
+G1X51.737Y-137.684
+G1X51.837Y-137.694
+G1X52.135Y-137.727
+G1X52.234Y-137.739
+G1X52.284Y-137.746
+G1X54.824Y-136.150
+G1X57.367Y-134.558
+G1X59.938Y-133.011
+G1X60.023Y-132.959
+G1X60.880Y-132.443
+G1X61.134Y-132.283
+G1X63.693Y-130.718
+G1X63.735Y-130.691
+G1X64.568Y-130.138
+G1X64.652Y-130.083
+G1X64.736Y-130.029
+G1X67.261Y-128.409
+G1X69.766Y-126.759
+G1X69.850Y-126.704
+G1X70.696Y-126.172
+G1X70.780Y-126.117
+G1X71.035Y-125.958
+G1X71.334Y-125.961
+G1X71.434Y-125.965
+G1X71.475Y-125.936
+G1X71.516Y-125.908
+G1X73.988Y-124.207
+G1X74.234Y-124.035
+G1X74.274Y-124.006
+G1X75.096Y-123.435
+G1X75.179Y-123.380
+G1X77.691Y-121.739
+G1X77.944Y-121.579
+G1X78.028Y-121.525
+G1X78.071Y-121.499
+G1X78.931Y-120.989
+G1X79.018Y-120.939
+G1X79.104Y-120.888
+G1X79.972Y-120.391
+G1X80.015Y-120.366
+G1X80.058Y-120.342
+G1X80.101Y-120.316
+G1X80.194Y-120.354
+G1X80.227Y-120.392
+G1X80.866Y-121.161
+G1X80.931Y-121.237
+G1X81.124Y-121.466
+G1X81.189Y-121.542
+G1X83.151Y-123.812
+G1X85.103Y-126.090
+G1X85.304Y-126.312
+G1X87.317Y-128.537
+G1X87.520Y-128.758
+G1X87.554Y-128.794
+G1X87.625Y-128.865
+G1X87.783Y-129.853
+G1X87.790Y-129.902
+G1X88.198Y-132.874
+G1X88.206Y-132.924
+G1X88.219Y-133.023
+G1X88.370Y-134.011
+G1X88.380Y-134.060
+G1X88.438Y-134.355
+G1X88.423Y-134.655
+G1X88.354Y-135.652
+G1X88.339Y-135.952
+G1X90.191Y-138.312
+G1X90.374Y-138.550
+G1X92.190Y-140.937
+G1X92.780Y-141.745
+G1X94.558Y-144.162
+G1X94.736Y-144.403
+G1X95.317Y-145.217
+G1X95.487Y-145.464
+G1X95.650Y-145.716
+G1X95.816Y-145.966
+G1X95.979Y-146.218
+G1X97.643Y-148.714
+G1X97.582Y-149.008
+G1X97.518Y-149.301
+G1X97.454Y-149.594
+G1X97.261Y-150.575
+G1X96.748Y-153.531
+G1X96.179Y-156.477
+G1X96.127Y-156.772
+G1X96.079Y-157.068
+G1X96.038Y-157.365
+G1X95.996Y-157.662
+G1X95.980Y-157.761
+G1X95.963Y-157.860
+G1X95.775Y-158.842
+G1X95.766Y-158.891
+G1X95.757Y-158.940
+G1X95.173Y-161.883
+G1X95.162Y-161.932
+G1X95.139Y-162.029
+G1X94.436Y-164.946
+G1X94.371Y-165.238
+G1X94.140Y-166.211
+G1X93.928Y-167.189
+G1X93.906Y-167.286
+G1X93.844Y-167.580
+G1X93.148Y-170.498
+G1X92.916Y-171.471
+G1X92.944Y-174.471
+G1X92.945Y-174.521
+G1X92.946Y-174.570
+G1X92.948Y-174.620
+G1X93.084Y-177.617
+G1X93.259Y-180.612
+G1X93.285Y-180.911
+G1X93.544Y-183.900
+G1X93.572Y-184.199
+G1X93.646Y-185.196
+G1X93.653Y-185.296
+G1X93.704Y-186.294
+G1X93.720Y-186.594
+G1X93.723Y-186.644
+G1X93.726Y-186.694
+G1X93.745Y-186.993
+G1X93.769Y-187.292
+G1X93.867Y-188.287
+G1X93.871Y-188.337
+G1X93.904Y-188.635
+G1X93.939Y-188.933
+G1X94.267Y-191.915
+G1X94.299Y-192.214
+G1X94.419Y-193.206
+G1X94.556Y-194.197
+G1X94.567Y-194.296
+G1X94.572Y-194.346
+G1X94.576Y-194.396
+G1X94.581Y-194.446
+G1X94.597Y-194.493
+G1X94.693Y-194.777
+G1X94.723Y-194.817
+G1X94.754Y-194.857
+G1X94.815Y-194.936
+G1X94.847Y-194.974
+G1X94.878Y-195.013
+G1X95.499Y-195.798
+G1X96.119Y-196.582
+G1X96.151Y-196.620
+G1X96.215Y-196.697
+G1X98.104Y-199.028
+G1X99.992Y-201.359
+G1X101.915Y-203.662
+G1X101.947Y-203.700
+G1X102.142Y-203.928
+G1X102.342Y-204.152
+G1X102.594Y-204.315
+G1X102.678Y-204.368
+G1X102.763Y-204.422
+G1X102.846Y-204.478
+G1X102.887Y-204.505
+G1X102.971Y-204.560
+G1X103.803Y-205.116
+G1X103.885Y-205.172
+G1X103.968Y-205.228
+G1X104.051Y-205.284
+G1X104.884Y-205.838
+G1X105.129Y-206.009
+G1X105.210Y-206.068
+G1X105.453Y-206.245
+G1X105.699Y-206.416
+G1X105.740Y-206.445
+G1X105.823Y-206.501
+G1X106.072Y-206.668
+G1X106.113Y-206.697
+G1X106.195Y-206.754
+G1X106.310Y-207.031
+G1X106.703Y-207.950
+G1X106.708Y-208.050
+G1X106.715Y-208.150
+G1X106.717Y-208.200
+G1X106.983Y-208.339
+G1X107.027Y-208.362
+G1X107.897Y-208.856
+G1X107.985Y-208.904
+G1X108.017Y-208.942
+G1X108.049Y-208.980
+G1X108.115Y-209.056
+G1X108.785Y-209.798
+G1X111.125Y-211.676
+G1X111.902Y-212.305
+G1X112.132Y-212.497
+G1X114.391Y-214.472
+G1X115.134Y-215.140
+G1X117.314Y-217.201
+G1X118.042Y-217.887
+G1X118.263Y-218.090
+G1X118.553Y-218.014
+G1X121.442Y-217.205
+G1X121.733Y-217.131
+G1X121.781Y-217.119
+G1X121.879Y-217.099
+G1X122.171Y-217.031
+G1X122.269Y-217.010
+G1X123.247Y-216.802
+G1X123.345Y-216.779
+G1X126.256Y-216.057
+G1X126.305Y-216.045
+G1X127.273Y-215.795
+G1X127.321Y-215.781
+G1X130.196Y-214.922
+G1X130.484Y-214.840
+G1X130.532Y-214.826
+G1X130.564Y-214.788
+G1X132.462Y-212.464
+G1X132.651Y-212.231
+G1X134.513Y-209.879
+G1X135.127Y-209.090
+G1X137.001Y-206.747
+G1X137.188Y-206.512
+G1X137.220Y-206.474
+G1X137.413Y-206.244
+G1X137.445Y-206.206
+G1X137.638Y-205.976
+G1X138.269Y-205.200
+G1X140.193Y-202.899
+G1X140.226Y-202.861
+G1X140.898Y-202.120
+G1X140.931Y-202.083
+G1X140.999Y-202.010
+G1X141.066Y-201.935
+G1X141.134Y-201.862
+G1X141.200Y-201.786
+G1X141.861Y-201.036
+G1X141.926Y-200.961
+G1X141.959Y-200.923
+G1X142.024Y-200.846
+G1X142.056Y-200.808
+G1X142.120Y-200.732
+G1X144.058Y-198.442
+G1X144.124Y-198.366
+G1X144.156Y-198.328
+G1X144.829Y-197.588
+G1X144.895Y-197.513
+G1X144.929Y-197.476
+G1X145.607Y-196.741
+G1X145.809Y-196.519
+G1X147.874Y-194.343
+G1X147.941Y-194.269
+G1X148.010Y-194.197
+G1X150.043Y-191.991
+G1X152.053Y-189.764
+G1X152.120Y-189.689
+G1X154.130Y-187.462
+G1X156.153Y-185.247
+G1X156.157Y-185.197
+G1X156.162Y-185.147
+G1X155.550Y-184.357
+G1X153.725Y-181.976
+G1X153.541Y-181.738
+G1X151.691Y-179.376
+G1X151.073Y-178.591
+G1X150.441Y-177.815
+G1X150.379Y-177.737
+G1X150.317Y-177.659
+G1X150.130Y-177.424
+G1X149.948Y-177.185
+G1X148.142Y-174.790
+G1X148.083Y-174.709
+G1X148.055Y-174.668
+G1X147.997Y-174.587
+G1X147.938Y-174.506
+G1X147.349Y-173.697
+G1X147.321Y-173.656
+G1X147.292Y-173.615
+G1X147.235Y-173.533
+G1X145.563Y-171.042
+G1X144.988Y-170.224
+G1X144.425Y-169.398
+G1X144.367Y-169.316
+G1X143.806Y-168.489
+G1X143.642Y-168.237
+G1X143.480Y-167.985
+G1X143.452Y-167.943
+G1X143.285Y-167.694
+G1X143.123Y-167.442
+G1X143.097Y-167.399
+G1X141.536Y-164.837
+G1X140.016Y-162.251
+G1X139.963Y-162.166
+G1X138.402Y-159.604
+G1X138.243Y-159.349
+G1X138.190Y-159.265
+G1X137.647Y-158.425
+G1X137.621Y-158.382
+G1X136.007Y-155.853
+G1X135.841Y-155.604
+G1X135.676Y-155.353
+G1X135.620Y-155.270
+G1X135.593Y-155.228
+G1X133.999Y-152.687
+G1X133.946Y-152.602
+G1X133.906Y-152.572
+G1X133.825Y-152.513
+G1X133.744Y-152.454
+G1X133.502Y-152.278
+G1X131.090Y-150.494
+G1X131.049Y-150.465
+G1X131.009Y-150.435
+G1X130.930Y-150.373
+G1X130.128Y-149.776
+G1X127.717Y-147.991
+G1X125.261Y-146.268
+G1X124.438Y-145.700
+G1X124.397Y-145.671
+G1X123.567Y-145.114
+G1X123.404Y-144.862
+G1X121.770Y-142.346
+G1X120.164Y-139.812
+G1X119.617Y-138.975
+G1X119.590Y-138.933
+G1X117.997Y-136.391
+G1X117.843Y-136.134
+G1X116.321Y-133.549
+G1X116.308Y-133.500
+G1X115.516Y-130.607
+G1X114.724Y-127.713
+G1X114.852Y-127.442
+G1X116.190Y-124.757
+G1X116.329Y-124.491
+G1X116.469Y-124.226
+G1X117.823Y-121.549
+G1X117.867Y-121.459
+G1X118.320Y-120.567
+G1X119.666Y-117.886
+G1X119.675Y-117.586
+G1X119.820Y-114.590
+G1X119.826Y-114.490
+G1X119.806Y-114.444
+G1X119.768Y-114.352
+G1X119.659Y-114.072
+G1X118.601Y-111.265
+G1X118.496Y-110.984
+G1X118.398Y-110.700
+G1X117.467Y-107.848
+G1X116.028Y-105.216
+G1X115.978Y-105.130
+G1X114.461Y-102.541
+G1X113.946Y-101.684
+G1X113.451Y-100.816
+G1X113.296Y-100.559
+G1X113.269Y-100.516
+G1X113.218Y-100.431
+G1X113.192Y-100.388
+G1X111.587Y-97.853
+G1X110.044Y-95.281
+G1X109.992Y-95.195
+G1X109.486Y-94.332
+G1X108.027Y-91.711
+G1X107.878Y-91.451
+G1X106.382Y-88.850
+G1X106.358Y-88.806
+G1X104.906Y-86.181
+G1X104.401Y-85.318
+G1X104.248Y-85.060
+G1X103.174Y-82.259
+G1X102.034Y-79.484
+G1X100.886Y-76.712
+G1X99.724Y-73.946
+G1X98.523Y-71.197
+G1X97.275Y-68.469
+G1X96.846Y-67.566
+G1X96.721Y-67.293
+G1X95.896Y-66.728
+G1X93.435Y-65.012
+G1X93.187Y-64.843
+G1X92.357Y-64.285
+G1X92.317Y-64.256
+G1X92.275Y-64.228
+G1X92.234Y-64.200
+G1X91.990Y-64.024
+G1X91.949Y-63.996
+G1X91.909Y-63.967
+G1X91.868Y-63.938
+G1X91.042Y-63.375
+G1X90.960Y-63.317
+G1X88.483Y-61.625
+G1X87.663Y-61.052
+G1X86.842Y-60.481
+G1X86.759Y-60.425
+G1X86.718Y-60.397
+G1X86.635Y-60.340
+G1X84.165Y-58.639
+G1X83.913Y-58.475
+G1X83.617Y-58.430
+G1X83.518Y-58.414
+G1X80.800Y-57.144
+G1X79.888Y-56.735
+G1X77.144Y-55.522
+G1X76.867Y-55.406
+G1X76.821Y-55.387
+G1X76.729Y-55.348
+G1X76.451Y-55.234
+G1X76.405Y-55.216
+G1X73.611Y-54.122
+G1X73.565Y-54.103
+G1X73.519Y-54.083
+G1X73.473Y-54.063
+G1X73.080Y-51.089
+G1X72.642Y-48.121
+G1X72.686Y-48.031
+G1X74.001Y-45.335
+G1X74.046Y-45.246
+G1X75.460Y-42.600
+G1X75.608Y-42.339
+G1X75.660Y-42.253
+G1X75.713Y-42.168
+G1X75.740Y-42.127
+G1X75.823Y-42.070
+G1X75.911Y-42.024
+G1X76.211Y-42.013
+G1X76.279Y-42.086
+G1X76.313Y-42.123
+G1X76.304Y-42.172
+G1X76.345Y-42.263
+G1X77.600Y-44.988
+G1X77.620Y-45.034
+G1X77.746Y-45.306
+G1X78.996Y-48.033
+G1X79.017Y-48.079
+G1X79.430Y-48.989
+G1X80.728Y-51.694
+G1X81.148Y-52.602
+G1X81.275Y-52.874
+G1X81.690Y-53.783
+G1X82.097Y-54.697
+G1X82.217Y-54.972
+G1X83.429Y-57.716
+G1X83.816Y-58.638
+G1X83.853Y-58.731
+G1X83.910Y-58.813
+G1X84.081Y-59.060
+G1X84.640Y-59.888
+G1X85.194Y-60.721
+G1X85.364Y-60.968
+G1X85.210Y-63.964
+G1X85.126Y-64.018
+G1X84.875Y-64.183
+G1X82.403Y-65.882
+G1X82.157Y-66.054
+G1X81.328Y-66.614
+G1X78.348Y-66.956
+G1X78.298Y-66.963
+G1X78.001Y-67.007
+G1X77.952Y-67.014
+G1X74.975Y-67.384
+G1X74.900Y-67.318
+G1X74.674Y-67.120
+G1X74.451Y-66.919
+G1X72.223Y-64.911
+G1X71.467Y-64.256
+G1X69.207Y-62.284
+G1X68.981Y-62.086
+G1X68.751Y-61.893
+G1X68.674Y-61.830
+G1X67.917Y-61.176
+G1X67.695Y-60.975
+G1X67.667Y-60.879
+G1X67.611Y-60.795
+G1X67.584Y-60.753
+G1X65.918Y-58.259
+G1X66.021Y-57.977
+G1X66.370Y-57.040
+G1X68.383Y-54.816
+G1X68.587Y-54.595
+G1X69.263Y-53.858
+G1X69.461Y-53.634
+G1X69.576Y-53.356
+G1X69.838Y-53.210
+G1X70.101Y-53.067
+G1X70.969Y-52.570
+G1X71.231Y-52.423
+G1X74.032Y-51.349
+G1X76.841Y-50.296
+G1X77.123Y-50.194
+G1X77.406Y-50.095
+G1X80.404Y-49.981
+G1X81.404Y-49.959
+G1X81.504Y-49.957
+G1X81.551Y-49.941
+G1X84.427Y-49.085
+G1X84.714Y-48.999
+G1X87.577Y-48.101
+G1X88.532Y-47.807
+G1X89.487Y-47.510
+G1X89.535Y-47.494
+G1X89.821Y-47.406
+G1X92.679Y-46.492
+G1X92.966Y-46.407
+G1X93.015Y-46.393
+G1X93.111Y-46.367
+G1X96.001Y-45.563
+G1X96.049Y-45.548
+G1X96.145Y-45.521
+G1X96.193Y-45.507
+G1X96.289Y-45.479
+G1X99.186Y-44.698
+G1X100.155Y-44.450
+G1X100.445Y-44.376
+G1X100.736Y-44.300
+G1X101.025Y-44.220
+G1X101.313Y-44.137
+G1X104.201Y-43.323
+G1X105.161Y-43.046
+G1X105.450Y-42.963
+G1X105.498Y-42.950
+G1X106.498Y-42.926
+G1X109.497Y-42.859
+G1X109.597Y-42.860
+G1X110.597Y-42.857
+G1X110.697Y-42.854
+G1X110.747Y-42.854
+G1X110.797Y-42.852
+G1X111.796Y-42.822
+G1X111.846Y-42.820
+G1X112.146Y-42.808
+G1X115.144Y-42.692
+G1X116.130Y-42.859
+G1X117.117Y-43.020
+G1X117.412Y-43.071
+G1X117.511Y-43.088
+G1X118.501Y-43.228
+G1X118.550Y-43.236
+G1X118.847Y-43.284
+G1X119.837Y-43.421
+G1X120.823Y-43.585
+G1X123.788Y-44.045
+G1X124.085Y-44.085
+G1X125.076Y-44.221
+G1X125.125Y-44.229
+G1X126.112Y-44.394
+G1X126.408Y-44.443
+G1X129.363Y-44.959
+G1X130.347Y-45.139
+G1X130.445Y-45.155
+G1X133.399Y-45.682
+G1X133.693Y-45.741
+G1X133.988Y-45.797
+G1X134.281Y-45.859
+G1X135.260Y-46.064
+G1X135.555Y-46.119
+G1X136.536Y-46.312
+G1X137.514Y-46.522
+G1X137.808Y-46.578
+G1X137.907Y-46.595
+G1X138.203Y-46.641
+G1X138.500Y-46.684
+G1X138.614Y-46.962
+G1X138.633Y-47.060
+G1X138.654Y-47.158
+G1X138.844Y-48.140
+G1X139.471Y-51.074
+G1X139.494Y-51.171
+G1X140.137Y-54.101
+G1X140.149Y-54.150
+G1X140.389Y-55.120
+G1X140.458Y-55.412
+G1X140.479Y-55.510
+G1X141.128Y-58.439
+G1X141.140Y-58.488
+G1X141.164Y-58.585
+G1X141.238Y-58.876
+G1X141.250Y-58.924
+G1X141.465Y-59.901
+G1X141.488Y-59.998
+G1X141.560Y-60.289
+G1X141.639Y-60.350
+G1X141.644Y-60.400
+G1X141.723Y-61.397
+G1X142.038Y-64.380
+G1X142.070Y-64.679
+G1X142.099Y-64.977
+G1X142.190Y-65.973
+G1X142.200Y-66.073
+G1X142.207Y-66.172
+G1X142.625Y-67.081
+G1X142.645Y-67.127
+G1X145.301Y-68.521
+G1X145.544Y-68.698
+G1X145.789Y-68.870
+G1X148.272Y-70.555
+G1X148.354Y-70.611
+G1X150.839Y-72.292
+G1X150.857Y-72.391
+G1X150.872Y-72.489
+G1X150.887Y-72.588
+G1X150.894Y-72.638
+G1X151.370Y-75.600
+G1X151.841Y-78.563
+G1X151.979Y-79.553
+G1X152.119Y-80.543
+G1X152.285Y-81.529
+G1X152.463Y-82.513
+G1X152.952Y-85.473
+G1X152.960Y-85.523
+G1X152.977Y-85.621
+G1X152.986Y-85.670
+G1X152.991Y-85.770
+G1X152.991Y-85.820
+G1X153.011Y-86.820
+G1X153.012Y-86.870
+G1X153.047Y-87.869
+G1X153.064Y-88.169
+G1X153.143Y-89.166
+G1X153.150Y-89.265
+G1X153.169Y-89.565
+G1X153.312Y-92.561
+G1X153.354Y-93.561
+G1X153.400Y-94.560
+G1X153.415Y-94.859
+G1X154.300Y-95.326
+G1X154.568Y-95.461
+G1X157.272Y-96.758
+G1X159.952Y-98.107
+G1X159.997Y-98.129
+G1X160.270Y-98.253
+G1X160.315Y-98.275
+G1X163.038Y-99.536
+G1X163.312Y-99.658
+G1X165.155Y-102.024
+G1X165.186Y-102.064
+G1X166.052Y-104.936
+G1X166.350Y-105.891
+G1X166.438Y-106.177
+G1X166.469Y-106.272
+G1X166.484Y-106.320
+G1X166.515Y-106.415
+G1X166.545Y-106.511
+G1X166.515Y-109.511
+G1X166.513Y-109.811
+G1X166.462Y-112.810
+G1X166.462Y-112.860
+G1X166.492Y-113.860
+G1X166.494Y-113.910
+G1X166.497Y-113.959
+G1X166.584Y-114.956
+G1X166.608Y-115.255
+G1X166.615Y-115.354
+G1X166.617Y-115.404
+G1X166.638Y-115.704
+G1X166.643Y-115.804
+G1X166.881Y-118.794
+G1X167.116Y-121.785
+G1X167.023Y-122.070
+G1X166.994Y-122.166
+G1X166.979Y-122.214
+G1X166.073Y-125.074
+G1X165.753Y-126.021
+G1X164.850Y-128.882
+G1X164.835Y-128.930
+G1X164.820Y-128.977
+G1X163.897Y-131.832
+G1X163.595Y-132.785
+G1X163.580Y-132.833
+G1X163.552Y-132.929
+G1X163.247Y-133.881
+G1X163.217Y-133.976
+G1X162.918Y-134.931
+G1X162.903Y-134.979
+G1X162.122Y-137.875
+G1X162.110Y-137.924
+G1X162.098Y-137.972
+G1X162.087Y-138.021
+G1X161.865Y-138.996
+G1X161.638Y-139.970
+G1X160.900Y-142.878
+G1X160.876Y-142.975
+G1X160.863Y-143.023
+G1X160.849Y-143.071
+G1X159.965Y-145.938
+G1X159.978Y-145.986
+G1X159.788Y-146.218
+G1X159.138Y-146.977
+G1X159.074Y-147.055
+G1X157.147Y-149.354
+G1X157.083Y-149.431
+G1X156.894Y-149.664
+G1X154.980Y-151.974
+G1X154.947Y-152.012
+G1X154.882Y-152.087
+G1X154.815Y-152.162
+G1X154.734Y-152.221
+G1X152.315Y-153.995
+G1X152.223Y-154.033
+G1X151.298Y-154.414
+G1X151.022Y-154.532
+G1X150.747Y-154.652
+G1X149.838Y-155.068
+G1X149.746Y-155.108
+G1X146.988Y-156.287
+G1X146.896Y-156.327
+G1X146.805Y-156.367
+G1X143.805Y-156.395
+G1X143.505Y-156.404
+G1X143.455Y-156.405
+G1X142.920Y-155.559
+G1X143.237Y-154.611
+G1X143.254Y-154.564
+G1X143.289Y-154.470
+G1X143.306Y-154.423
+G1X144.297Y-151.592
+G1X145.293Y-148.761
+G1X145.328Y-148.668
+G1X145.207Y-148.393
+G1X144.061Y-145.621
+G1X142.930Y-142.842
+G1X141.833Y-140.050
+G1X140.751Y-137.252
+G1X140.716Y-137.158
+G1X140.681Y-137.065
+G1X140.664Y-137.018
+G1X140.628Y-136.924
+G1X140.278Y-135.988
+G1X139.212Y-133.183
+G1X139.195Y-133.136
+G1X138.866Y-132.192
+G1X138.833Y-132.098
+G1X138.729Y-131.816
+G1X137.768Y-128.974
+G1X136.801Y-126.135
+G1X136.770Y-126.039
+G1X136.483Y-125.081
+G1X136.470Y-125.033
+G1X135.754Y-122.120
+G1X135.728Y-122.023
+G1X135.714Y-121.975
+G1X135.685Y-121.880
+G1X135.735Y-120.881
+G1X135.776Y-119.882
+G1X135.813Y-118.882
+G1X135.855Y-117.883
+G1X135.893Y-116.884
+G1X135.895Y-116.784
+G1X135.900Y-116.484
+G1X136.445Y-113.534
+G1X136.602Y-112.546
+G1X136.617Y-112.447
+G1X136.662Y-112.151
+G1X137.147Y-109.190
+G1X137.193Y-108.894
+G1X137.245Y-108.598
+G1X137.406Y-107.611
+G1X137.962Y-104.663
+G1X137.971Y-104.614
+G1X138.587Y-101.678
+G1X138.598Y-101.629
+G1X138.824Y-100.655
+G1X138.835Y-100.606
+G1X138.846Y-100.558
+G1X139.034Y-100.324
+G1X140.913Y-97.986
+G1X141.546Y-97.211
+G1X141.611Y-97.135
+G1X141.642Y-97.096
+G1X142.252Y-96.304
+G1X142.283Y-96.264
+G1X142.315Y-96.226
+G1X144.185Y-93.880
+G1X144.246Y-93.801
+G1X146.105Y-91.446
+G1X146.136Y-91.407
+G1X146.749Y-90.617
+G1X147.366Y-89.830
+G1X147.396Y-89.790
+G1X147.984Y-88.981
+G1X149.760Y-86.563
+G1X151.534Y-84.144
+G1X152.135Y-83.345
+G1X152.318Y-83.107
+G1X152.930Y-82.316
+G1X153.117Y-82.081
+G1X154.940Y-79.699
+G1X154.972Y-79.660
+G1X155.033Y-79.581
+G1X156.836Y-77.183
+G1X157.457Y-76.399
+G1X158.092Y-75.627
+G1X159.092Y-75.649
+G1X159.142Y-75.650
+G1X159.720Y-76.465
+G1X159.896Y-76.708
+G1X160.066Y-76.955
+G1X160.653Y-77.765
+G1X161.228Y-78.583
+G1X161.824Y-79.386
+G1X162.430Y-80.182
+G1X162.460Y-80.222
+G1X163.046Y-81.032
+G1X163.265Y-81.237
+G1X163.340Y-81.303
+G1X163.378Y-81.335
+G1X163.455Y-81.400
+G1X163.531Y-81.465
+G1X163.606Y-81.530
+G1X163.832Y-81.727
+G1X163.869Y-81.761
+G1X163.899Y-81.856
+G1X164.785Y-84.723
+G1X164.875Y-85.009
+G1X164.891Y-85.056
+G1X164.921Y-85.152
+G1X165.222Y-86.105
+G1X165.236Y-86.153
+G1X165.057Y-87.137
+G1X165.004Y-87.433
+G1X164.957Y-87.729
+G1X164.818Y-88.719
+G1X164.770Y-89.015
+G1X164.614Y-90.003
+G1X164.606Y-90.052
+G1X164.097Y-93.009
+G1X163.995Y-94.004
+G1X163.990Y-94.053
+G1X163.986Y-94.103
+G1X163.787Y-97.097
+G1X163.511Y-100.084
+G1X163.488Y-100.383
+G1X163.481Y-100.483
+G1X163.332Y-103.479
+G1X163.326Y-103.579
+G1X163.310Y-103.878
+G1X163.300Y-104.178
+G1X163.245Y-105.177
+G1X163.240Y-105.277
+G1X163.081Y-108.272
+G1X163.078Y-108.372
+G1X163.006Y-111.371
+G1X163.001Y-111.671
+G1X162.999Y-111.971
+G1X162.999Y-112.271
+G1X162.998Y-112.321
+G1X162.998Y-112.371
+G1X162.997Y-112.471
+G1X162.994Y-112.521
+G1X162.993Y-112.571
+G1X162.981Y-112.871
+G1X162.980Y-112.921
+G1X163.544Y-113.747
+G1X163.601Y-113.829
+G1X163.658Y-113.911
+G1X165.389Y-116.361
+G1X165.447Y-116.443
+G1X165.476Y-116.483
+G1X165.659Y-116.721
+G1X165.648Y-116.770
+G1X165.025Y-119.705
+G1X164.970Y-120.000
+G1X164.950Y-120.098
+G1X164.930Y-120.196
+G1X164.921Y-120.245
+G1X164.913Y-120.294
+G1X164.898Y-120.393
+G1X164.882Y-120.492
+G1X164.434Y-123.458
+G1X164.420Y-123.557
+G1X164.405Y-123.656
+G1X163.948Y-126.621
+G1X163.451Y-129.580
+G1X163.435Y-129.678
+G1X163.417Y-129.777
+G1X163.408Y-129.826
+G1X163.390Y-129.924
+G1X162.856Y-132.876
+G1X162.837Y-132.975
+G1X162.827Y-133.024
+G1X162.810Y-133.122
+G1X162.753Y-133.417
+G1X162.732Y-133.514
+G1X162.079Y-134.272
+G1X162.047Y-134.310
+G1X161.983Y-134.387
+G1X161.919Y-134.464
+G1X161.829Y-134.750
+G1X161.815Y-134.798
+G1X161.735Y-135.087
+G1X161.480Y-136.054
+G1X161.405Y-136.344
+G1X161.334Y-136.636
+G1X161.102Y-137.608
+G1X161.032Y-137.900
+G1X161.020Y-137.949
+G1X161.000Y-138.047
+G1X160.360Y-140.978
+G1X160.136Y-141.952
+G1X160.112Y-142.049
+G1X159.851Y-143.015
+G1X159.837Y-143.063
+G1X159.812Y-143.160
+G1X159.788Y-143.257
+G1X159.777Y-143.305
+G1X159.754Y-143.403
+G1X159.687Y-143.695
+G1X159.009Y-146.617
+G1X158.938Y-146.909
+G1X158.872Y-147.202
+G1X158.803Y-147.493
+G1X158.781Y-147.591
+G1X158.590Y-148.573
+G1X158.416Y-149.557
+G1X158.262Y-150.546
+G1X158.268Y-150.846
+G1X158.294Y-150.889
+G1X159.766Y-153.502
+G1X159.791Y-153.546
+G1X161.256Y-156.164
+G1X162.751Y-158.765
+G1X162.926Y-159.749
+G1X163.178Y-159.912
+G1X163.262Y-159.965
+G1X163.347Y-160.019
+G1X165.862Y-161.654
+G1X166.705Y-162.192
+G1X166.748Y-162.218
+G1X169.304Y-163.788
+G1X171.868Y-165.346
+G1X172.712Y-165.883
+G1X172.795Y-165.938
+G1X173.639Y-166.475
+G1X174.491Y-166.998
+G1X174.533Y-167.025
+G1X174.575Y-167.052
+G1X175.405Y-167.609
+G1X175.653Y-167.779
+G1X175.900Y-167.949
+G1X176.713Y-168.532
+G1X176.957Y-168.706
+G1X176.990Y-168.744
+G1X177.055Y-168.820
+G1X179.943Y-169.631
+G1X179.991Y-169.644
+G1X180.039Y-169.658
+G1X182.926Y-170.475
+G1X183.023Y-170.500
+G1X183.841Y-169.925
+G1X183.923Y-169.869
+G1X186.562Y-168.442
+G1X186.825Y-168.297
+G1X187.697Y-167.809
+G1X187.961Y-167.665
+G1X188.223Y-167.519
+G1X190.824Y-166.024
+G1X190.910Y-165.973
+G1X190.997Y-165.924
+G1X191.084Y-165.874
+G1X193.671Y-164.355
+G1X193.757Y-164.305
+G1X193.801Y-164.281
+G1X194.667Y-163.781
+G1X195.524Y-163.265
+G1X195.610Y-163.214
+G1X195.870Y-163.065
+G1X198.496Y-161.614
+G1X198.540Y-161.590
+G1X198.627Y-161.541
+G1X198.890Y-161.397
+G1X201.555Y-160.019
+G1X202.445Y-159.562
+G1X205.124Y-158.213
+G1X206.011Y-157.751
+G1X206.055Y-157.728
+G1X206.231Y-157.485
+G1X206.815Y-156.673
+G1X206.843Y-156.632
+G1X206.901Y-156.550
+G1X206.959Y-156.469
+G1X206.989Y-156.429
+G1X207.589Y-155.629
+G1X208.174Y-154.818
+G1X208.233Y-154.737
+G1X208.328Y-154.706
+G1X211.200Y-153.838
+G1X211.300Y-153.836
+G1X211.393Y-153.872
+G1X214.203Y-154.921
+G1X214.297Y-154.955
+G1X214.353Y-155.038
+G1X214.892Y-155.880
+G1X216.510Y-158.407
+G1X216.564Y-158.491
+G1X216.548Y-158.590
+G1X216.533Y-158.688
+G1X216.149Y-161.664
+G1X216.118Y-161.962
+G1X215.761Y-164.941
+G1X215.448Y-167.925
+G1X215.437Y-168.024
+G1X215.298Y-169.014
+G1X215.152Y-170.004
+G1X215.116Y-170.301
+G1X215.111Y-170.351
+G1X215.075Y-170.649
+G1X214.953Y-171.641
+G1X214.824Y-172.633
+G1X214.785Y-172.931
+G1X214.770Y-173.029
+G1X214.763Y-173.079
+G1X214.419Y-176.059
+G1X214.322Y-177.054
+G1X214.317Y-177.104
+G1X214.306Y-177.204
+G1X214.218Y-178.200
+G1X214.213Y-178.249
+G1X214.088Y-179.242
+G1X214.083Y-179.291
+G1X214.059Y-179.590
+G1X213.808Y-182.580
+G1X213.799Y-182.679
+G1X213.793Y-182.729
+G1X213.782Y-182.829
+G1X213.771Y-182.928
+G1X213.664Y-183.922
+G1X213.307Y-186.901
+G1X213.300Y-186.950
+G1X214.014Y-187.650
+G1X214.712Y-188.367
+G1X214.781Y-188.439
+G1X214.987Y-188.657
+G1X215.664Y-189.393
+G1X217.731Y-191.568
+G1X217.800Y-191.640
+G1X219.920Y-193.762
+G1X222.069Y-195.856
+G1X222.141Y-195.925
+G1X222.213Y-195.995
+G1X222.282Y-196.067
+G1X222.492Y-196.281
+G1X223.203Y-196.985
+G1X223.924Y-197.677
+G1X226.064Y-199.780
+G1X226.100Y-199.814
+G1X227.091Y-199.952
+G1X227.190Y-199.967
+G1X227.289Y-199.980
+G1X227.338Y-199.988
+G1X227.635Y-200.034
+G1X230.588Y-200.559
+G1X230.638Y-200.566
+G1X230.687Y-200.575
+G1X230.983Y-200.621
+G1X231.974Y-200.756
+G1X232.556Y-201.570
+G1X234.265Y-204.035
+G1X234.293Y-204.077
+G1X234.873Y-204.891
+G1X234.933Y-204.972
+G1X235.118Y-205.207
+G1X235.194Y-205.272
+G1X235.272Y-205.335
+G1X237.595Y-207.234
+G1X237.674Y-207.295
+G1X237.713Y-207.325
+G1X237.947Y-207.514
+G1X238.024Y-207.578
+G1X238.780Y-208.232
+G1X239.534Y-208.889
+G1X240.275Y-209.561
+G1X240.500Y-209.759
+G1X240.725Y-209.957
+G1X240.739Y-210.005
+G1X240.754Y-210.053
+G1X240.783Y-210.149
+G1X241.640Y-213.024
+G1X242.456Y-215.911
+G1X242.484Y-216.007
+G1X242.755Y-216.135
+G1X245.440Y-217.473
+G1X248.113Y-218.836
+G1X248.158Y-218.858
+G1X248.247Y-218.902
+G1X248.336Y-218.949
+G1X251.021Y-220.287
+G1X251.106Y-220.339
+G1X251.399Y-220.401
+G1X254.346Y-220.964
+G1X257.293Y-221.525
+G1X258.272Y-221.727
+G1X258.567Y-221.785
+G1X258.616Y-221.794
+G1X258.714Y-221.815
+G1X261.658Y-222.393
+G1X261.917Y-222.243
+G1X262.112Y-222.015
+G1X262.179Y-221.940
+G1X264.170Y-219.697
+G1X264.817Y-218.934
+G1X265.015Y-218.708
+G1X265.047Y-218.670
+G1X267.037Y-216.425
+G1X269.027Y-214.180
+G1X270.977Y-211.900
+G1X271.044Y-211.826
+G1X271.111Y-211.752
+G1X271.783Y-211.012
+G1X271.852Y-210.939
+G1X271.330Y-207.984
+G1X270.784Y-205.034
+G1X272.962Y-202.971
+G1X273.035Y-202.903
+G1X273.063Y-201.903
+G1X273.086Y-198.904
+G1X273.069Y-198.857
+G1X272.967Y-198.574
+G1X272.617Y-197.638
+G1X272.513Y-197.356
+G1X272.496Y-197.309
+G1X272.461Y-197.216
+G1X272.140Y-196.268
+G1X272.037Y-195.987
+G1X271.704Y-195.044
+G1X270.697Y-192.218
+G1X270.680Y-192.171
+G1X270.586Y-191.886
+G1X270.554Y-191.791
+G1X270.220Y-190.849
+G1X269.878Y-189.909
+G1X269.520Y-188.975
+G1X269.501Y-188.929
+G1X269.387Y-188.651
+G1X269.368Y-188.605
+G1X269.330Y-188.513
+G1X269.290Y-188.421
+G1X268.879Y-187.509
+G1X268.858Y-187.464
+G1X268.837Y-187.419
+G1X267.612Y-184.680
+G1X267.486Y-184.408
+G1X267.084Y-183.492
+G1X265.855Y-180.755
+G1X265.813Y-180.665
+G1X265.404Y-179.752
+G1X265.282Y-179.478
+G1X265.158Y-179.205
+G1X265.138Y-179.159
+G1X265.015Y-178.886
+G1X264.973Y-178.795
+G1X264.928Y-178.705
+G1X264.885Y-178.615
+G1X264.476Y-177.703
+G1X264.457Y-177.657
+G1X264.060Y-176.739
+G1X263.935Y-176.466
+G1X263.813Y-176.192
+G1X263.426Y-175.270
+G1X263.030Y-174.351
+G1X262.990Y-174.260
+G1X260.488Y-172.604
+G1X260.447Y-172.576
+G1X260.405Y-172.548
+G1X259.584Y-171.977
+G1X259.535Y-171.890
+G1X259.485Y-171.803
+G1X259.329Y-171.548
+G1X259.303Y-171.504
+G1X259.157Y-171.242
+G1X259.107Y-171.156
+G1X258.953Y-170.898
+G1X256.745Y-168.867
+G1X255.956Y-168.253
+G1X253.635Y-166.352
+G1X253.596Y-166.321
+G1X253.557Y-166.290
+G1X253.479Y-166.227
+G1X252.721Y-165.575
+G1X252.645Y-165.510
+G1X251.899Y-164.844
+G1X251.861Y-164.811
+G1X251.635Y-164.614
+G1X250.898Y-163.938
+G1X250.823Y-163.872
+G1X249.226Y-161.333
+G1X249.198Y-161.291
+G1X249.039Y-161.037
+G1X249.013Y-160.994
+G1X247.421Y-158.451
+G1X245.888Y-155.873
+G1X245.377Y-155.013
+G1X243.807Y-152.456
+G1X243.754Y-152.372
+G1X243.737Y-152.273
+G1X243.719Y-152.175
+G1X243.710Y-152.126
+G1X243.515Y-151.145
+G1X243.314Y-150.166
+G1X243.105Y-149.188
+G1X243.084Y-149.090
+G1X243.015Y-148.798
+G1X242.994Y-148.700
+G1X242.983Y-148.651
+G1X242.964Y-148.553
+G1X242.343Y-145.618
+G1X242.281Y-145.325
+G1X242.270Y-145.276
+G1X242.260Y-145.227
+G1X242.218Y-145.199
+G1X242.135Y-145.143
+G1X241.315Y-144.571
+G1X241.071Y-144.397
+G1X240.989Y-144.340
+G1X240.174Y-143.760
+G1X240.133Y-143.731
+G1X240.092Y-143.702
+G1X237.602Y-142.029
+G1X237.520Y-141.972
+G1X237.478Y-141.944
+G1X234.955Y-140.322
+G1X234.871Y-140.268
+G1X234.789Y-140.211
+G1X234.546Y-140.034
+G1X234.536Y-139.985
+G1X233.886Y-137.056
+G1X233.876Y-137.007
+G1X233.854Y-136.910
+G1X233.831Y-136.813
+G1X233.819Y-136.764
+G1X231.485Y-134.880
+G1X231.250Y-134.693
+G1X231.173Y-134.629
+G1X228.836Y-132.748
+G1X228.604Y-132.557
+G1X228.565Y-132.527
+G1X228.487Y-132.463
+G1X228.448Y-132.432
+G1X227.449Y-132.409
+G1X227.149Y-132.395
+G1X227.049Y-132.390
+G1X224.050Y-132.314
+G1X221.053Y-132.192
+G1X220.953Y-132.186
+G1X220.903Y-132.183
+G1X220.604Y-132.159
+G1X220.096Y-131.297
+G1X219.593Y-130.433
+G1X218.031Y-127.872
+G1X217.504Y-127.022
+G1X217.349Y-126.765
+G1X217.323Y-126.723
+G1X217.268Y-126.639
+G1X217.211Y-126.557
+G1X216.626Y-125.746
+G1X216.444Y-125.507
+G1X216.384Y-125.427
+G1X216.323Y-125.348
+G1X216.293Y-125.308
+G1X216.234Y-125.227
+G1X215.630Y-124.430
+G1X215.599Y-124.391
+G1X215.568Y-124.352
+G1X215.584Y-123.352
+G1X215.651Y-120.353
+G1X215.651Y-120.303
+G1X215.647Y-117.303
+G1X215.643Y-117.003
+G1X215.643Y-116.953
+G1X215.647Y-116.653
+G1X215.761Y-113.655
+G1X215.780Y-113.356
+G1X215.845Y-112.358
+G1X216.030Y-109.364
+G1X216.091Y-108.365
+G1X216.095Y-108.316
+G1X216.320Y-105.324
+G1X216.323Y-105.274
+G1X216.339Y-104.975
+G1X216.408Y-103.977
+G1X216.454Y-103.888
+G1X217.896Y-101.257
+G1X219.339Y-98.627
+G1X219.364Y-98.584
+G1X219.855Y-97.712
+G1X220.339Y-96.837
+G1X220.485Y-96.576
+G1X220.634Y-96.315
+G1X222.191Y-93.751
+G1X222.231Y-93.721
+G1X224.614Y-91.899
+G1X227.031Y-90.122
+G1X227.071Y-90.091
+G1X227.148Y-90.028
+G1X227.382Y-89.840
+G1X229.723Y-87.963
+G1X229.773Y-87.968
+G1X232.767Y-88.157
+G1X233.765Y-88.210
+G1X233.865Y-88.214
+G1X233.915Y-88.217
+G1X234.207Y-88.148
+G1X234.498Y-88.075
+G1X235.470Y-87.839
+G1X238.391Y-87.156
+G1X238.489Y-87.135
+G1X238.783Y-87.076
+G1X241.722Y-86.473
+G1X242.686Y-86.210
+G1X242.783Y-86.186
+G1X242.880Y-86.160
+G1X242.929Y-86.148
@@ -0,0 +1,1606 @@
+$120=20
+$121=20
+$11=0.01
+G21 G90 G94
+G0 X0 Y0
+F8000
+G1X0.500Y0.022
+G1X0.999Y0.000
+G1X1.499Y0.022
+G1X1.998Y0.000
+G1X2.498Y0.022
+G1X2.997Y0.000
+G1X3.497Y0.022
+G1X3.996Y0.000
+G1X4.496Y0.022
+G1X4.995Y0.000
+G1X5.495Y0.022
+G1X5.994Y0.000
+G1X6.494Y0.022
+G1X6.993Y0.000
+G1X7.493Y0.022
+G1X7.992Y0.000
+G1X8.492Y0.022
+G1X8.991Y0.000
+G1X9.491Y0.022
+G1X9.990Y0.000
+G1X10.490Y0.022
+G1X10.990Y0.000
+G1X11.489Y0.022
+G1X11.989Y0.000
+G1X12.488Y0.022
+G1X12.988Y0.000
+G1X13.487Y0.022
+G1X13.987Y0.000
+G1X14.486Y0.022
+G1X14.986Y0.000
+G1X15.485Y0.022
+G1X15.985Y0.000
+G1X16.484Y0.022
+G1X16.984Y0.000
+G1X17.483Y0.022
+G1X17.983Y0.000
+G1X18.482Y0.022
+G1X18.982Y0.000
+G1X19.481Y0.022
+G1X19.981Y0.000
+G1X20.480Y0.022
+G1X20.980Y0.000
+G1X21.480Y0.022
+G1X21.979Y0.000
+G1X22.479Y0.022
+G1X22.978Y0.000
+G1X23.478Y0.022
+G1X23.977Y0.000
+G1X24.477Y0.022
+G1X24.976Y0.000
+G1X25.476Y0.022
+G1X25.975Y0.000
+G1X26.475Y0.022
+G1X26.974Y0.000
+G1X27.474Y0.022
+G1X27.973Y0.000
+G1X28.473Y0.022
+G1X28.972Y0.000
+G1X29.472Y0.022
+G1X29.971Y0.000
+G1X30.471Y0.022
+G1X30.970Y0.000
+G1X31.470Y0.022
+G1X31.970Y0.000
+G1X32.469Y0.022
+G1X32.969Y0.000
+G1X33.468Y0.022
+G1X33.968Y0.000
+G1X34.467Y0.022
+G1X34.967Y0.000
+G1X35.466Y0.022
+G1X35.966Y0.000
+G1X36.465Y0.022
+G1X36.965Y0.000
+G1X37.464Y0.022
+G1X37.964Y0.000
+G1X38.463Y0.022
+G1X38.963Y0.000
+G1X39.462Y0.022
+G1X39.962Y0.000
+G1X40.461Y0.022
+G1X40.961Y0.000
+G1X41.461Y0.022
+G1X41.960Y0.000
+G1X42.460Y0.022
+G1X42.959Y0.000
+G1X43.459Y0.022
+G1X43.958Y0.000
+G1X44.458Y0.022
+G1X44.957Y0.000
+G1X45.457Y0.022
+G1X45.956Y0.000
+G1X46.456Y0.022
+G1X46.955Y0.000
+G1X47.455Y0.022
+G1X47.954Y0.000
+G1X48.454Y0.022
+G1X48.953Y0.000
+G1X49.453Y0.022
+G1X49.952Y0.000
+G1X50.452Y0.022
+G1X50.951Y0.000
+G1X51.451Y0.022
+G1X51.951Y0.000
+G1X52.450Y0.022
+G1X52.950Y0.000
+G1X53.449Y0.022
+G1X53.949Y0.000
+G1X54.448Y0.022
+G1X54.948Y0.000
+G1X55.447Y0.022
+G1X55.947Y0.000
+G1X56.446Y0.022
+G1X56.946Y0.000
+G1X57.445Y0.022
+G1X57.945Y0.000
+G1X58.444Y0.022
+G1X58.944Y0.000
+G1X59.443Y0.022
+G1X59.943Y0.000
+G1X60.442Y0.022
+G1X60.942Y0.000
+G1X61.441Y0.022
+G1X61.941Y0.000
+G1X62.441Y0.022
+G1X62.940Y0.000
+G1X63.440Y0.022
+G1X63.939Y0.000
+G1X64.439Y0.022
+G1X64.938Y0.000
+G1X65.438Y0.022
+G1X65.937Y0.000
+G1X66.437Y0.022
+G1X66.936Y0.000
+G1X67.436Y0.022
+G1X67.935Y0.000
+G1X68.435Y0.022
+G1X68.934Y0.000
+G1X69.434Y0.022
+G1X69.933Y0.000
+G1X70.433Y0.022
+G1X70.932Y0.000
+G1X71.432Y0.022
+G1X71.931Y0.000
+G1X72.431Y0.022
+G1X72.931Y0.000
+G1X73.430Y0.022
+G1X73.930Y0.000
+G1X74.429Y0.022
+G1X74.929Y0.000
+G1X75.428Y0.022
+G1X75.928Y0.000
+G1X76.427Y0.022
+G1X76.927Y0.000
+G1X77.426Y0.022
+G1X77.926Y0.000
+G1X78.425Y0.022
+G1X78.925Y0.000
+G1X79.424Y0.022
+G1X79.924Y0.000
+G1X80.423Y0.022
+G1X80.923Y0.000
+G1X81.422Y0.022
+G1X81.922Y0.000
+G1X82.421Y0.022
+G1X82.921Y0.000
+G1X83.421Y0.022
+G1X83.920Y0.000
+G1X84.420Y0.022
+G1X84.919Y0.000
+G1X85.419Y0.022
+G1X85.918Y0.000
+G1X86.418Y0.022
+G1X86.917Y0.000
+G1X87.417Y0.022
+G1X87.916Y0.000
+G1X88.416Y0.022
+G1X88.915Y0.000
+G1X89.415Y0.022
+G1X89.914Y0.000
+G1X90.414Y0.022
+G1X90.913Y0.000
+G1X91.413Y0.022
+G1X91.912Y0.000
+G1X92.412Y0.022
+G1X92.911Y0.000
+G1X93.411Y0.022
+G1X93.911Y0.000
+G1X94.410Y0.022
+G1X94.910Y0.000
+G1X95.409Y0.022
+G1X95.909Y0.000
+G1X96.408Y0.022
+G1X96.908Y0.000
+G1X97.407Y0.022
+G1X97.907Y0.000
+G1X98.406Y0.022
+G1X98.906Y0.000
+G1X99.405Y0.022
+G1X99.905Y0.000
+G1X100.404Y0.022
+G1X100.904Y0.000
+G1X101.403Y0.022
+G1X101.903Y0.000
+G1X102.402Y0.022
+G1X102.902Y0.000
+G1X103.401Y0.022
+G1X103.901Y0.000
+G1X104.401Y0.022
+G1X104.900Y0.000
+G1X105.400Y0.022
+G1X105.899Y0.000
+G1X106.399Y0.022
+G1X106.898Y0.000
+G1X107.398Y0.022
+G1X107.897Y0.000
+G1X108.397Y0.022
+G1X108.896Y0.000
+G1X109.396Y0.022
+G1X109.895Y0.000
+G1X110.395Y0.022
+G1X110.894Y0.000
+G1X111.394Y0.022
+G1X111.893Y0.000
+G1X112.393Y0.022
+G1X112.892Y0.000
+G1X113.392Y0.022
+G1X113.891Y0.000
+G1X114.391Y0.022
+G1X114.891Y0.000
+G1X115.390Y0.022
+G1X115.890Y0.000
+G1X116.389Y0.022
+G1X116.889Y0.000
+G1X117.388Y0.022
+G1X117.888Y0.000
+G1X118.387Y0.022
+G1X118.887Y0.000
+G1X119.386Y0.022
+G1X119.886Y0.000
+G1X120.385Y0.022
+G1X120.885Y0.000
+G1X121.384Y0.022
+G1X121.884Y0.000
+G1X122.383Y0.022
+G1X122.883Y0.000
+G1X123.382Y0.022
+G1X123.882Y0.000
+G1X124.382Y0.022
+G1X124.881Y0.000
+G1X125.381Y0.022
+G1X125.880Y0.000
+G1X126.380Y0.022
+G1X126.879Y0.000
+G1X127.379Y0.022
+G1X127.878Y0.000
+G1X128.378Y0.022
+G1X128.877Y0.000
+G1X129.377Y0.022
+G1X129.876Y0.000
+G1X130.376Y0.022
+G1X130.875Y0.000
+G1X131.375Y0.022
+G1X131.874Y0.000
+G1X132.374Y0.022
+G1X132.873Y0.000
+G1X133.373Y0.022
+G1X133.872Y0.000
+G1X134.372Y0.022
+G1X134.872Y0.000
+G1X135.371Y0.022
+G1X135.871Y0.000
+G1X136.370Y0.022
+G1X136.870Y0.000
+G1X137.369Y0.022
+G1X137.869Y0.000
+G1X138.368Y0.022
+G1X138.868Y0.000
+G1X139.367Y0.022
+G1X139.867Y0.000
+G1X140.366Y0.022
+G1X140.866Y0.000
+G1X141.365Y0.022
+G1X141.865Y0.000
+G1X142.364Y0.022
+G1X142.864Y0.000
+G1X143.363Y0.022
+G1X143.863Y0.000
+G1X144.362Y0.022
+G1X144.862Y0.000
+G1X145.362Y0.022
+G1X145.861Y0.000
+G1X146.361Y0.022
+G1X146.860Y0.000
+G1X147.360Y0.022
+G1X147.859Y0.000
+G1X148.359Y0.022
+G1X148.858Y0.000
+G1X149.358Y0.022
+G1X149.857Y0.000
+G1X150.357Y0.022
+G1X150.856Y0.000
+G1X151.356Y0.022
+G1X151.855Y0.000
+G1X152.355Y0.022
+G1X152.854Y0.000
+G1X153.354Y0.022
+G1X153.853Y0.000
+G1X154.353Y0.022
+G1X154.852Y0.000
+G1X155.352Y0.022
+G1X155.852Y0.000
+G1X156.351Y0.022
+G1X156.851Y0.000
+G1X157.350Y0.022
+G1X157.850Y0.000
+G1X158.349Y0.022
+G1X158.849Y0.000
+G1X159.348Y0.022
+G1X159.848Y0.000
+G1X160.347Y0.022
+G1X160.847Y0.000
+G1X161.346Y0.022
+G1X161.846Y0.000
+G1X162.345Y0.022
+G1X162.845Y0.000
+G1X163.344Y0.022
+G1X163.844Y0.000
+G1X164.343Y0.022
+G1X164.843Y0.000
+G1X165.342Y0.022
+G1X165.842Y0.000
+G1X166.342Y0.022
+G1X166.841Y0.000
+G1X167.341Y0.022
+G1X167.840Y0.000
+G1X168.340Y0.022
+G1X168.839Y0.000
+G1X169.339Y0.022
+G1X169.838Y0.000
+G1X170.338Y0.022
+G1X170.837Y0.000
+G1X171.337Y0.022
+G1X171.836Y0.000
+G1X172.336Y0.022
+G1X172.835Y0.000
+G1X173.335Y0.022
+G1X173.834Y0.000
+G1X174.334Y0.022
+G1X174.833Y0.000
+G1X175.333Y0.022
+G1X175.832Y0.000
+G1X176.332Y0.022
+G1X176.832Y0.000
+G1X177.331Y0.022
+G1X177.831Y0.000
+G1X178.330Y0.022
+G1X178.830Y0.000
+G1X179.329Y0.022
+G1X179.829Y0.000
+G1X180.328Y0.022
+G1X180.828Y0.000
+G1X181.327Y0.022
+G1X181.827Y0.000
+G1X182.326Y0.022
+G1X182.826Y0.000
+G1X183.325Y0.022
+G1X183.825Y0.000
+G1X184.324Y0.022
+G1X184.824Y0.000
+G1X185.323Y0.022
+G1X185.823Y0.000
+G1X186.322Y0.022
+G1X186.822Y0.000
+G1X187.322Y0.022
+G1X187.821Y0.000
+G1X188.321Y0.022
+G1X188.820Y0.000
+G1X189.320Y0.022
+G1X189.819Y0.000
+G1X190.319Y0.022
+G1X190.818Y0.000
+G1X191.318Y0.022
+G1X191.817Y0.000
+G1X192.317Y0.022
+G1X192.816Y0.000
+G1X193.316Y0.022
+G1X193.815Y0.000
+G1X194.315Y0.022
+G1X194.814Y0.000
+G1X195.314Y0.022
+G1X195.813Y0.000
+G1X196.313Y0.022
+G1X196.812Y0.000
+G1X197.312Y0.022
+G1X197.812Y0.000
+G1X198.311Y0.022
+G1X198.811Y0.000
+G1X199.310Y0.022
+G1X199.810Y0.000
+G1X200.309Y0.022
+G1X200.809Y0.000
+G1X201.308Y0.022
+G1X201.808Y0.000
+G1X202.307Y0.022
+G1X202.807Y0.000
+G1X203.306Y0.022
+G1X203.806Y0.000
+G1X204.305Y0.022
+G1X204.805Y0.000
+G1X205.304Y0.022
+G1X205.804Y0.000
+G1X206.303Y0.022
+G1X206.803Y0.000
+G1X207.303Y0.022
+G1X207.802Y0.000
+G1X208.302Y0.022
+G1X208.801Y0.000
+G1X209.301Y0.022
+G1X209.800Y0.000
+G1X210.300Y0.022
+G1X210.799Y0.000
+G1X211.299Y0.022
+G1X211.798Y0.000
+G1X212.298Y0.022
+G1X212.797Y0.000
+G1X213.297Y0.022
+G1X213.796Y0.000
+G1X214.296Y0.022
+G1X214.795Y0.000
+G1X215.295Y0.022
+G1X215.794Y0.000
+G1X216.294Y0.022
+G1X216.793Y0.000
+G1X217.293Y0.022
+G1X217.793Y0.000
+G1X218.292Y0.022
+G1X218.792Y0.000
+G1X219.291Y0.022
+G1X219.791Y0.000
+G1X220.290Y0.022
+G1X220.790Y0.000
+G1X221.289Y0.022
+G1X221.789Y0.000
+G1X222.288Y0.022
+G1X222.788Y0.000
+G1X223.287Y0.022
+G1X223.787Y0.000
+G1X224.286Y0.022
+G1X224.786Y0.000
+G1X225.285Y0.022
+G1X225.785Y0.000
+G1X226.284Y0.022
+G1X226.784Y0.000
+G1X227.283Y0.022
+G1X227.783Y0.000
+G1X228.283Y0.022
+G1X228.782Y0.000
+G1X229.282Y0.022
+G1X229.781Y0.000
+G1X230.281Y0.022
+G1X230.780Y0.000
+G1X231.280Y0.022
+G1X231.779Y0.000
+G1X232.279Y0.022
+G1X232.778Y0.000
+G1X233.278Y0.022
+G1X233.777Y0.000
+G1X234.277Y0.022
+G1X234.776Y0.000
+G1X235.276Y0.022
+G1X235.775Y0.000
+G1X236.275Y0.022
+G1X236.774Y0.000
+G1X237.274Y0.022
+G1X237.773Y0.000
+G1X238.273Y0.022
+G1X238.773Y0.000
+G1X239.272Y0.022
+G1X239.772Y0.000
+G1X240.271Y0.022
+G1X240.771Y0.000
+G1X241.270Y0.022
+G1X241.770Y0.000
+G1X242.269Y0.022
+G1X242.769Y0.000
+G1X243.268Y0.022
+G1X243.768Y0.000
+G1X244.267Y0.022
+G1X244.767Y0.000
+G1X245.266Y0.022
+G1X245.766Y0.000
+G1X246.265Y0.022
+G1X246.765Y0.000
+G1X247.264Y0.022
+G1X247.764Y0.000
+G1X248.263Y0.022
+G1X248.763Y0.000
+G1X249.263Y0.022
+G1X249.762Y0.000
+G1X250.262Y0.022
+G1X250.761Y0.000
+G1X251.261Y0.022
+G1X251.760Y0.000
+G1X252.260Y0.022
+G1X252.759Y0.000
+G1X253.259Y0.022
+G1X253.758Y0.000
+G1X254.258Y0.022
+G1X254.757Y0.000
+G1X255.257Y0.022
+G1X255.756Y0.000
+G1X256.256Y0.022
+G1X256.755Y0.000
+G1X257.255Y0.022
+G1X257.754Y0.000
+G1X258.254Y0.022
+G1X258.753Y0.000
+G1X259.253Y0.022
+G1X259.753Y0.000
+G1X260.252Y0.022
+G1X260.752Y0.000
+G1X261.251Y0.022
+G1X261.751Y0.000
+G1X262.250Y0.022
+G1X262.750Y0.000
+G1X263.249Y0.022
+G1X263.749Y0.000
+G1X264.248Y0.022
+G1X264.748Y0.000
+G1X265.247Y0.022
+G1X265.747Y0.000
+G1X266.246Y0.022
+G1X266.746Y0.000
+G1X267.245Y0.022
+G1X267.745Y0.000
+G1X268.244Y0.022
+G1X268.744Y0.000
+G1X269.243Y0.022
+G1X269.743Y0.000
+G1X270.243Y0.022
+G1X270.742Y0.000
+G1X271.242Y0.022
+G1X271.741Y0.000
+G1X272.241Y0.022
+G1X272.740Y0.000
+G1X273.240Y0.022
+G1X273.739Y0.000
+G1X274.239Y0.022
+G1X274.738Y0.000
+G1X275.238Y0.022
+G1X275.737Y0.000
+G1X276.237Y0.022
+G1X276.736Y0.000
+G1X277.236Y0.022
+G1X277.735Y0.000
+G1X278.235Y0.022
+G1X278.734Y0.000
+G1X279.234Y0.022
+G1X279.734Y0.000
+G1X280.233Y0.022
+G1X280.733Y0.000
+G1X281.232Y0.022
+G1X281.732Y0.000
+G1X282.231Y0.022
+G1X282.731Y0.000
+G1X283.230Y0.022
+G1X283.730Y0.000
+G1X284.229Y0.022
+G1X284.729Y0.000
+G1X285.228Y0.022
+G1X285.728Y0.000
+G1X286.227Y0.022
+G1X286.727Y0.000
+G1X287.226Y0.022
+G1X287.726Y0.000
+G1X288.225Y0.022
+G1X288.725Y0.000
+G1X289.224Y0.022
+G1X289.724Y0.000
+G1X290.224Y0.022
+G1X290.723Y0.000
+G1X291.223Y0.022
+G1X291.722Y0.000
+G1X292.222Y0.022
+G1X292.721Y0.000
+G1X293.221Y0.022
+G1X293.720Y0.000
+G1X294.220Y0.022
+G1X294.719Y0.000
+G1X295.219Y0.022
+G1X295.718Y0.000
+G1X296.218Y0.022
+G1X296.717Y0.000
+G1X297.217Y0.022
+G1X297.716Y0.000
+G1X298.216Y0.022
+G1X298.715Y0.000
+G1X299.215Y0.022
+G1X299.714Y0.000
+G1X300.214Y0.022
+G1X300.714Y0.000
+G1X301.213Y0.022
+G1X301.713Y0.000
+G1X302.212Y0.022
+G1X302.712Y0.000
+G1X303.211Y0.022
+G1X303.711Y0.000
+G1X304.210Y0.022
+G1X304.710Y0.000
+G1X305.209Y0.022
+G1X305.709Y0.000
+G1X306.208Y0.022
+G1X306.708Y0.000
+G1X307.207Y0.022
+G1X307.707Y0.000
+G1X308.206Y0.022
+G1X308.706Y0.000
+G1X309.205Y0.022
+G1X309.705Y0.000
+G1X310.204Y0.022
+G1X310.704Y0.000
+G1X311.204Y0.022
+G1X311.703Y0.000
+G1X312.203Y0.022
+G1X312.702Y0.000
+G1X313.202Y0.022
+G1X313.701Y0.000
+G1X314.201Y0.022
+G1X314.700Y0.000
+G1X315.200Y0.022
+G1X315.699Y0.000
+G1X316.199Y0.022
+G1X316.698Y0.000
+G1X317.198Y0.022
+G1X317.697Y0.000
+G1X318.197Y0.022
+G1X318.696Y0.000
+G1X319.196Y0.022
+G1X319.695Y0.000
+G1X320.195Y0.022
+G1X320.694Y0.000
+G1X321.194Y0.022
+G1X321.694Y0.000
+G1X322.193Y0.022
+G1X322.693Y0.000
+G1X323.192Y0.022
+G1X323.692Y0.000
+G1X324.191Y0.022
+G1X324.691Y0.000
+G1X325.190Y0.022
+G1X325.690Y0.000
+G1X326.189Y0.022
+G1X326.689Y0.000
+G1X327.188Y0.022
+G1X327.688Y0.000
+G1X328.187Y0.022
+G1X328.687Y0.000
+G1X329.186Y0.022
+G1X329.686Y0.000
+G1X330.185Y0.022
+G1X330.685Y0.000
+G1X331.184Y0.022
+G1X331.684Y0.000
+G1X332.184Y0.022
+G1X332.683Y0.000
+G1X333.183Y0.022
+G1X333.682Y0.000
+G1X334.182Y0.022
+G1X334.681Y0.000
+G1X335.181Y0.022
+G1X335.680Y0.000
+G1X336.180Y0.022
+G1X336.679Y0.000
+G1X337.179Y0.022
+G1X337.678Y0.000
+G1X338.178Y0.022
+G1X338.677Y0.000
+G1X339.177Y0.022
+G1X339.676Y0.000
+G1X340.176Y0.022
+G1X340.675Y0.000
+G1X341.175Y0.022
+G1X341.674Y0.000
+G1X342.174Y0.022
+G1X342.674Y0.000
+G1X343.173Y0.022
+G1X343.673Y0.000
+G1X344.172Y0.022
+G1X344.672Y0.000
+G1X345.171Y0.022
+G1X345.671Y0.000
+G1X346.170Y0.022
+G1X346.670Y0.000
+G1X347.169Y0.022
+G1X347.669Y0.000
+G1X348.168Y0.022
+G1X348.668Y0.000
+G1X349.167Y0.022
+G1X349.667Y0.000
+G1X350.166Y0.022
+G1X350.666Y0.000
+G1X351.165Y0.022
+G1X351.665Y0.000
+G1X352.164Y0.022
+G1X352.664Y0.000
+G1X353.164Y0.022
+G1X353.663Y0.000
+G1X354.163Y0.022
+G1X354.662Y0.000
+G1X355.162Y0.022
+G1X355.661Y0.000
+G1X356.161Y0.022
+G1X356.660Y0.000
+G1X357.160Y0.022
+G1X357.659Y0.000
+G1X358.159Y0.022
+G1X358.658Y0.000
+G1X359.158Y0.022
+G1X359.657Y0.000
+G1X360.157Y0.022
+G1X360.656Y0.000
+G1X361.156Y0.022
+G1X361.655Y0.000
+G1X362.155Y0.022
+G1X362.655Y0.000
+G1X363.154Y0.022
+G1X363.654Y0.000
+G1X364.153Y0.022
+G1X364.653Y0.000
+G1X365.152Y0.022
+G1X365.652Y0.000
+G1X366.151Y0.022
+G1X366.651Y0.000
+G1X367.150Y0.022
+G1X367.650Y0.000
+G1X368.149Y0.022
+G1X368.649Y0.000
+G1X369.148Y0.022
+G1X369.648Y0.000
+G1X370.147Y0.022
+G1X370.647Y0.000
+G1X371.146Y0.022
+G1X371.646Y0.000
+G1X372.145Y0.022
+G1X372.645Y0.000
+G1X373.145Y0.022
+G1X373.644Y0.000
+G1X374.144Y0.022
+G1X374.643Y0.000
+G1X375.143Y0.022
+G1X375.642Y0.000
+G1X376.142Y0.022
+G1X376.641Y0.000
+G1X377.141Y0.022
+G1X377.640Y0.000
+G1X378.140Y0.022
+G1X378.639Y0.000
+G1X379.139Y0.022
+G1X379.638Y0.000
+G1X380.138Y0.022
+G1X380.637Y0.000
+G1X381.137Y0.022
+G1X381.636Y0.000
+G1X382.136Y0.022
+G1X382.635Y0.000
+G1X383.135Y0.022
+G1X383.635Y0.000
+G1X384.134Y0.022
+G1X384.634Y0.000
+G1X385.133Y0.022
+G1X385.633Y0.000
+G1X386.132Y0.022
+G1X386.632Y0.000
+G1X387.131Y0.022
+G1X387.631Y0.000
+G1X388.130Y0.022
+G1X388.630Y0.000
+G1X389.129Y0.022
+G1X389.629Y0.000
+G1X390.128Y0.022
+G1X390.628Y0.000
+G1X391.127Y0.022
+G1X391.627Y0.000
+G1X392.126Y0.022
+G1X392.626Y0.000
+G1X393.125Y0.022
+G1X393.625Y0.000
+G1X394.125Y0.022
+G1X394.624Y0.000
+G1X395.124Y0.022
+G1X395.623Y0.000
+G1X396.123Y0.022
+G1X396.622Y0.000
+G1X397.122Y0.022
+G1X397.621Y0.000
+G1X398.121Y0.022
+G1X398.620Y0.000
+G1X399.120Y0.022
+G1X399.619Y0.000
+G1X400.119Y0.022
+G1X400.618Y0.000
+G1X401.118Y0.022
+G1X401.617Y0.000
+G1X402.117Y0.022
+G1X402.616Y0.000
+G1X403.116Y0.022
+G1X403.615Y0.000
+G1X404.115Y0.022
+G1X404.615Y0.000
+G1X405.114Y0.022
+G1X405.614Y0.000
+G1X406.113Y0.022
+G1X406.613Y0.000
+G1X407.112Y0.022
+G1X407.612Y0.000
+G1X408.111Y0.022
+G1X408.611Y0.000
+G1X409.110Y0.022
+G1X409.610Y0.000
+G1X410.109Y0.022
+G1X410.609Y0.000
+G1X411.108Y0.022
+G1X411.608Y0.000
+G1X412.107Y0.022
+G1X412.607Y0.000
+G1X413.106Y0.022
+G1X413.606Y0.000
+G1X414.105Y0.022
+G1X414.605Y0.000
+G1X415.105Y0.022
+G1X415.604Y0.000
+G1X416.104Y0.022
+G1X416.603Y0.000
+G1X417.103Y0.022
+G1X417.602Y0.000
+G1X418.102Y0.022
+G1X418.601Y0.000
+G1X419.101Y0.022
+G1X419.600Y0.000
+G1X420.100Y0.022
+G1X420.599Y0.000
+G1X421.099Y0.022
+G1X421.598Y0.000
+G1X422.098Y0.022
+G1X422.597Y0.000
+G1X423.097Y0.022
+G1X423.596Y0.000
+G1X424.096Y0.022
+G1X424.595Y0.000
+G1X425.095Y0.022
+G1X425.595Y0.000
+G1X426.094Y0.022
+G1X426.594Y0.000
+G1X427.093Y0.022
+G1X427.593Y0.000
+G1X428.092Y0.022
+G1X428.592Y0.000
+G1X429.091Y0.022
+G1X429.591Y0.000
+G1X430.090Y0.022
+G1X430.590Y0.000
+G1X431.089Y0.022
+G1X431.589Y0.000
+G1X432.088Y0.022
+G1X432.588Y0.000
+G1X433.087Y0.022
+G1X433.587Y0.000
+G1X434.086Y0.022
+G1X434.586Y0.000
+G1X435.086Y0.022
+G1X435.585Y0.000
+G1X436.085Y0.022
+G1X436.584Y0.000
+G1X437.084Y0.022
+G1X437.583Y0.000
+G1X438.083Y0.022
+G1X438.582Y0.000
+G1X439.082Y0.022
+G1X439.581Y0.000
+G1X440.081Y0.022
+G1X440.580Y0.000
+G1X441.080Y0.022
+G1X441.579Y0.000
+G1X442.079Y0.022
+G1X442.578Y0.000
+G1X443.078Y0.022
+G1X443.577Y0.000
+G1X444.077Y0.022
+G1X444.576Y0.000
+G1X445.076Y0.022
+G1X445.576Y0.000
+G1X446.075Y0.022
+G1X446.575Y0.000
+G1X447.074Y0.022
+G1X447.574Y0.000
+G1X448.073Y0.022
+G1X448.573Y0.000
+G1X449.072Y0.022
+G1X449.572Y0.000
+G1X450.071Y0.022
+G1X450.571Y0.000
+G1X451.070Y0.022
+G1X451.570Y0.000
+G1X452.069Y0.022
+G1X452.569Y0.000
+G1X453.068Y0.022
+G1X453.568Y0.000
+G1X454.067Y0.022
+G1X454.567Y0.000
+G1X455.066Y0.022
+G1X455.566Y0.000
+G1X456.066Y0.022
+G1X456.565Y0.000
+G1X457.065Y0.022
+G1X457.564Y0.000
+G1X458.064Y0.022
+G1X458.563Y0.000
+G1X459.063Y0.022
+G1X459.562Y0.000
+G1X460.062Y0.022
+G1X460.561Y0.000
+G1X461.061Y0.022
+G1X461.560Y0.000
+G1X462.060Y0.022
+G1X462.559Y0.000
+G1X463.059Y0.022
+G1X463.558Y0.000
+G1X464.058Y0.022
+G1X464.557Y0.000
+G1X465.057Y0.022
+G1X465.556Y0.000
+G1X466.056Y0.022
+G1X466.556Y0.000
+G1X467.055Y0.022
+G1X467.555Y0.000
+G1X468.054Y0.022
+G1X468.554Y0.000
+G1X469.053Y0.022
+G1X469.553Y0.000
+G1X470.052Y0.022
+G1X470.552Y0.000
+G1X471.051Y0.022
+G1X471.551Y0.000
+G1X472.050Y0.022
+G1X472.550Y0.000
+G1X473.049Y0.022
+G1X473.549Y0.000
+G1X474.048Y0.022
+G1X474.548Y0.000
+G1X475.047Y0.022
+G1X475.547Y0.000
+G1X476.046Y0.022
+G1X476.546Y0.000
+G1X477.046Y0.022
+G1X477.545Y0.000
+G1X478.045Y0.022
+G1X478.544Y0.000
+G1X479.044Y0.022
+G1X479.543Y0.000
+G1X480.043Y0.022
+G1X480.542Y0.000
+G1X481.042Y0.022
+G1X481.541Y0.000
+G1X482.041Y0.022
+G1X482.540Y0.000
+G1X483.040Y0.022
+G1X483.539Y0.000
+G1X484.039Y0.022
+G1X484.538Y0.000
+G1X485.038Y0.022
+G1X485.537Y0.000
+G1X486.037Y0.022
+G1X486.536Y0.000
+G1X487.036Y0.022
+G1X487.536Y0.000
+G1X488.035Y0.022
+G1X488.535Y0.000
+G1X489.034Y0.022
+G1X489.534Y0.000
+G1X490.033Y0.022
+G1X490.533Y0.000
+G1X491.032Y0.022
+G1X491.532Y0.000
+G1X492.031Y0.022
+G1X492.531Y0.000
+G1X493.030Y0.022
+G1X493.530Y0.000
+G1X494.029Y0.022
+G1X494.529Y0.000
+G1X495.028Y0.022
+G1X495.528Y0.000
+G1X496.027Y0.022
+G1X496.527Y0.000
+G1X497.026Y0.022
+G1X497.526Y0.000
+G1X498.026Y0.022
+G1X498.525Y0.000
+G1X499.025Y0.022
+G1X499.524Y0.000
+G1X500.024Y0.022
+G1X500.523Y0.000
+G1X501.023Y0.022
+G1X501.522Y0.000
+G1X502.022Y0.022
+G1X502.521Y0.000
+G1X503.021Y0.022
+G1X503.520Y0.000
+G1X504.020Y0.022
+G1X504.519Y0.000
+G1X505.019Y0.022
+G1X505.518Y0.000
+G1X506.018Y0.022
+G1X506.517Y0.000
+G1X507.017Y0.022
+G1X507.516Y0.000
+G1X508.016Y0.022
+G1X508.516Y0.000
+G1X509.015Y0.022
+G1X509.515Y0.000
+G1X510.014Y0.022
+G1X510.514Y0.000
+G1X511.013Y0.022
+G1X511.513Y0.000
+G1X512.012Y0.022
+G1X512.512Y0.000
+G1X513.011Y0.022
+G1X513.511Y0.000
+G1X514.010Y0.022
+G1X514.510Y0.000
+G1X515.009Y0.022
+G1X515.509Y0.000
+G1X516.008Y0.022
+G1X516.508Y0.000
+G1X517.007Y0.022
+G1X517.507Y0.000
+G1X518.007Y0.022
+G1X518.506Y0.000
+G1X519.006Y0.022
+G1X519.505Y0.000
+G1X520.005Y0.022
+G1X520.504Y0.000
+G1X521.004Y0.022
+G1X521.503Y0.000
+G1X522.003Y0.022
+G1X522.502Y0.000
+G1X523.002Y0.022
+G1X523.501Y0.000
+G1X524.001Y0.022
+G1X524.500Y0.000
+G1X525.000Y0.022
+G1X525.499Y0.000
+G1X525.999Y0.022
+G1X526.498Y0.000
+G1X526.998Y0.022
+G1X527.497Y0.000
+G1X527.997Y0.022
+G1X528.497Y0.000
+G1X528.996Y0.022
+G1X529.496Y0.000
+G1X529.995Y0.022
+G1X530.495Y0.000
+G1X530.994Y0.022
+G1X531.494Y0.000
+G1X531.993Y0.022
+G1X532.493Y0.000
+G1X532.992Y0.022
+G1X533.492Y0.000
+G1X533.991Y0.022
+G1X534.491Y0.000
+G1X534.990Y0.022
+G1X535.490Y0.000
+G1X535.989Y0.022
+G1X536.489Y0.000
+G1X536.988Y0.022
+G1X537.488Y0.000
+G1X537.987Y0.022
+G1X538.487Y0.000
+G1X538.987Y0.022
+G1X539.486Y0.000
+G1X539.986Y0.022
+G1X540.485Y0.000
+G1X540.985Y0.022
+G1X541.484Y0.000
+G1X541.984Y0.022
+G1X542.483Y0.000
+G1X542.983Y0.022
+G1X543.482Y0.000
+G1X543.982Y0.022
+G1X544.481Y0.000
+G1X544.981Y0.022
+G1X545.480Y0.000
+G1X545.980Y0.022
+G1X546.479Y0.000
+G1X546.979Y0.022
+G1X547.478Y0.000
+G1X547.978Y0.022
+G1X548.477Y0.000
+G1X548.977Y0.022
+G1X549.477Y0.000
+G1X549.976Y0.022
+G1X550.476Y0.000
+G1X550.975Y0.022
+G1X551.475Y0.000
+G1X551.974Y0.022
+G1X552.474Y0.000
+G1X552.973Y0.022
+G1X553.473Y0.000
+G1X553.972Y0.022
+G1X554.472Y0.000
+G1X554.971Y0.022
+G1X555.471Y0.000
+G1X555.970Y0.022
+G1X556.470Y0.000
+G1X556.969Y0.022
+G1X557.469Y0.000
+G1X557.968Y0.022
+G1X558.468Y0.000
+G1X558.967Y0.022
+G1X559.467Y0.000
+G1X559.967Y0.022
+G1X560.466Y0.000
+G1X560.966Y0.022
+G1X561.465Y0.000
+G1X561.965Y0.022
+G1X562.464Y0.000
+G1X562.964Y0.022
+G1X563.463Y0.000
+G1X563.963Y0.022
+G1X564.462Y0.000
+G1X564.962Y0.022
+G1X565.461Y0.000
+G1X565.961Y0.022
+G1X566.460Y0.000
+G1X566.960Y0.022
+G1X567.459Y0.000
+G1X567.959Y0.022
+G1X568.458Y0.000
+G1X568.958Y0.022
+G1X569.457Y0.000
+G1X569.957Y0.022
+G1X570.457Y0.000
+G1X570.956Y0.022
+G1X571.456Y0.000
+G1X571.955Y0.022
+G1X572.455Y0.000
+G1X572.954Y0.022
+G1X573.454Y0.000
+G1X573.953Y0.022
+G1X574.453Y0.000
+G1X574.952Y0.022
+G1X575.452Y0.000
+G1X575.951Y0.022
+G1X576.451Y0.000
+G1X576.950Y0.022
+G1X577.450Y0.000
+G1X577.949Y0.022
+G1X578.449Y0.000
+G1X578.948Y0.022
+G1X579.448Y0.000
+G1X579.947Y0.022
+G1X580.447Y0.000
+G1X580.947Y0.022
+G1X581.446Y0.000
+G1X581.946Y0.022
+G1X582.445Y0.000
+G1X582.945Y0.022
+G1X583.444Y0.000
+G1X583.944Y0.022
+G1X584.443Y0.000
+G1X584.943Y0.022
+G1X585.442Y0.000
+G1X585.942Y0.022
+G1X586.441Y0.000
+G1X586.941Y0.022
+G1X587.440Y0.000
+G1X587.940Y0.022
+G1X588.439Y0.000
+G1X588.939Y0.022
+G1X589.438Y0.000
+G1X589.938Y0.022
+G1X590.437Y0.000
+G1X590.937Y0.022
+G1X591.437Y0.000
+G1X591.936Y0.022
+G1X592.436Y0.000
+G1X592.935Y0.022
+G1X593.435Y0.000
+G1X593.934Y0.022
+G1X594.434Y0.000
+G1X594.933Y0.022
+G1X595.433Y0.000
+G1X595.932Y0.022
+G1X596.432Y0.000
+G1X596.931Y0.022
+G1X597.431Y0.000
+G1X597.930Y0.022
+G1X598.430Y0.000
+G1X598.929Y0.022
+G1X599.429Y0.000
+G1X599.928Y0.022
+G1X600.428Y0.000
+G1X600.928Y0.022
+G1X601.427Y0.000
+G1X601.927Y0.022
+G1X602.426Y0.000
+G1X602.926Y0.022
+G1X603.425Y0.000
+G1X603.925Y0.022
+G1X604.424Y0.000
+G1X604.924Y0.022
+G1X605.423Y0.000
+G1X605.923Y0.022
+G1X606.422Y0.000
+G1X606.922Y0.022
+G1X607.421Y0.000
+G1X607.921Y0.022
+G1X608.420Y0.000
+G1X608.920Y0.022
+G1X609.419Y0.000
+G1X609.919Y0.022
+G1X610.418Y0.000
+G1X610.918Y0.022
+G1X611.418Y0.000
+G1X611.917Y0.022
+G1X612.417Y0.000
+G1X612.916Y0.022
+G1X613.416Y0.000
+G1X613.915Y0.022
+G1X614.415Y0.000
+G1X614.914Y0.022
+G1X615.414Y0.000
+G1X615.913Y0.022
+G1X616.413Y0.000
+G1X616.912Y0.022
+G1X617.412Y0.000
+G1X617.911Y0.022
+G1X618.411Y0.000
+G1X618.910Y0.022
+G1X619.410Y0.000
+G1X619.909Y0.022
+G1X620.409Y0.000
+G1X620.908Y0.022
+G1X621.408Y0.000
+G1X621.908Y0.022
+G1X622.407Y0.000
+G1X622.907Y0.022
+G1X623.406Y0.000
+G1X623.906Y0.022
+G1X624.405Y0.000
+G1X624.905Y0.022
+G1X625.404Y0.000
+G1X625.904Y0.022
+G1X626.403Y0.000
+G1X626.903Y0.022
+G1X627.402Y0.000
+G1X627.902Y0.022
+G1X628.401Y0.000
+G1X628.901Y0.022
+G1X629.400Y0.000
+G1X629.900Y0.022
+G1X630.399Y0.000
+G1X630.899Y0.022
+G1X631.398Y0.000
+G1X631.898Y0.022
+G1X632.398Y0.000
+G1X632.897Y0.022
+G1X633.397Y0.000
+G1X633.896Y0.022
+G1X634.396Y0.000
+G1X634.895Y0.022
+G1X635.395Y0.000
+G1X635.894Y0.022
+G1X636.394Y0.000
+G1X636.893Y0.022
+G1X637.393Y0.000
+G1X637.892Y0.022
+G1X638.392Y0.000
+G1X638.891Y0.022
+G1X639.391Y0.000
+G1X639.890Y0.022
+G1X640.390Y0.000
+G1X640.889Y0.022
+G1X641.389Y0.000
+G1X641.888Y0.022
+G1X642.388Y0.000
+G1X642.888Y0.022
+G1X643.387Y0.000
+G1X643.887Y0.022
+G1X644.386Y0.000
+G1X644.886Y0.022
+G1X645.385Y0.000
+G1X645.885Y0.022
+G1X646.384Y0.000
+G1X646.884Y0.022
+G1X647.383Y0.000
+G1X647.883Y0.022
+G1X648.382Y0.000
+G1X648.882Y0.022
+G1X649.381Y0.000
+G1X649.881Y0.022
+G1X650.380Y0.000
+G1X650.880Y0.022
+G1X651.379Y0.000
+G1X651.879Y0.022
+G1X652.378Y0.000
+G1X652.878Y0.022
+G1X653.378Y0.000
+G1X653.877Y0.022
+G1X654.377Y0.000
+G1X654.876Y0.022
+G1X655.376Y0.000
+G1X655.875Y0.022
+G1X656.375Y0.000
+G1X656.874Y0.022
+G1X657.374Y0.000
+G1X657.873Y0.022
+G1X658.373Y0.000
+G1X658.872Y0.022
+G1X659.372Y0.000
+G1X659.871Y0.022
+G1X660.371Y0.000
+G1X660.870Y0.022
+G1X661.370Y0.000
+G1X661.869Y0.022
+G1X662.369Y0.000
+G1X662.868Y0.022
+G1X663.368Y0.000
+G1X663.868Y0.022
+G1X664.367Y0.000
+G1X664.867Y0.022
+G1X665.366Y0.000
+G1X665.866Y0.022
+G1X666.365Y0.000
+G1X666.865Y0.022
+G1X667.364Y0.000
+G1X667.864Y0.022
+G1X668.363Y0.000
+G1X668.863Y0.022
+G1X669.362Y0.000
+G1X669.862Y0.022
+G1X670.361Y0.000
+G1X670.861Y0.022
+G1X671.360Y0.000
+G1X671.860Y0.022
+G1X672.359Y0.000
+G1X672.859Y0.022
+G1X673.359Y0.000
+G1X673.858Y0.022
+G1X674.358Y0.000
+G1X674.857Y0.022
+G1X675.357Y0.000
+G1X675.856Y0.022
+G1X676.356Y0.000
+G1X676.855Y0.022
+G1X677.355Y0.000
+G1X677.854Y0.022
+G1X678.354Y0.000
+G1X678.853Y0.022
+G1X679.353Y0.000
+G1X679.852Y0.022
+G1X680.352Y0.000
+G1X680.851Y0.022
+G1X681.351Y0.000
+G1X681.850Y0.022
+G1X682.350Y0.000
+G1X682.849Y0.022
+G1X683.349Y0.000
+G1X683.849Y0.022
+G1X684.348Y0.000
+G1X684.848Y0.022
+G1X685.347Y0.000
+G1X685.847Y0.022
+G1X686.346Y0.000
+G1X686.846Y0.022
+G1X687.345Y0.000
+G1X687.845Y0.022
+G1X688.344Y0.000
+G1X688.844Y0.022
+G1X689.343Y0.000
+G1X689.843Y0.022
+G1X690.342Y0.000
+G1X690.842Y0.022
+G1X691.341Y0.000
+G1X691.841Y0.022
+G1X692.340Y0.000
+G1X692.840Y0.022
+G1X693.339Y0.000
+G1X693.839Y0.022
+G1X694.339Y0.000
+G1X694.838Y0.022
+G1X695.338Y0.000
+G1X695.837Y0.022
+G1X696.337Y0.000
+G1X696.836Y0.022
+G1X697.336Y0.000
+G1X697.835Y0.022
+G1X698.335Y0.000
+G1X698.834Y0.022
+G1X699.334Y0.000
+G1X699.833Y0.022
+G1X700.333Y0.000
+G1X700.832Y0.022
+G1X701.332Y0.000
+G1X701.831Y0.022
+G1X702.331Y0.000
+G1X702.830Y0.022
+G1X703.330Y0.000
+G1X703.829Y0.022
+G1X704.329Y0.000
+G1X704.829Y0.022
+G1X705.328Y0.000
+G1X705.828Y0.022
+G1X706.327Y0.000
+G1X706.827Y0.022
+G1X707.326Y0.000
+G1X707.826Y0.022
+G1X708.325Y0.000
+G1X708.825Y0.022
+G1X709.324Y0.000
+G1X709.824Y0.022
+G1X710.323Y0.000
+G1X710.823Y0.022
+G1X711.322Y0.000
+G1X711.822Y0.022
+G1X712.321Y0.000
+G1X712.821Y0.022
+G1X713.320Y0.000
+G1X713.820Y0.022
+G1X714.319Y0.000
+G1X714.819Y0.022
+G1X715.319Y0.000
+G1X715.818Y0.022
+G1X716.318Y0.000
+G1X716.817Y0.022
+G1X717.317Y0.000
+G1X717.816Y0.022
+G1X718.316Y0.000
+G1X718.815Y0.022
+G1X719.315Y0.000
+G1X719.814Y0.022
+G1X720.314Y0.000
+G1X720.813Y0.022
+G1X721.313Y0.000
+G1X721.812Y0.022
+G1X722.312Y0.000
+G1X722.811Y0.022
+G1X723.311Y0.000
+G1X723.810Y0.022
+G1X724.310Y0.000
+G1X724.809Y0.022
+G1X725.309Y0.000
+G1X725.809Y0.022
+G1X726.308Y0.000
+G1X726.808Y0.022
+G1X727.307Y0.000
+G1X727.807Y0.022
+G1X728.306Y0.000
+G1X728.806Y0.022
+G1X729.305Y0.000
+G1X729.805Y0.022
+G1X730.304Y0.000
+G1X730.804Y0.022
+G1X731.303Y0.000
+G1X731.803Y0.022
+G1X732.302Y0.000
+G1X732.802Y0.022
+G1X733.301Y0.000
+G1X733.801Y0.022
+G1X734.300Y0.000
+G1X734.800Y0.022
+G1X735.299Y0.000
+G1X735.799Y0.022
+G1X736.299Y0.000
+G1X736.798Y0.022
+G1X737.298Y0.000
+G1X737.797Y0.022
+G1X738.297Y0.000
+G1X738.796Y0.022
+G1X739.296Y0.000
+G1X739.795Y0.022
+G1X740.295Y0.000
+G1X740.794Y0.022
+G1X741.294Y0.000
+G1X741.793Y0.022
+G1X742.293Y0.000
+G1X742.792Y0.022
+G1X743.292Y0.000
+G1X743.791Y0.022
+G1X744.291Y0.000
+G1X744.790Y0.022
+G1X745.290Y0.000
+G1X745.789Y0.022
+G1X746.289Y0.000
+G1X746.789Y0.022
+G1X747.288Y0.000
+G1X747.788Y0.022
+G1X748.287Y0.000
+G1X748.787Y0.022
+G1X749.286Y0.000
+G1X749.786Y0.022
+G1X750.285Y0.000
+G1X750.785Y0.022
+G1X751.284Y0.000
+G1X751.784Y0.022
+G1X752.283Y0.000
+G1X752.783Y0.022
+G1X753.282Y0.000
+G1X753.782Y0.022
+G1X754.281Y0.000
+G1X754.781Y0.022
+G1X755.280Y0.000
+G1X755.780Y0.022
+G1X756.280Y0.000
+G1X756.779Y0.022
+G1X757.279Y0.000
+G1X757.778Y0.022
+G1X758.278Y0.000
+G1X758.777Y0.022
+G1X759.277Y0.000
+G1X759.776Y0.022
+G1X760.276Y0.000
+G1X760.775Y0.022
+G1X761.275Y0.000
+G1X761.774Y0.022
+G1X762.274Y0.000
+G1X762.773Y0.022
+G1X763.273Y0.000
+G1X763.772Y0.022
+G1X764.272Y0.000
+G1X764.771Y0.022
+G1X765.271Y0.000
+G1X765.770Y0.022
+G1X766.270Y0.000
+G1X766.770Y0.022
+G1X767.269Y0.000
+G1X767.769Y0.022
+G1X768.268Y0.000
+G1X768.768Y0.022
+G1X769.267Y0.000
+G1X769.767Y0.022
+G1X770.266Y0.000
+G1X770.766Y0.022
+G1X771.265Y0.000
+G1X771.765Y0.022
+G1X772.264Y0.000
+G1X772.764Y0.022
+G1X773.263Y0.000
+G1X773.763Y0.022
+G1X774.262Y0.000
+G1X774.762Y0.022
+G1X775.261Y0.000
+G1X775.761Y0.022
+G1X776.260Y0.000
+G1X776.760Y0.022
+G1X777.260Y0.000
+G1X777.759Y0.022
+G1X778.259Y0.000
+G1X778.758Y0.022
+G1X779.258Y0.000
+G1X779.757Y0.022
+G1X780.257Y0.000
+G1X780.756Y0.022
+G1X781.256Y0.000
+G1X781.755Y0.022
+G1X782.255Y0.000
+G1X782.754Y0.022
+G1X783.254Y0.000
+G1X783.753Y0.022
+G1X784.253Y0.000
+G1X784.752Y0.022
+G1X785.252Y0.000
+G1X785.751Y0.022
+G1X786.251Y0.000
+G1X786.750Y0.022
+G1X787.250Y0.000
+G1X787.750Y0.022
+G1X788.249Y0.000
+G1X788.749Y0.022
+G1X789.248Y0.000
+G1X789.748Y0.022
+G1X790.247Y0.000
+G1X790.747Y0.022
+G1X791.246Y0.000
+G1X791.746Y0.022
+G1X792.245Y0.000
+G1X792.745Y0.022
+G1X793.244Y0.000
+G1X793.744Y0.022
+G1X794.243Y0.000
+G1X794.743Y0.022
+G1X795.242Y0.000
+G1X795.742Y0.022
+G1X796.241Y0.000
+G1X796.741Y0.022
+G1X797.240Y0.000
+G1X797.740Y0.022
+G1X798.240Y0.000
+G1X798.739Y0.022
+G1X799.239Y0.000
@@ -0,0 +1,66 @@
+G21G90G94G17
+G0X0Y0
+F3000
+G61
+G1X2Y2
+G1X4Y0
+G1X6Y2
+G1X8Y0
+G1X10Y2
+G1X12Y0
+G1X14Y2
+G1X16Y0
+G1X18Y2
+G1X20Y0
+G0X0Y0
+G64P0.005
+G1X2Y2
+G1X4Y0
+G1X6Y2
+G1X8Y0
+G1X10Y2
+G1X12Y0
+G1X14Y2
+G1X16Y0
+G1X18Y2
+G1X20Y0
+G0X0Y0
+G64P0.5
+G1X2Y2
+G1X4Y0
+G1X6Y2
+G1X8Y0
+G1X10Y2
+G1X12Y0
+G1X14Y2
+G1X16Y0
+G1X18Y2
+G1X20Y0
+G0X0Y0
+G64
+G1X2Y2
+G1X4Y0
+G1X6Y2
+G1X8Y0
+G1X10Y2
+G1X12Y0
+G1X14Y2
+G1X16Y0
+G1X18Y2
+G1X20Y0
+G0X0Y0
+G61.1
+G1X2Y2
+G1X4Y0
+G1X6Y2
+G1X8Y0
+G1X10Y2
+G1X12Y0
+G1X14Y2
+G1X16Y0
+G1X18Y2
+G1X20Y0
+G0X0Y0
+G61
+$G
+M2
@@ -0,0 +1,7 @@
+G21G90G94G17
+G0X0Y0
+F2000
+G5X20Y0I5J10P-5Q10
+G5X40Y0P-5Q-10
+G5.1X60Y0I10J-15
+M2
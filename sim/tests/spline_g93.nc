@@ -0,0 +1,3 @@
+G21G90G17
+G93 G5 I10 J0 P-10 Q0 X20 Y0 F6
+M30
@@ -0,0 +1,109 @@
+/*
+  trace.c - 步进/方向脉冲跟踪的二进制格式
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+#include <string.h>
+#include <stdbool.h>
+#include "trace.h"
+
+
+static void trace_put_u32(FILE *file, uint32_t value)
+{
+  uint8_t i;
+  for (i = 0; i < 4; i++) { fputc((value >> (8 * i)) & 0xff, file); }
+}
+
+
+uint8_t trace_create(trace_t *trace, const char *path, uint32_t f_cpu, uint8_t n_axis)
+{
+  memset(trace, 0, sizeof(trace_t));
+  trace->file = fopen(path, "wb");
+  if (trace->file == NULL) { return (false); }
+  trace->f_cpu = f_cpu;
+  trace->n_axis = n_axis;
+  fwrite(TRACE_MAGIC, 1, TRACE_MAGIC_SIZE, trace->file);
+  trace_put_u32(trace->file, f_cpu);
+  fputc(n_axis, trace->file);
+  return (true);
+}
+
+
+void trace_write(trace_t *trace, uint64_t cycles, uint8_t step_bits, uint8_t dir_bits)
+{
+  uint64_t delta = cycles - trace->cycles;
+  uint8_t dir_changed = (dir_bits != trace->dir_bits);
+  if (!step_bits && !dir_changed) { return; }
+
+  do {
+    uint8_t byte = delta & 0x7f;
+    delta >>= 7;
+    if (delta) { byte |= 0x80; }
+    fputc(byte, trace->file);
+  } while (delta);
+  fputc(step_bits | (dir_changed ? TRACE_FLAG_DIRECTION : 0), trace->file);
+  if (dir_changed) { fputc(dir_bits, trace->file); }
+
+  trace->cycles = cycles;
+  trace->step_bits = step_bits;
+  trace->dir_bits = dir_bits;
+}
+
+
+uint8_t trace_open(trace_t *trace, const char *path)
+{
+  char magic[TRACE_MAGIC_SIZE];
+  uint8_t header[5];
+  memset(trace, 0, sizeof(trace_t));
+  trace->file = fopen(path, "rb");
+  if (trace->file == NULL) { return (false); }
+  if ((fread(magic, 1, TRACE_MAGIC_SIZE, trace->file) != TRACE_MAGIC_SIZE) ||
+      memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_SIZE) ||
+      (fread(header, 1, 5, trace->file) != 5)) {
+    fclose(trace->file);
+    trace->file = NULL;
+    return (false);
+  }
+  trace->f_cpu = header[0] | (header[1] << 8) | ((uint32_t)header[2] << 16) | ((uint32_t)header[3] << 24);
+  trace->n_axis = header[4];
+  return (true);
+}
+
+
+uint8_t trace_read(trace_t *trace)
+{
+  uint64_t delta = 0;
+  uint8_t shift = 0;
+  int c;
+  do {
+    if ((c = fgetc(trace->file)) == EOF) { return (false); }
+    delta |= (uint64_t)(c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+  if ((c = fgetc(trace->file)) == EOF) { return (false); }
+  trace->cycles += delta;
+  trace->step_bits = c & ~TRACE_FLAG_DIRECTION;
+  if (c & TRACE_FLAG_DIRECTION) {
+    if ((c = fgetc(trace->file)) == EOF) { return (false); }
+    trace->dir_bits = c;
+  }
+  return (true);
+}
+
+
+void trace_close(trace_t *trace)
+{
+  if (trace->file) { fclose(trace->file); }
+  trace->file = NULL;
+}
@@ -0,0 +1,62 @@
+/*
+  trace.h - 步进/方向脉冲跟踪的二进制格式
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  文件格式（小端）：
+    文件头  8 字节魔数 "GRBLSTP1"，uint32 F_CPU，uint8 轴数
+    记录    可变长整数（LEB128）：距上一条记录的 CPU 周期数
+            uint8  步进位掩码，位 n 为轴 n（X=0 ... D=6）在该时刻产生上升沿；
+                   位 7 置位表示其后跟随一个方向字节
+            [uint8 方向位掩码，位 n 置位表示轴 n 向负方向运动]
+  只在有步进脉冲或方向改变时写记录，典型记录为 2-3 字节。
+  掩码已去除 $2/$3 的引脚反转，因此不同反转设置下的跟踪可以直接比较。
+*/
+
+#ifndef trace_h
+#define trace_h
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_MAGIC "GRBLSTP1"
+#define TRACE_MAGIC_SIZE 8
+#define TRACE_MAX_AXIS 7
+#define TRACE_FLAG_DIRECTION 0x80
+
+typedef struct {
+  FILE *file;
+  uint32_t f_cpu;
+  uint8_t n_axis;
+  uint64_t cycles;    // 当前记录的绝对时间
+  uint8_t step_bits;  // 当前记录的步进位
+  uint8_t dir_bits;   // 当前有效的方向位
+} trace_t;
+
+// 创建跟踪文件并写入文件头。成功时返回 true。
+uint8_t trace_create(trace_t *trace, const char *path, uint32_t f_cpu, uint8_t n_axis);
+
+// 追加一条记录。cycles 为绝对时间，必须单调不减。
+void trace_write(trace_t *trace, uint64_t cycles, uint8_t step_bits, uint8_t dir_bits);
+
+// 打开跟踪文件并读取文件头。成功时返回 true。
+uint8_t trace_open(trace_t *trace, const char *path);
+
+// 读取下一条记录到 trace->cycles/step_bits/dir_bits。文件结束时返回 false。
+uint8_t trace_read(trace_t *trace);
+
+void trace_close(trace_t *trace);
+
+#endif
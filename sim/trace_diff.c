@@ -0,0 +1,197 @@
+/*
+  trace_diff.c - 比较两个步进/方向跟踪文件
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+  用法：trace_diff [-t 容差微秒] 基准.trc 新.trc
+        trace_diff -s 跟踪.trc
+
+    逐轴按顺序配对两次运行的第 k 个步进脉冲。位置一致要求每个轴的步数和每一步的方向完全
+  相同，即两次运行经过的机器位置序列相同；时间偏差为新跟踪减去基准跟踪的脉冲时间，正值表示
+  变慢。输出每轴步数、终点位置、最大提前/滞后及作业结束时间。
+    -s 只读取一个跟踪，输出每轴步数、终点位置、结束时间和两个 64 位 FNV-1a 散列：位置散列只
+  包含各轴每一步的方向，时间散列还包含每条记录的时间。摘要是文本，可以代替体积很大的跟踪文件
+  作为 make check 的期望结果保存；两次运行的摘要相同即跟踪相同，不同时再用两个跟踪文件比较细节。
+    退出状态：0 位置一致且（指定 -t 时）最大偏差不超过容差；1 不满足；2 文件错误。
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "trace.h"
+
+typedef struct {
+  uint64_t *cycles; // 每个步进脉冲的时间
+  uint8_t *dir;     // 每个步进脉冲的方向，1 为负方向
+  uint32_t count;
+  uint32_t size;
+  int32_t position; // 终点位置，以步为单位
+} axis_steps_t;
+
+typedef struct {
+  axis_steps_t axis[TRACE_MAX_AXIS];
+  uint8_t n_axis;
+  uint32_t f_cpu;
+  uint64_t end_cycles;
+} run_t;
+
+
+static void axis_push(axis_steps_t *axis, uint64_t cycles, uint8_t dir)
+{
+  if (axis->count == axis->size) {
+    axis->size = axis->size ? 2 * axis->size : 4096;
+    axis->cycles = realloc(axis->cycles, axis->size * sizeof(uint64_t));
+    axis->dir = realloc(axis->dir, axis->size);
+    if (!axis->cycles || !axis->dir) { fprintf(stderr, "内存不足\n"); exit(2); }
+  }
+  axis->cycles[axis->count] = cycles;
+  axis->dir[axis->count] = dir;
+  axis->count++;
+  axis->position += dir ? -1 : 1;
+}
+
+
+static uint8_t run_load(run_t *run, const char *path)
+{
+  trace_t trace;
+  uint8_t idx;
+  memset(run, 0, sizeof(run_t));
+  if (!trace_open(&trace, path)) { return (false); }
+  run->n_axis = (trace.n_axis < TRACE_MAX_AXIS) ? trace.n_axis : TRACE_MAX_AXIS;
+  run->f_cpu = trace.f_cpu;
+  while (trace_read(&trace)) {
+    for (idx = 0; idx < run->n_axis; idx++) {
+      if (trace.step_bits & (1 << idx)) { axis_push(&run->axis[idx], trace.cycles, (trace.dir_bits >> idx) & 1); }
+    }
+    run->end_cycles = trace.cycles;
+  }
+  trace_close(&trace);
+  return (true);
+}
+
+
+static const char axis_name[TRACE_MAX_AXIS] = { 'X', 'Y', 'Z', 'A', 'B', 'C', 'D' };
+
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+static uint64_t fnv_byte(uint64_t hash, uint8_t byte) { return ((hash ^ byte) * FNV_PRIME); }
+
+
+static int summarize(const char *path)
+{
+  trace_t trace;
+  uint64_t position_hash = FNV_OFFSET, time_hash = FNV_OFFSET, previous = 0, n_record = 0;
+  uint32_t count[TRACE_MAX_AXIS] = { 0 };
+  int32_t position[TRACE_MAX_AXIS] = { 0 };
+  uint8_t idx;
+  if (!trace_open(&trace, path)) { fprintf(stderr, "无法读取跟踪文件 %s\n", path); return (2); }
+  uint8_t n_axis = (trace.n_axis < TRACE_MAX_AXIS) ? trace.n_axis : TRACE_MAX_AXIS;
+  while (trace_read(&trace)) {
+    uint64_t delta = trace.cycles - previous;
+    previous = trace.cycles;
+    n_record++;
+    for (idx = 0; idx < 8; idx++) { time_hash = fnv_byte(time_hash, (delta >> (8 * idx)) & 0xff); }
+    time_hash = fnv_byte(fnv_byte(time_hash, trace.step_bits), trace.dir_bits);
+    if (!trace.step_bits) { continue; } // 只改变方向的记录不影响位置序列
+    position_hash = fnv_byte(fnv_byte(position_hash, trace.step_bits), trace.dir_bits & trace.step_bits);
+    for (idx = 0; idx < n_axis; idx++) {
+      if (trace.step_bits & (1 << idx)) {
+        count[idx]++;
+        position[idx] += ((trace.dir_bits >> idx) & 1) ? -1 : 1;
+      }
+    }
+  }
+  trace_close(&trace);
+
+  printf("记录 %llu 条，F_CPU %lu\n", (unsigned long long)n_record, (unsigned long)trace.f_cpu);
+  printf("轴        步数       终点\n");
+  for (idx = 0; idx < n_axis; idx++) {
+    printf("%c  %11lu %10ld\n", axis_name[idx], (unsigned long)count[idx], (long)position[idx]);
+  }
+  printf("结束时间：%.6f 秒\n", previous / (double)trace.f_cpu);
+  printf("位置散列：%016llx\n", (unsigned long long)position_hash);
+  printf("时间散列：%016llx\n", (unsigned long long)time_hash);
+  return (0);
+}
+
+
+int main(int argc, char *argv[])
+{
+  double tolerance_us = -1.0;
+  uint8_t summary = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "t:s")) != -1) {
+    switch (opt) {
+      case 't': tolerance_us = atof(optarg); break;
+      case 's': summary = true; break;
+      default: optind = argc; break;
+    }
+  }
+  if (summary && (argc - optind == 1)) { return (summarize(argv[optind])); }
+  if (summary || (argc - optind != 2)) {
+    fprintf(stderr, "用法：%s [-t 容差微秒] 基准.trc 新.trc\n      %s -s 跟踪.trc\n", argv[0], argv[0]);
+    return (2);
+  }
+
+  static run_t base, test;
+  if (!run_load(&base, argv[optind])) { fprintf(stderr, "无法读取跟踪文件 %s\n", argv[optind]); return (2); }
+  if (!run_load(&test, argv[optind + 1])) { fprintf(stderr, "无法读取跟踪文件 %s\n", argv[optind + 1]); return (2); }
+  if ((base.f_cpu != test.f_cpu) || (base.n_axis != test.n_axis)) {
+    fprintf(stderr, "跟踪文件的时钟频率或轴数不同\n");
+    return (2);
+  }
+  double us_per_cycle = 1e6 / base.f_cpu;
+
+  uint8_t positions_match = true;
+  int64_t max_late = 0, max_early = 0; // 新跟踪相对基准的最大滞后和最大提前（周期）
+  uint8_t late_axis = 0, early_axis = 0;
+  uint32_t late_step = 0, early_step = 0;
+  uint8_t idx;
+
+  printf("轴    基准步数     新步数   基准终点     新终点  首个不一致\n");
+  for (idx = 0; idx < base.n_axis; idx++) {
+    axis_steps_t *a = &base.axis[idx], *b = &test.axis[idx];
+    uint32_t n = (a->count < b->count) ? a->count : b->count;
+    uint32_t k, mismatch = n;
+    for (k = 0; k < n; k++) {
+      if (a->dir[k] != b->dir[k]) { mismatch = k; break; }
+      int64_t dev = (int64_t)(b->cycles[k] - a->cycles[k]);
+      if (dev > max_late) { max_late = dev; late_axis = idx; late_step = k; }
+      if (dev < max_early) { max_early = dev; early_axis = idx; early_step = k; }
+    }
+    if ((mismatch == n) && (a->count == b->count)) { mismatch = UINT32_MAX; } // 完全一致
+    if (mismatch != UINT32_MAX) { positions_match = false; }
+    printf("%c  %11lu %10lu %10ld %10ld  ", axis_name[idx], (unsigned long)a->count, (unsigned long)b->count,
+           (long)a->position, (long)b->position);
+    if (mismatch == UINT32_MAX) { printf("-\n"); } else { printf("第 %lu 步\n", (unsigned long)mismatch); }
+  }
+
+  printf("位置序列：%s\n", positions_match ? "一致" : "不一致");
+  printf("最大滞后：%.3f 微秒（%c 轴第 %lu 步）\n", max_late * us_per_cycle, axis_name[late_axis], (unsigned long)late_step);
+  printf("最大提前：%.3f 微秒（%c 轴第 %lu 步）\n", -max_early * us_per_cycle, axis_name[early_axis], (unsigned long)early_step);
+  printf("结束时间：基准 %.6f 秒，新 %.6f 秒，差值 %+.6f 秒\n", base.end_cycles / (double)base.f_cpu,
+         test.end_cycles / (double)test.f_cpu, ((double)test.end_cycles - (double)base.end_cycles) / base.f_cpu);
+
+  if (!positions_match) { return (1); }
+  if (tolerance_us >= 0) {
+    double max_dev = ((max_late > -max_early) ? max_late : -max_early) * us_per_cycle;
+    if (max_dev > tolerance_us) { return (1); }
+  }
+  return (0);
+}
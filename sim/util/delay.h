@@ -0,0 +1,29 @@
+/*
+  util/delay.h - 主机仿真用的忙等待延时替身
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+// 延时不再空转 CPU，而是让虚拟时钟前进相应的周期数。
+
+#ifndef util_delay_h
+#define util_delay_h
+
+#include <stdint.h>
+
+void sim_delay_cycles(uint32_t cycles);
+
+#define _delay_ms(ms) sim_delay_cycles((uint32_t)((ms) * (F_CPU / 1000UL)))
+#define _delay_us(us) sim_delay_cycles((uint32_t)((us) * (F_CPU / 1000000UL)))
+
+#endif
@@ -0,0 +1,118 @@
+/*
+  status_push.c - 定时自动推送状态报告
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+/*
+    定时器 5 以 CTC 模式按推送间隔产生比较匹配中断，中断只设置标志。主程序在实时检查点
+  确认发送缓冲区至少能放下一条状态报告，并且报告的内容自上次推送后有变化，然后设置
+  EXEC_STATUS_REPORT，由与 '?' 相同的路径打印报告，WCO 和倍率字段的刷新计数照常生效。
+*/
+
+#include "grbl.h"
+
+#ifdef ENABLE_STATUS_PUSH
+
+#define STATUS_PUSH_TICKS_PER_MS (F_CPU / 1024.0 / 1000.0)
+
+// 状态报告所依据的数据。内容相同时报告也相同，不必推送。
+typedef struct {
+  int32_t position[N_AXIS];
+  float wco[N_AXIS];
+  float realtime_rate;
+  float spindle_speed;
+  float feed_rate;
+  float programmed_spindle_speed;
+  int32_t line_number;
+  uint8_t state;
+  uint8_t suspend;
+  uint8_t override[3];
+  uint8_t pins[3];
+  uint8_t accessory;
+  uint8_t spindle_modal;
+  uint8_t coord_select;
+  uint8_t tool;
+} status_push_snapshot_t;
+
+static status_push_snapshot_t status_push_last;
+static volatile uint8_t status_push_tick;
+
+
+void status_push_init()
+{
+  TIMSK5 &= ~(1 << OCIE5A);
+  TCCR5B = 0; // 停止定时器
+  TCCR5A = 0;
+  status_push_tick = false;
+  memset(&status_push_last, 0xff, sizeof(status_push_snapshot_t)); // 复位后的第一次推送总是发送
+  if (settings.status_push_interval == 0) { return; }
+
+  uint16_t interval = min(settings.status_push_interval, STATUS_PUSH_INTERVAL_MAX);
+  OCR5A = (uint16_t)(interval * STATUS_PUSH_TICKS_PER_MS) - 1;
+  TCNT5 = 0;
+  TCCR5B = (1 << WGM52) | (1 << CS52) | (1 << CS50); // CTC 模式，1/1024 预分频
+  TIMSK5 |= (1 << OCIE5A);
+}
+
+
+ISR(TIMER5_COMPA_vect) { status_push_tick = true; }
+
+
+static void status_push_snapshot(status_push_snapshot_t *snapshot)
+{
+  uint8_t idx;
+  memset(snapshot, 0, sizeof(status_push_snapshot_t));
+  memcpy(snapshot->position, sys_position, sizeof(sys_position));
+  for (idx = 0; idx < N_AXIS; idx++) {
+    snapshot->wco[idx] = gc_state.coord_system[idx] + gc_state.coord_offset[idx];
+  }
+  snapshot->wco[TOOL_LENGTH_OFFSET_AXIS] += gc_state.tool_length_offset;
+  snapshot->realtime_rate = st_get_realtime_rate();
+  snapshot->spindle_speed = sys.spindle_speed;
+  snapshot->feed_rate = gc_state.feed_rate;
+  snapshot->programmed_spindle_speed = gc_state.spindle_speed;
+  plan_block_t *cur_block = plan_get_current_block();
+  if (cur_block != NULL) { snapshot->line_number = cur_block->line_number; }
+  snapshot->state = sys.state;
+  snapshot->suspend = sys.suspend;
+  snapshot->override[0] = sys.f_override;
+  snapshot->override[1] = sys.r_override;
+  snapshot->override[2] = sys.spindle_speed_ovr;
+  snapshot->pins[0] = limits_get_state();
+  snapshot->pins[1] = system_control_get_state();
+  snapshot->pins[2] = probe_get_state();
+  snapshot->accessory = spindle_get_state() | (coolant_get_state() << 2);
+  snapshot->spindle_modal = gc_state.modal.spindle;
+  snapshot->coord_select = gc_state.modal.coord_select;
+  snapshot->tool = settings.tool;
+}
+
+
+uint8_t status_push_due()
+{
+  if (!status_push_tick) { return (false); }
+  // 一条状态报告约 160 字节。空间不足时保留标志，等发送中断腾出空间后再推送。
+  if (serial_get_tx_buffer_count() > (TX_BUFFER_SIZE - STATUS_PUSH_MIN_TX_FREE)) { return (false); }
+  status_push_tick = false;
+
+  // WCO 或倍率字段的刷新计数到零时，即使其他内容不变也推送，让这些字段按时出现。
+  status_push_snapshot_t snapshot;
+  status_push_snapshot(&snapshot);
+  uint8_t refresh = (sys.report_wco_counter == 0) || (sys.report_ovr_counter == 0);
+  if (!refresh && (memcmp(&snapshot, &status_push_last, sizeof(status_push_snapshot_t)) == 0)) { return (false); }
+  memcpy(&status_push_last, &snapshot, sizeof(status_push_snapshot_t));
+  return (true);
+}
+
+#endif
@@ -0,0 +1,29 @@
+/*
+  status_push.h - 定时自动推送状态报告
+  Grbl 的一部分
+
+  Grbl 是自由软件：你可以在自由软件基金会发布的 GNU 通用公共许可证条款下重新分发和/或修改
+  它，许可证版本为 3，或（根据你的选择）任何更高版本。
+
+  Grbl 的发布是为了希望它能有用，
+  但不提供任何担保；甚至没有关于
+  适销性或适用于特定目的的隐含担保。有关详细信息，请参见
+  GNU 通用公共许可证。
+
+  你应该已经收到一份 GNU 通用公共许可证的副本
+  与 Grbl 一起。如果没有，请参见 <http://www.gnu.org/licenses/>。
+*/
+
+#ifndef status_push_h
+#define status_push_h
+
+#define STATUS_PUSH_INTERVAL_MAX 4000 // 毫秒。定时器 5 在 1/1024 预分频下约 4.19 秒溢出。
+
+// 按 $14 设置的间隔配置推送定时器。间隔为 0 时停止定时器。
+void status_push_init();
+
+// 推送间隔已到、发送缓冲区有足够空间且报告内容自上次推送后有变化时返回 true。
+// 发送缓冲区空间不足时推送延后到下一次调用，内容未变化时跳过本次推送。由主程序调用。
+uint8_t status_push_due();
+
+#endif
@@ -131,6 +131,8 @@ static volatile uint8_t busy;
 
 // 从规划缓冲区准备步进段的指针。仅由主程序访问。指针可以计划提前执行的段或规划块。
 static plan_block_t *pl_block;    // 指向准备的规划块的指针
+static volatile uint8_t pl_block_pending; // pl_block 不为空。步进中断检查欠载时读取此标志，不读取 16 位的指针。
+static uint16_t segment_underruns; // 规划器仍有运动时段缓冲区被取空的次数
 static st_block_t *st_prep_block; // 指向准备的步进块数据的指针
 
 // 段准备数据结构。包含基于当前执行的规划块计算新段所需的所有信息。
@@ -143,12 +145,29 @@ typedef struct
   float steps_remaining;
   float step_per_mm;
   float req_mm_increment;
+  float acceleration; // 执行块的加速度（mm/min^2），由规划块的 speed_sqr_delta 求出
+
+#ifdef ENABLE_NATIVE_ARCS
+  plan_arc_t *arc;           // 执行中的圆弧块的几何数据
+  float arc_millimeters;     // 圆弧块的总长度（mm）。为零时当前块为直线块。
+  float arc_radius_change;   // 终点半径相对起点半径的变化比例
+  float arc_max_chord;       // 弦高等于 $12 圆弧公差的弦长（mm）
+  int32_t arc_steps[N_AXIS]; // 已准备的段终点相对块起点的步数
+  uint8_t arc_block_used;    // st_prep_block 已被圆弧段使用，下一段需要新的步进块
+#endif
 
 #ifdef PARKING_ENABLE
   uint8_t last_st_block_index;
   float last_steps_remaining;
   float last_step_per_mm;
   float last_dt_remainder;
+#ifdef ENABLE_NATIVE_ARCS
+  float last_req_mm_increment;
+  float last_arc_millimeters;
+  float last_arc_radius_change;
+  float last_arc_max_chord;
+  int32_t last_arc_steps[N_AXIS];
+#endif
 #endif
 
   uint8_t ramp_type;      // 当前段的坡道状态
@@ -388,7 +407,12 @@ ISR(TIMER1_COMPA_vect)
     }
     else
     {
-      // 段缓冲区为空。关闭。
+      // 段缓冲区为空。关闭。规划器中仍有运动且不是暂停减速结束时，说明主程序没有及时准备段。
+      if ((pl_block_pending || (plan_get_current_block() != NULL)) &&
+          bit_isfalse(sys.step_control, STEP_CONTROL_END_MOTION))
+      {
+        segment_underruns++;
+      }
       st_go_idle();
       // 确保在速率控制运动完成时，PWM 设置正确。
       if (st.exec_block->is_pwm_rate_adjusted)
@@ -622,9 +646,11 @@ void st_reset()
   memset(&st, 0, sizeof(stepper_t));
   st.exec_segment = NULL;
   pl_block = NULL; // 规划器块指针，用于段缓冲区
+  pl_block_pending = false;
   segment_buffer_tail = 0;
   segment_buffer_head = 0; // 为空 = 尾部
   segment_next_head = 1;
+  segment_underruns = 0;
   busy = false;
 
   st_generate_step_dir_invert_masks();
@@ -635,6 +661,16 @@ void st_reset()
   DIRECTION_PORT = (DIRECTION_PORT & ~DIRECTION_MASK) | dir_port_invert_mask;
 }
 
+// 返回复位以来段缓冲区欠载的次数
+uint16_t st_get_underrun_count()
+{
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t count = segment_underruns;
+  SREG = sreg;
+  return (count);
+}
+
 // 初始化并启动步进电机子系统
 void stepper_init()
 {
@@ -669,6 +705,7 @@ void st_update_plan_block_parameters()
     prep.recalculate_flag |= PREP_FLAG_RECALCULATE;
     pl_block->entry_speed_sqr = prep.current_speed * prep.current_speed; // 更新进入速度。
     pl_block = NULL;                                                     // 标记 st_prep_segment() 加载并检查活动速度轮廓。
+    pl_block_pending = false;
   }
 }
 
@@ -694,11 +731,19 @@ void st_parking_setup_buffer()
     prep.last_steps_remaining = prep.steps_remaining;
     prep.last_dt_remainder = prep.dt_remainder;
     prep.last_step_per_mm = prep.step_per_mm;
+#ifdef ENABLE_NATIVE_ARCS
+    prep.last_req_mm_increment = prep.req_mm_increment;
+    prep.last_arc_millimeters = prep.arc_millimeters;
+    prep.last_arc_radius_change = prep.arc_radius_change;
+    prep.last_arc_max_chord = prep.arc_max_chord;
+    memcpy(prep.last_arc_steps, prep.arc_steps, sizeof(prep.arc_steps));
+#endif
   }
   // 设置标志以执行停车动作
   prep.recalculate_flag |= PREP_FLAG_PARKING;
   prep.recalculate_flag &= ~(PREP_FLAG_RECALCULATE);
   pl_block = NULL; // 始终重置停车动作以重新加载新块。
+  pl_block_pending = false;
 }
 
 // 在停车动作后将步段缓冲区恢复到正常运行状态。
@@ -714,12 +759,146 @@ void st_parking_restore_buffer()
     prep.step_per_mm = prep.last_step_per_mm;
     prep.recalculate_flag = (PREP_FLAG_HOLD_PARTIAL_BLOCK | PREP_FLAG_RECALCULATE);
     prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR / prep.step_per_mm; // 重新计算该值。
+#ifdef ENABLE_NATIVE_ARCS
+    prep.arc_millimeters = prep.last_arc_millimeters;
+    prep.arc_radius_change = prep.last_arc_radius_change;
+    prep.arc_max_chord = prep.last_arc_max_chord;
+    memcpy(prep.arc_steps, prep.last_arc_steps, sizeof(prep.arc_steps));
+    prep.arc_block_used = true;
+    if (prep.arc_millimeters > 0.0)
+    {
+      prep.req_mm_increment = prep.last_req_mm_increment;
+    }
+#endif
   }
   else
   {
     prep.recalculate_flag = false;
   }
   pl_block = NULL; // 设置为重新加载下一个块。
+  pl_block_pending = false;
+}
+#endif
+
+#ifdef ENABLE_NATIVE_ARCS
+// 返回执行块在某轴上从起点到终点的带符号步数。
+static int32_t st_block_delta_steps(uint8_t idx)
+{
+  if (pl_block->direction_bits & get_direction_pin_mask(idx))
+  {
+    return (-(int32_t)plan_get_block_steps(pl_block, idx));
+  }
+  return (plan_get_block_steps(pl_block, idx));
+}
+
+// 载入新块时初始化圆弧插补状态。直线块清除圆弧标记。
+static void st_prep_arc_block()
+{
+  memset(prep.arc_steps, 0, sizeof(prep.arc_steps));
+  prep.arc_block_used = false; // 载入时准备的步进块留给第一段
+  prep.arc_millimeters = 0.0;
+  if (!pl_block->arc_axes)
+  {
+    return;
+  }
+  prep.arc = plan_get_current_arc();
+  prep.arc_millimeters = pl_block->millimeters;
+
+  // 终点半径与起点半径可能略有差异（R 格式、坐标舍入），半径沿圆弧线性过渡，使最后一段不跳变。
+  uint8_t axis_0 = pl_block->arc_axes & 0x0f;
+  uint8_t axis_1 = pl_block->arc_axes >> 4;
+  float r_end_0 = st_block_delta_steps(axis_0) / settings.steps_per_mm[axis_0] - prep.arc->offset[0];
+  float r_end_1 = st_block_delta_steps(axis_1) / settings.steps_per_mm[axis_1] - prep.arc->offset[1];
+  float radius_sqr = prep.arc->offset[0] * prep.arc->offset[0] + prep.arc->offset[1] * prep.arc->offset[1];
+  prep.arc_radius_change = sqrt((r_end_0 * r_end_0 + r_end_1 * r_end_1) / radius_sqr) - 1.0;
+  prep.arc_max_chord = sqrt(8.0 * sqrt(radius_sqr) * settings.arc_tolerance);
+
+  // 块的总步数对圆弧没有意义（整圆为零），按平面轴中分辨率较低的轴保证每段至少一步。
+  prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR / min(settings.steps_per_mm[axis_0], settings.steps_per_mm[axis_1]);
+}
+
+// 准备圆弧块的一段：从上一段终点到圆弧上距块末端 mm_remaining 处的弦。返回弦的步事件数（最大轴
+// 步数）。不为零时把弦写入一个新的步进块，每段使用各自的 Bresenham 数据；为零时不改变任何状态。
+static uint16_t st_prep_arc_segment(float mm_remaining)
+{
+  int32_t target[N_AXIS];
+  uint8_t idx;
+  if (mm_remaining == 0.0)
+  {
+    // 块末端直接使用规划器的终点，不累积舍入误差。
+    for (idx = 0; idx < N_AXIS; idx++)
+    {
+      target[idx] = st_block_delta_steps(idx);
+    }
+  }
+  else
+  {
+    uint8_t axis_0 = pl_block->arc_axes & 0x0f;
+    uint8_t axis_1 = pl_block->arc_axes >> 4;
+    float fraction = 1.0 - mm_remaining / prep.arc_millimeters;
+    float angle = fraction * prep.arc->travel;
+    float cos_a = cos(angle);
+    float sin_a = sin(angle);
+    float scale = 1.0 + fraction * prep.arc_radius_change;
+    float r_0 = -prep.arc->offset[0] * scale; // 圆心到该点的半径向量在旋转前的值
+    float r_1 = -prep.arc->offset[1] * scale;
+    for (idx = 0; idx < N_AXIS; idx++)
+    {
+      if (idx == axis_0)
+      {
+        target[idx] = lround((prep.arc->offset[0] + r_0 * cos_a - r_1 * sin_a) * settings.steps_per_mm[idx]);
+      }
+      else if (idx == axis_1)
+      {
+        target[idx] = lround((prep.arc->offset[1] + r_0 * sin_a + r_1 * cos_a) * settings.steps_per_mm[idx]);
+      }
+      else
+      {
+        target[idx] = lround(fraction * st_block_delta_steps(idx));
+      }
+    }
+  }
+
+  uint32_t n_step = 0;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    n_step = max(n_step, (uint32_t)labs(target[idx] - prep.arc_steps[idx]));
+  }
+  if (n_step == 0)
+  {
+    return (0);
+  }
+
+  if (prep.arc_block_used)
+  {
+    uint8_t is_pwm_rate_adjusted = st_prep_block->is_pwm_rate_adjusted;
+    prep.st_block_index = st_next_block_index(prep.st_block_index);
+    st_prep_block = &st_block_buffer[prep.st_block_index];
+    st_prep_block->is_pwm_rate_adjusted = is_pwm_rate_adjusted;
+  }
+  prep.arc_block_used = true;
+  st_prep_block->direction_bits = 0;
+  for (idx = 0; idx < N_AXIS; idx++)
+  {
+    int32_t steps = target[idx] - prep.arc_steps[idx];
+    if (steps < 0)
+    {
+      st_prep_block->direction_bits |= get_direction_pin_mask(idx);
+      steps = -steps;
+    }
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+    st_prep_block->steps[idx] = (uint32_t)steps << MAX_AMASS_LEVEL;
+#else
+    st_prep_block->steps[idx] = steps;
+#endif
+  }
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+  st_prep_block->step_event_count = n_step << MAX_AMASS_LEVEL;
+#else
+  st_prep_block->step_event_count = n_step;
+#endif
+  memcpy(prep.arc_steps, target, sizeof(target));
+  return (n_step);
 }
 #endif
 
@@ -760,6 +939,7 @@ void st_prep_buffer()
       {
         return;
       } // 没有规划块。退出。
+      pl_block_pending = true;
 
       // 检查是否需要仅重新计算速度曲线或加载新块。
       if (prep.recalculate_flag & PREP_FLAG_RECALCULATE)
@@ -789,28 +969,34 @@ void st_prep_buffer()
         st_prep_block = &st_block_buffer[prep.st_block_index];
         st_prep_block->direction_bits = pl_block->direction_bits;
         uint8_t idx;
-#ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+        uint32_t step_event_count = 0; // 规划块不保存最大步数，在此求出。
         for (idx = 0; idx < N_AXIS; idx++)
         {
-          st_prep_block->steps[idx] = pl_block->steps[idx];
-        }
-        st_prep_block->step_event_count = pl_block->step_event_count;
+          uint32_t steps = plan_get_block_steps(pl_block, idx);
+          step_event_count = max(step_event_count, steps);
+#ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+          st_prep_block->steps[idx] = steps;
 #else
-        // 启用 AMASS 时，将所有布雷森汉数据简单地通过最大 AMASS
-        // 水平进行位移乘法，这样我们在算法中的任何地方都不会超出原始数据进行除法。
-        // 如果原始数据被除以，我们可能会因为整数舍入而丢失一个步进。
-        for (idx = 0; idx < N_AXIS; idx++)
-        {
-          st_prep_block->steps[idx] = pl_block->steps[idx] << MAX_AMASS_LEVEL;
+          // 启用 AMASS 时，将所有布雷森汉数据简单地通过最大 AMASS
+          // 水平进行位移乘法，这样我们在算法中的任何地方都不会超出原始数据进行除法。
+          // 如果原始数据被除以，我们可能会因为整数舍入而丢失一个步进。
+          st_prep_block->steps[idx] = steps << MAX_AMASS_LEVEL;
+#endif
         }
-        st_prep_block->step_event_count = pl_block->step_event_count << MAX_AMASS_LEVEL;
+#ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+        st_prep_block->step_event_count = step_event_count;
+#else
+        st_prep_block->step_event_count = step_event_count << MAX_AMASS_LEVEL;
 #endif
 
         // 初始化段缓冲区数据以生成段。
-        prep.steps_remaining = (float)pl_block->step_event_count;
+        prep.steps_remaining = (float)step_event_count;
         prep.step_per_mm = prep.steps_remaining / pl_block->millimeters;
         prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR / prep.step_per_mm;
         prep.dt_remainder = 0.0; // 为新的段块重置
+#ifdef ENABLE_NATIVE_ARCS
+        st_prep_arc_block();
+#endif
 
         if ((sys.step_control & STEP_CONTROL_EXECUTE_HOLD) || (prep.recalculate_flag & PREP_FLAG_DECEL_OVERRIDE))
         {
@@ -843,7 +1029,9 @@ void st_prep_buffer()
        保持，覆盖规划速度并减速到目标出口速度。
       */
       prep.mm_complete = 0.0; // 默认情况下速度曲线在块末尾0.0mm处完成。
-      float inv_2_accel = 0.5 / pl_block->acceleration;
+      // 规划块只保存 2*加速度*剩余距离，两者一起更新，每次载入或重新计算时求出加速度。
+      prep.acceleration = 0.5 * pl_block->speed_sqr_delta / pl_block->millimeters;
+      float inv_2_accel = 0.5 / prep.acceleration;
       if (sys.step_control & STEP_CONTROL_EXECUTE_HOLD)
       { // [强制减速至零速度]
         // 计算正在进行的进给保持的速度曲线参数。该曲线覆盖
@@ -854,7 +1042,7 @@ void st_prep_buffer()
         if (decel_dist < 0.0)
         {
           // 在整个规划块中减速。进给保持的结束不在此块中。
-          prep.exit_speed = sqrt(pl_block->entry_speed_sqr - 2 * pl_block->acceleration * pl_block->millimeters);
+          prep.exit_speed = sqrt(pl_block->entry_speed_sqr - pl_block->speed_sqr_delta);
         }
         else
         {
@@ -895,7 +1083,7 @@ void st_prep_buffer()
             // prep.maximum_speed = prep.current_speed;
 
             // 计算覆盖块的出口速度，因为它与规划者出口速度不匹配。
-            prep.exit_speed = sqrt(pl_block->entry_speed_sqr - 2 * pl_block->acceleration * pl_block->millimeters);
+            prep.exit_speed = sqrt(pl_block->entry_speed_sqr - pl_block->speed_sqr_delta);
             prep.recalculate_flag |= PREP_FLAG_DECEL_OVERRIDE; // 标记以加载下一个块作为减速覆盖。
 
             // TODO: 确定在仅减速时参数的正确处理。
@@ -934,7 +1122,7 @@ void st_prep_buffer()
             { // 三角形类型
               prep.accelerate_until = intersect_distance;
               prep.decelerate_after = intersect_distance;
-              prep.maximum_speed = sqrt(2.0 * pl_block->acceleration * intersect_distance + exit_speed_sqr);
+              prep.maximum_speed = sqrt(2.0 * prep.acceleration * intersect_distance + exit_speed_sqr);
             }
           }
           else
@@ -977,6 +1165,18 @@ void st_prep_buffer()
     float mm_var;                                            // mm-距离工作变量
     float speed_var;                                         // 速度工作变量
     float mm_remaining = pl_block->millimeters;              // 从块的末尾到新段的距离。
+#ifdef ENABLE_NATIVE_ARCS
+    if (prep.arc_millimeters > 0.0)
+    {
+      // 圆弧段的弦高不超过 $12：按本段可能的最高速度缩短段时间。
+      speed_var = max(prep.current_speed, prep.maximum_speed);
+      if (speed_var * dt_max > prep.arc_max_chord)
+      {
+        dt_max = prep.arc_max_chord / speed_var;
+        time_var = dt_max;
+      }
+    }
+#endif
     float minimum_mm = mm_remaining - prep.req_mm_increment; // 确保至少有一步。
     if (minimum_mm < 0.0)
     {
@@ -988,7 +1188,7 @@ void st_prep_buffer()
       switch (prep.ramp_type)
       {
       case RAMP_DECEL_OVERRIDE:
-        speed_var = pl_block->acceleration * time_var;
+        speed_var = prep.acceleration * time_var;
         mm_var = time_var * (prep.current_speed - 0.5 * speed_var);
         mm_remaining -= mm_var;
         if ((mm_remaining < prep.accelerate_until) || (mm_var <= 0))
@@ -1006,7 +1206,7 @@ void st_prep_buffer()
         break;
       case RAMP_ACCEL:
         // 注意：加速坡道仅在第一次 do-while 循环中计算。
-        speed_var = pl_block->acceleration * time_var;
+        speed_var = prep.acceleration * time_var;
         mm_remaining -= time_var * (prep.current_speed + 0.5 * speed_var);
         if (mm_remaining < prep.accelerate_until)
         { // 加速坡道结束。
@@ -1047,7 +1247,7 @@ void st_prep_buffer()
         break;
       default: // case RAMP_DECEL:
         // 注意：mm_var 作为杂项工作变量，以防在接近零速度时出错。
-        speed_var = pl_block->acceleration * time_var; // 作为增量速度（mm/min）
+        speed_var = prep.acceleration * time_var; // 作为增量速度（mm/min）
         if (prep.current_speed > speed_var)
         { // 检查是否处于零速度或以下。
           // 计算从段末尾到块末尾的距离。
@@ -1120,10 +1320,21 @@ void st_prep_buffer()
       这可能会导致步骤丢失。
       幸运的是，这种情况在 Grbl 支持的 CNC 机器中非常不太可能且不现实（即，以 200 步/mm 超过 10 米的轴移动）。
     */
-    float step_dist_remaining = prep.step_per_mm * mm_remaining;       // 将 mm_remaining 转换为步骤
-    float n_steps_remaining = ceil(step_dist_remaining);               // 向上取整当前剩余步骤
-    float last_n_steps_remaining = ceil(prep.steps_remaining);         // 向上取整最后剩余步骤
-    prep_segment->n_step = last_n_steps_remaining - n_steps_remaining; // 计算待执行的步骤数。
+    float step_dist_remaining = 0.0, n_steps_remaining = 0.0, last_n_steps_remaining = 0.0;
+#ifdef ENABLE_NATIVE_ARCS
+    if (prep.arc_millimeters > 0.0)
+    {
+      prep_segment->n_step = st_prep_arc_segment(mm_remaining); // 圆弧段的步数为弦的步事件数。
+      prep_segment->st_block_index = prep.st_block_index;
+    }
+    else
+#endif
+    {
+      step_dist_remaining = prep.step_per_mm * mm_remaining;             // 将 mm_remaining 转换为步骤
+      n_steps_remaining = ceil(step_dist_remaining);                     // 向上取整当前剩余步骤
+      last_n_steps_remaining = ceil(prep.steps_remaining);               // 向上取整最后剩余步骤
+      prep_segment->n_step = last_n_steps_remaining - n_steps_remaining; // 计算待执行的步骤数。
+    }
 
     // 如果我们处于进给保持的末尾而没有步骤可执行，则退出。
     if (prep_segment->n_step == 0)
@@ -1145,81 +1356,109 @@ void st_prep_buffer()
 
     // 计算段步率。由于步骤是整数而毫米距离不是，
     // 每个段的末尾可能有不同数量的部分步骤未执行，因为步进 ISR 需要整体步骤以满足 AMASS 算法。为了补偿，我们跟踪执行前一个段的部分步骤所需的时间，并将其简单地应用于当前段的部分步骤，从而微调整体段速率以保持步骤输出准确。这些速率调整通常非常小，并不会对性能产生不利影响，但确保 Grbl 输出由规划器计算的确切加速度和速度曲线。
-    dt += prep.dt_remainder;                                              // 应用前一个段部分步骤的执行时间
-    float inv_rate = dt / (last_n_steps_remaining - step_dist_remaining); // 计算调整后的步骤速率反向
-
-    // 计算预备段的每步 CPU 周期。
-    uint32_t cycles = ceil((TICKS_PER_MICROSECOND * 1000000 * 60) * inv_rate); // （周期/步）
-
-#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
-                                                                               // 计算步进时序和多轴平滑级别。
-    // 注意：AMASS 通过每个级别超驱动定时器，因此只需要一个预分频器。
-    if (cycles < AMASS_LEVEL1)
+    dt += prep.dt_remainder; // 应用前一个段部分步骤的执行时间
+    float inv_rate = 0.0;
+#ifdef ENABLE_NATIVE_ARCS
+    if (prep.arc_millimeters > 0.0)
     {
-      prep_segment->amass_level = 0;
+      // 圆弧段的步数是整数，没有部分步骤。不足一步的段不生成，其时间计入下一段。
+      if (prep_segment->n_step == 0)
+      {
+        prep.dt_remainder = dt;
+      }
+      else
+      {
+        prep.dt_remainder = 0.0;
+        inv_rate = dt / prep_segment->n_step;
+      }
     }
     else
+#endif
+    inv_rate = dt / (last_n_steps_remaining - step_dist_remaining); // 计算调整后的步骤速率反向
+
+#ifdef ENABLE_NATIVE_ARCS
+    if (prep_segment->n_step != 0)
+#endif
     {
-      if (cycles < AMASS_LEVEL2)
+      // 计算预备段的每步 CPU 周期。
+      uint32_t cycles = ceil((TICKS_PER_MICROSECOND * 1000000 * 60) * inv_rate); // （周期/步）
+
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+                                                                                 // 计算步进时序和多轴平滑级别。
+      // 注意：AMASS 通过每个级别超驱动定时器，因此只需要一个预分频器。
+      if (cycles < AMASS_LEVEL1)
       {
-        prep_segment->amass_level = 1;
+        prep_segment->amass_level = 0;
       }
-      else if (cycles < AMASS_LEVEL3)
+      else
       {
-        prep_segment->amass_level = 2;
+        if (cycles < AMASS_LEVEL2)
+        {
+          prep_segment->amass_level = 1;
+        }
+        else if (cycles < AMASS_LEVEL3)
+        {
+          prep_segment->amass_level = 2;
+        }
+        else
+        {
+          prep_segment->amass_level = 3;
+        }
+        cycles >>= prep_segment->amass_level;
+        prep_segment->n_step <<= prep_segment->amass_level;
       }
+      if (cycles < (1UL << 16))
+      {
+        prep_segment->cycles_per_tick = cycles;
+      } // < 65536 (16MHz 下 4.1ms)
       else
       {
-        prep_segment->amass_level = 3;
-      }
-      cycles >>= prep_segment->amass_level;
-      prep_segment->n_step <<= prep_segment->amass_level;
-    }
-    if (cycles < (1UL << 16))
-    {
-      prep_segment->cycles_per_tick = cycles;
-    } // < 65536 (16MHz 下 4.1ms)
-    else
-    {
-      prep_segment->cycles_per_tick = 0xffff;
-    } // 设定为可能的最低速度。
+        prep_segment->cycles_per_tick = 0xffff;
+      } // 设定为可能的最低速度。
 #else
-                                                                               // 计算正常步进生成的步进时序和定时器预分频器。
-    if (cycles < (1UL << 16))
-    {                              // < 65536  (16MHz 下 4.1ms)
-      prep_segment->prescaler = 1; // 预分频器：0
-      prep_segment->cycles_per_tick = cycles;
-    }
-    else if (cycles < (1UL << 19))
-    {                              // < 524288 (16MHz 下 32.8ms)
-      prep_segment->prescaler = 2; // 预分频器：8
-      prep_segment->cycles_per_tick = cycles >> 3;
-    }
-    else
-    {
-      prep_segment->prescaler = 3; // 预分频器：64
-      if (cycles < (1UL << 22))
-      { // < 4194304 (16MHz 下 262ms)
-        prep_segment->cycles_per_tick = cycles >> 6;
+                                                                                 // 计算正常步进生成的步进时序和定时器预分频器。
+      if (cycles < (1UL << 16))
+      {                              // < 65536  (16MHz 下 4.1ms)
+        prep_segment->prescaler = 1; // 预分频器：0
+        prep_segment->cycles_per_tick = cycles;
+      }
+      else if (cycles < (1UL << 19))
+      {                              // < 524288 (16MHz 下 32.8ms)
+        prep_segment->prescaler = 2; // 预分频器：8
+        prep_segment->cycles_per_tick = cycles >> 3;
       }
       else
-      { // 设定为可能的最低速度。 （约 4 步/秒）。
-        prep_segment->cycles_per_tick = 0xffff;
+      {
+        prep_segment->prescaler = 3; // 预分频器：64
+        if (cycles < (1UL << 22))
+        { // < 4194304 (16MHz 下 262ms)
+          prep_segment->cycles_per_tick = cycles >> 6;
+        }
+        else
+        { // 设定为可能的最低速度。 （约 4 步/秒）。
+          prep_segment->cycles_per_tick = 0xffff;
+        }
       }
-    }
 #endif
 
-    // 段完成！增加段缓冲区索引，以便步进 ISR 可以立即执行它。
-    segment_buffer_head = segment_next_head;
-    if (++segment_next_head == SEGMENT_BUFFER_SIZE)
-    {
-      segment_next_head = 0;
+      // 段完成！增加段缓冲区索引，以便步进 ISR 可以立即执行它。
+      segment_buffer_head = segment_next_head;
+      if (++segment_next_head == SEGMENT_BUFFER_SIZE)
+      {
+        segment_next_head = 0;
+      }
     }
 
     // 更新适当的规划器和段数据。
     pl_block->millimeters = mm_remaining;
-    prep.steps_remaining = n_steps_remaining;
-    prep.dt_remainder = (n_steps_remaining - step_dist_remaining) * inv_rate;
+    pl_block->speed_sqr_delta = 2 * prep.acceleration * mm_remaining;
+#ifdef ENABLE_NATIVE_ARCS
+    if (prep.arc_millimeters == 0.0)
+#endif
+    {
+      prep.steps_remaining = n_steps_remaining;
+      prep.dt_remainder = (n_steps_remaining - step_dist_remaining) * inv_rate;
+    }
 
     // 检查退出条件并标记以加载下一个规划块。
     if (mm_remaining == prep.mm_complete)
@@ -1247,6 +1486,7 @@ void st_prep_buffer()
           return;
         }
         pl_block = NULL; // 设置指针以指示检查并加载下一个规划块。
+        pl_block_pending = false;
         plan_discard_current_block();
       }
     }
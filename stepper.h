@@ -54,4 +54,7 @@ void st_update_plan_block_parameters();
 // 如果在 config.h 中启用了实时速率报告，则由实时状态报告调用。
 float st_get_realtime_rate();
 
+// 返回复位以来段缓冲区欠载（规划器仍有运动时步进中断取空段缓冲区）的次数。
+uint16_t st_get_underrun_count();
+
 #endif
@@ -118,6 +118,53 @@ void system_execute_startup(char *line)
   }
 }
 
+#ifdef ENABLE_MACRO
+static char macro_line[MACRO_SIZE]; // 正在执行的宏，各行以 '|' 分隔
+static uint8_t macro_running;
+
+// 逐行执行宏。各行像启动行一样直接交给 g-code 解析器，运动排队方式与上位机发送的行相同。
+uint8_t system_execute_macro(uint8_t n)
+{
+  if (macro_running)
+  {
+    return (STATUS_MACRO_NESTED);
+  } // 宏共用一个缓冲区，不能嵌套。
+  if (!(settings_read_macro(n, macro_line)))
+  {
+    return (STATUS_SETTING_READ_FAIL);
+  }
+  uint8_t status_code = STATUS_OK;
+  char *block = macro_line;
+  macro_running = true;
+  while (*block != 0)
+  {
+    char *next = block;
+    while ((*next != 0) && (*next != '|'))
+    {
+      next++;
+    }
+    uint8_t last = (*next == 0);
+    *next = 0;
+    if (*block != 0)
+    {
+      status_code = gc_execute_line(block);
+      if (status_code)
+      {
+        report_execute_startup_message(block, status_code);
+        break;
+      }
+    }
+    if (last || sys.abort)
+    {
+      break;
+    } // 复位时放弃其余各行。
+    block = next + 1;
+  }
+  macro_running = false;
+  return (status_code);
+}
+#endif
+
 // 指导并执行来自 protocol_process 的一行格式化输入。虽然主要是
 // 输入流 g-code 块，但这也执行 Grbl 内部命令，例如
 // 设置、启动归位循环和切换开关状态。这与
@@ -160,6 +207,24 @@ uint8_t system_execute_line(char *line)
   case 'T':
     report_tool();
     break;
+#ifdef ENABLE_WINDOWED_ACK
+  case 'W': // 设置应答窗口 $W=<行数>，0 为逐行应答
+    if (line[2] != '=')
+    {
+      return (STATUS_INVALID_STATEMENT);
+    }
+    char_counter = 3;
+    if (!read_float(line, &char_counter, &value))
+    {
+      return (STATUS_BAD_NUMBER_FORMAT);
+    }
+    if ((line[char_counter] != 0) || (value < 0) || (value > 255))
+    {
+      return (STATUS_INVALID_STATEMENT);
+    }
+    sys.ack_window = trunc(value);
+    break;
+#endif
   case 'J': // 手动移动
     // 仅在 IDLE 或 JOG 状态下执行。
     if (sys.state != STATE_IDLE && sys.state != STATE_JOG)
@@ -350,6 +415,44 @@ uint8_t system_execute_line(char *line)
       report_feedback_message(MESSAGE_RESTORE_DEFAULTS);
       mc_reset(); // 强制重置以确保设置正确初始化。
       break;
+#ifdef ENABLE_MACRO
+    case 'M': // 宏 [IDLE/ALARM]
+      if (line[++char_counter] == 0)
+      { // 打印宏
+        for (helper_var = 0; helper_var < N_MACRO; helper_var++)
+        {
+          if (!(settings_read_macro(helper_var, line)))
+          {
+            report_status_message(STATUS_SETTING_READ_FAIL);
+          }
+          else
+          {
+            report_macro(helper_var, line);
+          }
+        }
+        break;
+      }
+      // 存储宏。不像启动行那样先执行校验，宏中的运动只应在调用时执行。
+      if (!read_float(line, &char_counter, &parameter))
+      {
+        return (STATUS_BAD_NUMBER_FORMAT);
+      }
+      if ((line[char_counter++] != '=') || (parameter < 0) || (parameter >= N_MACRO) || (parameter != trunc(parameter)))
+      {
+        return (STATUS_INVALID_STATEMENT);
+      }
+      helper_var = char_counter;
+      do
+      {
+        line[char_counter - helper_var] = line[char_counter];
+      } while (line[char_counter++] != 0);
+      if (char_counter - helper_var > MACRO_SIZE)
+      {
+        return (STATUS_LINE_LENGTH_EXCEEDED);
+      }
+      settings_store_macro(trunc(parameter), line);
+      break;
+#endif
     case 'N': // 启动行 [IDLE/ALARM]
       if (line[++char_counter] == 0)
       { // 打印启动行
@@ -556,9 +659,22 @@ void system_set_exec_motion_override_flag(uint8_t mask)
   uint8_t sreg = SREG;
   cli();                                 // 禁用中断
   sys_rt_exec_motion_override |= (mask); // 设置运动覆盖标志
+  if (mask & EXEC_FEED_OVR_RESET) { sys_rt_feed_ovr_delta = 0; } // 复位之前的增减作废
   SREG = sreg;                           // 恢复中断状态
 }
 
+// 累加进给覆盖的增减。累加值为 int16，限制在 MIN 到 MAX_FEED_RATE_OVERRIDE 的跨度之内（最大 254），
+// 超出部分无论如何都会被 protocol_exec_rt_system() 的上下限截掉，因此截断不会改变结果。
+void system_add_exec_feed_override(int8_t delta)
+{
+  uint8_t sreg = SREG;
+  cli();                    // 禁用中断
+  int16_t sum = sys_rt_feed_ovr_delta + delta;
+  sys_rt_feed_ovr_delta = max(min(sum, FEED_OVERRIDE_DELTA_SPAN), -FEED_OVERRIDE_DELTA_SPAN);
+  sys_rt_exec_motion_override |= EXEC_FEED_OVR_DELTA;
+  SREG = sreg;              // 恢复中断状态
+}
+
 void system_set_exec_accessory_override_flag(uint8_t mask)
 {
   uint8_t sreg = SREG;
@@ -567,12 +683,16 @@ void system_set_exec_accessory_override_flag(uint8_t mask)
   SREG = sreg;                              // 恢复中断状态
 }
 
-void system_clear_exec_motion_overrides()
+// 清除运动覆盖标志，返回并清除累加的进给覆盖增减。
+int16_t system_clear_exec_motion_overrides()
 {
   uint8_t sreg = SREG;
   cli();                           // 禁用中断
   sys_rt_exec_motion_override = 0; // 清除运动覆盖
+  int16_t delta = sys_rt_feed_ovr_delta;
+  sys_rt_feed_ovr_delta = 0;
   SREG = sreg;                     // 恢复中断状态
+  return (delta);
 }
 
 void system_clear_exec_accessory_overrides()
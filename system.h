@@ -47,14 +47,15 @@
 
 // 覆盖位图。实时位标志控制进给、快速、主轴和冷却液覆盖。
 // 主轴/冷却液和进给/快速被分为两个控制标志变量。
+// 进给覆盖的增减累加在 sys_rt_feed_ovr_delta 中，连续收到的多次按键合并为一次更新且不会丢失。
 #define EXEC_FEED_OVR_RESET         bit(0)
-#define EXEC_FEED_OVR_COARSE_PLUS   bit(1)
-#define EXEC_FEED_OVR_COARSE_MINUS  bit(2)
-#define EXEC_FEED_OVR_FINE_PLUS     bit(3)
-#define EXEC_FEED_OVR_FINE_MINUS    bit(4)
+#define EXEC_FEED_OVR_DELTA         bit(1)
 #define EXEC_RAPID_OVR_RESET        bit(5)
 #define EXEC_RAPID_OVR_MEDIUM       bit(6)
 #define EXEC_RAPID_OVR_LOW          bit(7)
+
+// 累加的进给覆盖增减的上下限。超过 MIN 到 MAX_FEED_RATE_OVERRIDE 跨度的部分没有意义。
+#define FEED_OVERRIDE_DELTA_SPAN (MAX_FEED_RATE_OVERRIDE - MIN_FEED_RATE_OVERRIDE)
 // #define EXEC_RAPID_OVR_EXTRA_LOW   bit(*) // *不支持*
 
 #define EXEC_SPINDLE_OVR_RESET         bit(0)
@@ -127,6 +128,12 @@ typedef struct {
   uint8_t report_ovr_counter;  // 跟踪何时将覆盖数据添加到状态报告。
   uint8_t report_wco_counter;  // 跟踪何时将工作坐标偏移数据添加到状态报告。
   float spindle_speed;
+  #ifdef ENABLE_WINDOWED_ACK
+    uint8_t ack_window;        // 窗口应答的最大行数，0 为逐行应答。
+  #endif
+  #ifdef ENABLE_PROGRAM_MODE
+    uint8_t program_mode;      // 正在执行以 '%' 开始的程序。复位时清除。
+  #endif
 } system_t;
 extern system_t sys;
 
@@ -138,6 +145,7 @@ volatile uint8_t sys_probe_state;   // 探测状态值。用于协调探测周
 volatile uint8_t sys_rt_exec_state;   // 用于状态管理的全局实时执行器位标志变量。见EXEC位掩码。
 volatile uint8_t sys_rt_exec_alarm;   // 用于设置各种警报的全局实时执行器位标志变量。
 volatile uint8_t sys_rt_exec_motion_override; // 用于运动相关覆盖的全局实时执行器位标志变量。
+volatile int16_t sys_rt_feed_ovr_delta; // 尚未处理的进给覆盖增减（百分比）。
 volatile uint8_t sys_rt_exec_accessory_override; // 用于主轴/冷却液覆盖的全局实时执行器位标志变量。
 
 #ifdef DEBUG
@@ -160,6 +168,11 @@ uint8_t system_execute_line(char *line);
 // 在初始化时执行存储在EEPROM中的启动脚本行
 void system_execute_startup(char *line);
 
+#ifdef ENABLE_MACRO
+// 执行宏 n 的各行。由 M98 调用，返回第一个出错行的状态码。
+uint8_t system_execute_macro(uint8_t n);
+#endif
+
 void system_flag_wco_change();
 
 // 返回轴'idx'的机器位置。必须发送一个'step'数组。
@@ -183,8 +196,9 @@ void system_clear_exec_state_flag(uint8_t mask);
 void system_set_exec_alarm(uint8_t code);
 void system_clear_exec_alarm();
 void system_set_exec_motion_override_flag(uint8_t mask);
+void system_add_exec_feed_override(int8_t delta);
 void system_set_exec_accessory_override_flag(uint8_t mask);
-void system_clear_exec_motion_overrides();
+int16_t system_clear_exec_motion_overrides();
 void system_clear_exec_accessory_overrides();
 
 #endif